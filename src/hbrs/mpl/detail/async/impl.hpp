@@ -0,0 +1,392 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef HBRS_MPL_DETAIL_ASYNC_IMPL_HPP
+#define HBRS_MPL_DETAIL_ASYNC_IMPL_HPP
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <boost/assert.hpp>
+#include <mpi.h>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+namespace mpi {
+
+/*
+ * Owns the MPI_Request of a non-blocking operation.
+ *
+ * Destruction waits for the operation to complete, so that buffers of an operation which has been abandoned, e.g.
+ * because an exception has been thrown in between, are not released while MPI still writes to them.
+ */
+class request {
+public:
+	request() : req_{MPI_REQUEST_NULL} {}
+	explicit request(MPI_Request req) : req_{req} {}
+	
+	request(request const&) = delete;
+	request(request && rhs) noexcept : req_{rhs.req_} {
+		rhs.req_ = MPI_REQUEST_NULL;
+	}
+	
+	request&
+	operator=(request const&) = delete;
+	request&
+	operator=(request && rhs) {
+		if (this != &rhs) {
+			wait();
+			req_ = rhs.req_;
+			rhs.req_ = MPI_REQUEST_NULL;
+		}
+		return *this;
+	}
+	
+	~request() {
+		if (req_ != MPI_REQUEST_NULL && !finalized()) {
+			MPI_Wait(&req_, MPI_STATUS_IGNORE);
+		}
+	}
+	
+	/* Drives progress of the operation and returns true if it has completed */
+	bool
+	test() {
+		return (req_ == MPI_REQUEST_NULL) || mpi::test(req_);
+	}
+	
+	void
+	wait() {
+		if (req_ != MPI_REQUEST_NULL) {
+			mpi::wait(req_);
+		}
+	}
+	
+private:
+	MPI_Request req_;
+};
+
+/*
+ * Result of a non-blocking operation which becomes available after the operation has completed, similar to
+ * std::future. The continuation turns the buffers of the operation into the result and runs at most once, during
+ * get().
+ */
+template<typename T>
+class future {
+public:
+	explicit future(T value) : cont_{}, req_{}, value_{std::move(value)} {}
+	
+	future(request req, std::function<T()> continuation)
+	: cont_{std::move(continuation)}, req_{std::move(req)}, value_{} {}
+	
+	future(future const&) = delete;
+	future(future &&) = default;
+	
+	future&
+	operator=(future const&) = delete;
+	future&
+	operator=(future && rhs) {
+		if (this != &rhs) {
+			// waits for a pending operation of this future before its buffers are released
+			req_ = std::move(rhs.req_);
+			cont_ = std::move(rhs.cont_);
+			value_ = std::move(rhs.value_);
+		}
+		return *this;
+	}
+	
+	bool
+	ready() {
+		return value_.has_value() || req_.test();
+	}
+	
+	T
+	get() {
+		if (!value_) {
+			req_.wait();
+			value_.emplace(cont_());
+			cont_ = nullptr;
+		}
+		return std::move(*value_);
+	}
+	
+private:
+	// members are destroyed in reverse order, i.e. req_ waits before cont_ releases the buffers of the operation
+	std::function<T()> cont_;
+	request req_;
+	std::optional<T> value_;
+};
+
+template<typename T>
+future<std::decay_t<T>>
+make_ready_future(T && value) {
+	return future<std::decay_t<T>>{HBRS_MPL_FWD(value)};
+}
+
+/*
+ * Starts a non-blocking operation on buffers in state, e.g. a std::vector, and returns a future of its result.
+ *
+ * State is moved to the heap before initiate(state) starts the operation and returns its MPI_Request, hence buffer
+ * addresses which have been handed to MPI stay valid until continuation(state) has computed the result.
+ */
+template<typename State, typename Initiate, typename Continuation>
+auto
+make_future(State state, Initiate && initiate, Continuation && continuation) {
+	typedef std::decay_t<decltype(continuation(std::declval<State&>()))> T;
+	
+	auto st = std::make_shared<State>(std::move(state));
+	request req{initiate(*st)};
+	return future<T>{
+		std::move(req),
+		[st, cont = HBRS_MPL_FWD(continuation)]() mutable { return cont(*st); }
+	};
+}
+
+/*
+ * Keeps a bounded number of non-blocking operations in flight, e.g. reductions of panels of a matrix, so that the
+ * computation of the next panel overlaps with the communication of previous ones. Continuations run in the order in
+ * which operations have been submitted.
+ */
+class pipeline {
+public:
+	explicit pipeline(std::size_t depth = 2) : depth_{depth}, stages_{} {
+		BOOST_ASSERT(depth_ > 0);
+	}
+	
+	pipeline(pipeline const&) = delete;
+	pipeline&
+	operator=(pipeline const&) = delete;
+	
+	~pipeline() {
+		// requests of stages wait on destruction, continuations are skipped
+		stages_.clear();
+	}
+	
+	/* Submits an operation, waiting for the oldest one to complete if depth operations are already in flight */
+	void
+	push(request req, std::function<void()> on_completion = {}) {
+		while (stages_.size() >= depth_) {
+			pop();
+		}
+		stages_.push_back(stage{std::move(on_completion), std::move(req)});
+		progress();
+	}
+	
+	/* Drives progress of all operations in flight and runs continuations of completed ones */
+	void
+	progress() {
+		while (!stages_.empty() && stages_.front().req.test()) {
+			pop();
+		}
+	}
+	
+	/* Waits for all operations in flight and runs their continuations */
+	void
+	finish() {
+		while (!stages_.empty()) {
+			pop();
+		}
+	}
+	
+	std::size_t
+	in_flight() const {
+		return stages_.size();
+	}
+	
+private:
+	struct stage {
+		// req is destroyed before on_completion, see future
+		std::function<void()> on_completion;
+		request req;
+	};
+	
+	void
+	pop() {
+		stage s = std::move(stages_.front());
+		stages_.pop_front();
+		s.req.wait();
+		if (s.on_completion) {
+			s.on_completion();
+		}
+	}
+	
+	std::size_t depth_;
+	std::deque<stage> stages_;
+};
+
+/*
+ * Allreduce which is bound to fixed buffers, datatype, operation and communicator and started repeatedly, e.g. for the
+ * column statistics of each batch of a stream or for a reduction in each iteration of a solver.
+ *
+ * With MPI-4 the plan is a persistent collective (MPI_Allreduce_init), hence MPI sets up the reduction once and each
+ * start() only triggers it. Else each start() issues an MPI_Iallreduce with the stored arguments. Creating a plan is
+ * collective over comm. Requests returned by start() must be destroyed before the plan.
+ */
+class allreduce_plan {
+public:
+	allreduce_plan(
+		void const* sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm
+	) : sendbuf_{sendbuf}, recvbuf_{recvbuf}, count_{count}, datatype_{datatype}, op_{op}, comm_{comm},
+		persistent_{allreduce_init(sendbuf, recvbuf, count, datatype, op, comm)} {}
+	
+	allreduce_plan(allreduce_plan const&) = delete;
+	allreduce_plan(allreduce_plan &&) = delete;
+	
+	allreduce_plan&
+	operator=(allreduce_plan const&) = delete;
+	allreduce_plan&
+	operator=(allreduce_plan &&) = delete;
+	
+	~allreduce_plan() {
+		if (persistent_ != MPI_REQUEST_NULL && !finalized()) {
+			MPI_Request_free(&persistent_);
+		}
+	}
+	
+	/* Starts the reduction, which is completed by waiting for the returned request */
+	request
+	start() {
+		if (persistent_ != MPI_REQUEST_NULL) {
+			mpi::start(persistent_);
+			// waiting on a copy of a persistent request leaves the request itself allocated
+			return request{persistent_};
+		}
+		return request{iallreduce(sendbuf_, recvbuf_, count_, datatype_, op_, comm_)};
+	}
+	
+	void
+	execute() {
+		start().wait();
+	}
+	
+	bool
+	persistent() const {
+		return persistent_ != MPI_REQUEST_NULL;
+	}
+	
+private:
+	void const* sendbuf_;
+	void * recvbuf_;
+	std::size_t count_;
+	MPI_Datatype datatype_;
+	MPI_Op op_;
+	MPI_Comm comm_;
+	MPI_Request persistent_;
+};
+
+/*
+ * Buffer of elements of type T which is reduced in place by an allreduce_plan. Kernels keep one per thread, so that
+ * consecutive calls with the same count, datatype, operation and communicator reuse buffer and plan. Results stay in
+ * the buffer until the next call of bind().
+ *
+ * The plan is attached to its communicator as an attribute, which drops the plan when the communicator is freed. Hence
+ * a new communicator which reuses the handle of a freed one gets a new plan, too, and all ranks of a communicator agree
+ * on whether a plan is recreated as long as they pass the same arguments to bind().
+ */
+template<typename T>
+class allreduce_buffer {
+public:
+	allreduce_buffer() = default;
+	allreduce_buffer(allreduce_buffer const&) = delete;
+	allreduce_buffer&
+	operator=(allreduce_buffer const&) = delete;
+	
+	~allreduce_buffer() {
+		if (keyval_ == MPI_KEYVAL_INVALID || finalized()) {
+			return;
+		}
+		release();
+		MPI_Comm_free_keyval(&keyval_);
+	}
+	
+	/* Returns the buffer of count elements with unspecified contents. Collective over comm if the plan is recreated. */
+	T *
+	bind(std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+		if (!plan_ || count != buffer_.size() || datatype != datatype_ || op != op_ || comm != comm_) {
+			release();
+			if (keyval_ == MPI_KEYVAL_INVALID) {
+				int const ec = MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &detach, &keyval_, nullptr);
+				BOOST_VERIFY(ec == MPI_SUCCESS);
+			}
+			
+			buffer_.resize(count);
+			datatype_ = datatype;
+			op_ = op;
+			comm_ = comm;
+			plan_ = std::make_unique<allreduce_plan>(MPI_IN_PLACE, buffer_.data(), count, datatype, op, comm);
+			BOOST_VERIFY(MPI_Comm_set_attr(comm, keyval_, this) == MPI_SUCCESS);
+		}
+		return buffer_.data();
+	}
+	
+	allreduce_plan &
+	plan() {
+		BOOST_ASSERT(plan_);
+		return *plan_;
+	}
+	
+	T *
+	data() {
+		return buffer_.data();
+	}
+	
+	std::size_t
+	size() const {
+		return buffer_.size();
+	}
+	
+private:
+	/* Drops the plan, called by MPI when comm_ is freed or the attribute is deleted */
+	static int
+	detach(MPI_Comm, int, void *attribute, void *) {
+		auto * self = static_cast<allreduce_buffer *>(attribute);
+		self->plan_.reset();
+		self->comm_ = MPI_COMM_NULL;
+		return MPI_SUCCESS;
+	}
+	
+	void
+	release() {
+		if (comm_ != MPI_COMM_NULL) {
+			// invokes detach()
+			BOOST_VERIFY(MPI_Comm_delete_attr(comm_, keyval_) == MPI_SUCCESS);
+		}
+		plan_.reset();
+	}
+	
+	// plan_ is destroyed before buffer_, see allreduce_plan
+	std::vector<T> buffer_;
+	MPI_Datatype datatype_ = MPI_DATATYPE_NULL;
+	MPI_Op op_ = MPI_OP_NULL;
+	MPI_Comm comm_ = MPI_COMM_NULL;
+	int keyval_ = MPI_KEYVAL_INVALID;
+	std::unique_ptr<allreduce_plan> plan_;
+};
+
+/* namespace mpi */ }
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_ASYNC_IMPL_HPP
@@ -0,0 +1,176 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE async_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/async.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/test.hpp>
+#include <algorithm>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(async_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+BOOST_AUTO_TEST_CASE(future_iallreduce) {
+	using namespace hbrs::mpl::detail;
+	
+	int const size = mpi::comm_size();
+	
+	auto f = mpi::make_future(
+		std::vector<double>{1., 2., 3.},
+		[](std::vector<double> & v) {
+			return mpi::iallreduce(MPI_IN_PLACE, v.data(), v.size(), mpi::datatype(boost::hana::type_c<double>), MPI_SUM, MPI_COMM_WORLD);
+		},
+		[](std::vector<double> & v) { return v; }
+	);
+	
+	std::vector<double> sums = f.get();
+	BOOST_TEST(sums.size() == 3u);
+	for (std::size_t i = 0; i < sums.size(); ++i) {
+		BOOST_TEST(sums[i] == (i+1.) * size);
+	}
+	BOOST_TEST(f.ready());
+	
+	auto g = mpi::make_ready_future(42);
+	BOOST_TEST(g.ready());
+	BOOST_TEST(g.get() == 42);
+}
+
+BOOST_AUTO_TEST_CASE(pipeline_panels) {
+	using namespace hbrs::mpl::detail;
+	
+	int const size = mpi::comm_size();
+	std::size_t const panels = 5;
+	std::vector<int> buf(panels * 4);
+	std::vector<std::size_t> completed;
+	
+	{
+		mpi::pipeline pl{2};
+		for (std::size_t p = 0; p < panels; ++p) {
+			for (std::size_t i = 0; i < 4; ++i) {
+				buf[p*4+i] = (int)p;
+			}
+			pl.push(
+				mpi::request{mpi::iallreduce(
+					MPI_IN_PLACE, buf.data() + p*4, 4, mpi::datatype(boost::hana::type_c<int>), MPI_SUM, MPI_COMM_WORLD
+				)},
+				[&completed, p]() { completed.push_back(p); }
+			);
+			BOOST_TEST(pl.in_flight() <= 2u);
+		}
+		pl.finish();
+		BOOST_TEST(pl.in_flight() == 0u);
+	}
+	
+	BOOST_TEST(completed.size() == panels);
+	for (std::size_t p = 0; p < panels; ++p) {
+		BOOST_TEST(completed[p] == p);
+		for (std::size_t i = 0; i < 4; ++i) {
+			BOOST_TEST(buf[p*4+i] == (int)p * size);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(allreduce_plan_repeated) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	
+	std::vector<double> send(3), recv(3);
+	mpi::allreduce_plan plan{
+		send.data(), recv.data(), send.size(), mpi::datatype(boost::hana::type_c<double>), MPI_SUM, MPI_COMM_WORLD
+	};
+	
+	for (int iteration = 0; iteration < 5; ++iteration) {
+		for (std::size_t i = 0; i < send.size(); ++i) {
+			send[i] = iteration * (rank + 1) + (double)i;
+		}
+		
+		if (iteration % 2 == 0) {
+			plan.execute();
+		} else {
+			mpi::request req = plan.start();
+			req.wait();
+		}
+		
+		for (std::size_t i = 0; i < recv.size(); ++i) {
+			BOOST_TEST(recv[i] == iteration * size * (size + 1) / 2. + (double)i * size);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(allreduce_buffer_rebind) {
+	using namespace hbrs::mpl::detail;
+	
+	int const size = mpi::comm_size();
+	MPI_Datatype const type = mpi::datatype(boost::hana::type_c<int>);
+	mpi::allreduce_buffer<int> buffer;
+	
+	int * buf = buffer.bind(4, type, MPI_SUM, MPI_COMM_WORLD);
+	mpi::allreduce_plan * plan = &buffer.plan();
+	for (int iteration = 0; iteration < 3; ++iteration) {
+		// same shape, hence buffer and plan are reused
+		BOOST_TEST(buffer.bind(4, type, MPI_SUM, MPI_COMM_WORLD) == buf);
+		BOOST_TEST(&buffer.plan() == plan);
+		
+		std::fill(buf, buf + 4, iteration);
+		buffer.plan().execute();
+		for (int i = 0; i < 4; ++i) {
+			BOOST_TEST(buf[i] == iteration * size);
+		}
+	}
+	
+	// other operation, hence a new plan
+	buf = buffer.bind(2, type, MPI_MAX, MPI_COMM_WORLD);
+	BOOST_TEST(buffer.size() == 2u);
+	buf[0] = mpi::comm_rank();
+	buf[1] = -mpi::comm_rank();
+	buffer.plan().execute();
+	BOOST_TEST(buf[0] == size - 1);
+	BOOST_TEST(buf[1] == 0);
+}
+
+BOOST_AUTO_TEST_CASE(allreduce_buffer_freed_comm) {
+	using namespace hbrs::mpl::detail;
+	
+	int const size = mpi::comm_size();
+	MPI_Datatype const type = mpi::datatype(boost::hana::type_c<int>);
+	mpi::allreduce_buffer<int> buffer;
+	
+	// communicators of consecutive grids often reuse the handle of the freed one
+	for (int iteration = 0; iteration < 3; ++iteration) {
+		MPI_Comm comm;
+		MPI_Comm_dup(MPI_COMM_WORLD, &comm);
+		
+		int * buf = buffer.bind(3, type, MPI_SUM, comm);
+		std::fill(buf, buf + 3, iteration + 1);
+		buffer.plan().execute();
+		for (int i = 0; i < 3; ++i) {
+			BOOST_TEST(buf[i] == (iteration + 1) * size);
+		}
+		
+		MPI_Comm_free(&comm);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,655 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HBRS_MPL_DETAIL_BIDIAGONAL_SVD_IMPL_HPP
+#define HBRS_MPL_DETAIL_BIDIAGONAL_SVD_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/detail/thread_pool.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/*
+ * SVD B = U*diag(s)*V' of a n-by-n upper bidiagonal matrix B. Singular values are sorted in descending order, U and V
+ * are n-by-n and stored column by column. Both are empty if only singular values have been computed.
+ */
+template<typename Real>
+struct bidiagonal_svd_result {
+	std::vector<Real> s;
+	std::vector<Real> u;
+	std::vector<Real> v;
+};
+
+namespace bidiagonal_svd_impl {
+
+/* Subproblems with fewer rows are solved on the calling thread instead of being forked as tasks of the thread pool */
+constexpr std::size_t task_threshold = 128;
+
+/* Maximum number of iterations of the secular equation solver, bisection alone converges in less than 2100 steps */
+constexpr std::size_t secular_max_iterations = 2200;
+
+template<typename Real>
+struct matrix {
+	matrix() : rows{0}, cols{0} {}
+	matrix(std::size_t rows_, std::size_t cols_) : rows{rows_}, cols{cols_}, data(rows_ * cols_, Real{0}) {}
+
+	Real &
+	operator()(std::size_t i, std::size_t j) { return data[i + j * rows]; }
+
+	Real const&
+	operator()(std::size_t i, std::size_t j) const { return data[i + j * rows]; }
+
+	Real *
+	column(std::size_t j) { return data.data() + j * rows; }
+
+	std::size_t rows, cols;
+	std::vector<Real> data;
+};
+
+template<typename Real>
+matrix<Real>
+identity(std::size_t n) {
+	matrix<Real> i{n, n};
+	for (std::size_t j = 0; j < n; ++j) {
+		i(j, j) = Real{1};
+	}
+	return i;
+}
+
+/* C += A*B for column-major A (rows-by-inner), B (inner-by-cols) and C (rows-by-cols), columns of C in parallel */
+template<typename Real>
+void
+multiply_add(
+	std::size_t rows, std::size_t cols, std::size_t inner,
+	Real const* a, std::size_t lda, Real const* b, std::size_t ldb, Real * c, std::size_t ldc
+) {
+	parallel_for(0, cols, grain_size(cols, rows * inner), [=](std::size_t first, std::size_t last) {
+		for (std::size_t j = first; j < last; ++j) {
+			Real * const cj = c + j * ldc;
+			for (std::size_t l = 0; l < inner; ++l) {
+				Real const blj = b[l + j * ldb];
+				if (blj == Real{0}) {
+					continue;
+				}
+				Real const* const al = a + l * lda;
+				#ifdef _OPENMP
+				#pragma omp simd
+				#endif
+				for (std::size_t i = 0; i < rows; ++i) {
+					cj[i] += al[i] * blj;
+				}
+			}
+		}
+	});
+}
+
+/* x := c*x + s*y and y := -s*x + c*y */
+template<typename Real>
+void
+rotate(Real * x, Real * y, std::size_t n, Real c, Real s) {
+	for (std::size_t i = 0; i < n; ++i) {
+		Real const xi = x[i];
+		x[i] = c * xi + s * y[i];
+		y[i] = -s * xi + c * y[i];
+	}
+}
+
+/* SVD B = U*diag(s)*W' of a m-by-(m+sqre) upper bidiagonal matrix B. If sqre is true, the last column of the
+ * (m+1)-by-(m+1) matrix W spans the null space of B.
+ */
+template<typename Real>
+struct dc_result {
+	std::vector<Real> s;
+	matrix<Real> u;
+	matrix<Real> w;
+};
+
+/*
+ * SVD of the m-by-m matrix M which holds z in its first row, d(1),...,d(m-1) on the remaining diagonal and zeros
+ * elsewhere, cf. LAPACK's xLASD2 (deflation), xLASD3 (singular vectors) and xLASD4 (secular equation).
+ *
+ * Small components of z and (almost) equal diagonal entries are deflated with Givens rotations first. Singular values
+ * of the remaining matrix are the roots of the secular equation f(sigma) = 1 + sum_j z_j^2/(d_j^2 - sigma^2), each of
+ * which is computed relative to its closest pole d_j to keep the differences d_j - sigma accurate. Instead of z the
+ * vector z^ for which the computed singular values are exact is used for the singular vectors, hence they are
+ * numerically orthogonal [1].
+ *
+ * Ref.:
+ * [1] M. Gu and S. C. Eisenstat, "A Divide-and-Conquer Algorithm for the Bidiagonal SVD", SIAM Journal on Matrix
+ *     Analysis and Applications, 16(1), 1995.
+ */
+template<typename Real>
+dc_result<Real>
+arrow_svd(std::vector<Real> z, std::vector<Real> d) {
+	std::size_t const m = z.size();
+	Real const eps = std::numeric_limits<Real>::epsilon();
+	d[0] = Real{0};
+
+	dc_result<Real> r{std::vector<Real>(m, Real{0}), identity<Real>(m), identity<Real>(m)};
+
+	Real scale{0};
+	for (std::size_t i = 0; i < m; ++i) {
+		scale = std::max({scale, std::abs(d[i]), std::abs(z[i])});
+	}
+	if (scale == Real{0}) {
+		return r;
+	}
+	Real const tol = 8 * eps * scale;
+
+	std::vector<std::size_t> order(m);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin() + 1, order.end(), [&d](std::size_t i, std::size_t j) { return d[i] < d[j]; });
+
+	if (std::abs(z[0]) <= tol) {
+		z[0] = tol;
+	}
+
+	// deflation
+	std::vector<std::size_t> kept{0};
+	std::vector<std::pair<Real, std::size_t>> deflated;
+	for (std::size_t pos = 1; pos < m; ++pos) {
+		std::size_t const j = order[pos];
+		if (std::abs(z[j]) <= tol) {
+			deflated.emplace_back(d[j], j);
+			continue;
+		}
+
+		if (d[j] <= tol) {
+			// d(j) is negligible, i.e. column j is parallel to the first column
+			Real const h = std::hypot(z[0], z[j]);
+			Real const c = z[0] / h;
+			Real const s = z[j] / h;
+			rotate(r.w.column(0), r.w.column(j), m, c, s);
+			z[0] = h;
+			z[j] = Real{0};
+			deflated.emplace_back(c * d[j], j);
+			continue;
+		}
+
+		std::size_t const i = kept.back();
+		if (i != 0 && d[j] - d[i] <= tol) {
+			Real const h = std::hypot(z[i], z[j]);
+			Real const c = z[i] / h;
+			Real const s = z[j] / h;
+			rotate(r.u.column(i), r.u.column(j), m, c, s);
+			rotate(r.w.column(i), r.w.column(j), m, c, s);
+			z[i] = h;
+			z[j] = Real{0};
+			deflated.emplace_back(d[j], j);
+			continue;
+		}
+
+		kept.push_back(j);
+	}
+
+	std::size_t const k = kept.size();
+	std::vector<Real> dk(k), zk(k);
+	Real rho{0};
+	for (std::size_t q = 0; q < k; ++q) {
+		dk[q] = d[kept[q]];
+		zk[q] = z[kept[q]];
+		rho += zk[q] * zk[q];
+	}
+
+	// secular equation, the i-th root is sigma_i = dk[origin[i]] + tau[i] with dk[i] < sigma_i < dk[i+1]
+	std::vector<std::size_t> origin(k);
+	std::vector<Real> tau(k);
+
+	auto secular = [&](std::size_t o, Real t) {
+		Real const sigma = dk[o] + t;
+		Real f{1}, df{0};
+		for (std::size_t q = 0; q < k; ++q) {
+			Real const w = zk[q] / (((dk[q] - dk[o]) - t) * (dk[q] + dk[o] + t));
+			f += zk[q] * w;
+			df += 2 * sigma * w * w;
+		}
+		return std::make_pair(f, df);
+	};
+
+	for (std::size_t i = 0; i < k; ++i) {
+		std::size_t o = i;
+		Real lo{0}, hi;
+		if (i + 1 < k) {
+			Real const gap = dk[i + 1] - dk[i];
+			if (secular(i, gap / 2).first >= Real{0}) {
+				hi = gap / 2;
+			} else {
+				o = i + 1;
+				lo = -gap / 2;
+				hi = Real{0};
+			}
+		} else {
+			hi = std::sqrt(rho);
+		}
+
+		// Newton's method, safeguarded by bisection because f has poles at both ends of the interval
+		Real t = (lo + hi) / 2;
+		for (std::size_t it = 0; it < secular_max_iterations; ++it) {
+			auto const [f, df] = secular(o, t);
+			if (f == Real{0}) {
+				break;
+			}
+			(f < Real{0} ? lo : hi) = t;
+
+			Real t_ = t - f / df;
+			if (!(t_ > lo && t_ < hi)) {
+				t_ = (lo + hi) / 2;
+			}
+
+			bool const converged = std::abs(t_ - t) <= eps * std::abs(t_) || t_ == lo || t_ == hi;
+			t = t_;
+			if (converged) {
+				break;
+			}
+		}
+
+		origin[i] = o;
+		tau[i] = t;
+	}
+
+	// differences dk[q] - sigma_i and sums dk[q] + sigma_i
+	auto delta = [&](std::size_t q, std::size_t i) { return (dk[q] - dk[origin[i]]) - tau[i]; };
+	auto sum = [&](std::size_t q, std::size_t i) { return dk[q] + dk[origin[i]] + tau[i]; };
+
+	// z^ from Loewner's theorem
+	std::vector<Real> zh(k);
+	for (std::size_t q = 0; q < k; ++q) {
+		Real p = -delta(q, k - 1) * sum(q, k - 1);
+		for (std::size_t i = 0; i < q; ++i) {
+			p *= (-delta(q, i) * sum(q, i)) / ((dk[i] - dk[q]) * (dk[i] + dk[q]));
+		}
+		for (std::size_t i = q; i + 1 < k; ++i) {
+			p *= (-delta(q, i) * sum(q, i)) / ((dk[i + 1] - dk[q]) * (dk[i + 1] + dk[q]));
+		}
+		zh[q] = std::copysign(std::sqrt(std::abs(p)), zk[q]);
+	}
+
+	matrix<Real> uk{k, k}, vk{k, k};
+	for (std::size_t i = 0; i < k; ++i) {
+		Real nu{0}, nv{0};
+		for (std::size_t q = 0; q < k; ++q) {
+			Real const v = zh[q] / (delta(q, i) * sum(q, i));
+			vk(q, i) = v;
+			uk(q, i) = q == 0 ? Real{-1} : dk[q] * v;
+			nu += uk(q, i) * uk(q, i);
+			nv += v * v;
+		}
+		nu = std::sqrt(nu);
+		nv = std::sqrt(nv);
+		for (std::size_t q = 0; q < k; ++q) {
+			uk(q, i) /= nu;
+			vk(q, i) /= nv;
+		}
+	}
+
+	// singular vectors of M are the columns of the rotated bases combined with uk and vk
+	matrix<Real> ub{m, k}, wb{m, k}, uc{m, k}, wc{m, k};
+	for (std::size_t q = 0; q < k; ++q) {
+		std::copy_n(r.u.column(kept[q]), m, ub.column(q));
+		std::copy_n(r.w.column(kept[q]), m, wb.column(q));
+	}
+	multiply_add(m, k, k, ub.data.data(), m, uk.data.data(), k, uc.data.data(), m);
+	multiply_add(m, k, k, wb.data.data(), m, vk.data.data(), k, wc.data.data(), m);
+
+	// sort all singular values in descending order
+	std::vector<std::pair<Real, std::size_t>> all;
+	all.reserve(m);
+	for (std::size_t i = 0; i < k; ++i) {
+		all.emplace_back(dk[origin[i]] + tau[i], i);
+	}
+	for (auto const& [s, j] : deflated) {
+		all.emplace_back(s, k + j);
+	}
+	std::stable_sort(all.begin(), all.end(), [](auto const& a, auto const& b) { return a.first > b.first; });
+
+	dc_result<Real> result{std::vector<Real>(m), matrix<Real>{m, m}, matrix<Real>{m, m}};
+	for (std::size_t c = 0; c < m; ++c) {
+		auto const [s, src] = all[c];
+		result.s[c] = s;
+		if (src < k) {
+			std::copy_n(uc.column(src), m, result.u.column(c));
+			std::copy_n(wc.column(src), m, result.w.column(c));
+		} else {
+			std::copy_n(r.u.column(src - k), m, result.u.column(c));
+			std::copy_n(r.w.column(src - k), m, result.w.column(c));
+		}
+	}
+	return result;
+}
+
+/*
+ * Merges the SVDs r1 of B1 = B(0:k-1, 0:k) and r2 of B2 = B(k+1:m-1, k+1:m-1+sqre) of the m-by-(m+sqre) upper
+ * bidiagonal matrix B whose k-th row holds dk and ek, cf. LAPACK's xLASD1. In the bases given by r1 and r2, B has the
+ * nonzeros of row k in the first row (after rotating the null vectors of B1 and B2 into one column) and singular values
+ * of B1 and B2 on the diagonal, i.e. the structure arrow_svd() expects.
+ */
+template<typename Real>
+dc_result<Real>
+merge(Real dk, Real ek, dc_result<Real> const& r1, dc_result<Real> const& r2, bool sqre) {
+	std::size_t const m1 = r1.s.size();
+	std::size_t const m2 = r2.s.size();
+	std::size_t const m = m1 + m2 + 1;
+	std::size_t const n = m + (sqre ? 1 : 0);
+	std::size_t const n1 = m1 + 1;
+	std::size_t const n2 = m2 + (sqre ? 1 : 0);
+
+	std::vector<Real> z(m), d(m);
+	for (std::size_t i = 0; i < m1; ++i) {
+		z[1 + i] = dk * r1.w(m1, i);
+		d[1 + i] = r1.s[i];
+	}
+	for (std::size_t i = 0; i < m2; ++i) {
+		z[1 + m1 + i] = ek * r2.w(0, i);
+		d[1 + m1 + i] = r2.s[i];
+	}
+
+	Real const lambda1 = dk * r1.w(m1, m1);
+	Real const phi2 = sqre ? ek * r2.w(0, m2) : Real{0};
+	Real const r0 = std::hypot(lambda1, phi2);
+	Real const c0 = r0 == Real{0} ? Real{1} : lambda1 / r0;
+	Real const s0 = r0 == Real{0} ? Real{0} : phi2 / r0;
+	z[0] = r0;
+
+	auto const a = arrow_svd(std::move(z), std::move(d));
+
+	dc_result<Real> r{a.s, matrix<Real>{m, m}, matrix<Real>{n, n}};
+
+	// U = diag(U1, 1, U2) * P * U_a where P moves row k to the top
+	for (std::size_t j = 0; j < m; ++j) {
+		r.u(m1, j) = a.u(0, j);
+	}
+	multiply_add(m1, m, m1, r1.u.data.data(), m1, a.u.data.data() + 1, m, r.u.data.data(), m);
+	multiply_add(m2, m, m2, r2.u.data.data(), m2, a.u.data.data() + 1 + m1, m, r.u.data.data() + m1 + 1, m);
+
+	// W(:, 0:m-1) = diag(W1, W2) * [c0*q1 V1 0; s0*q2 0 V2] * W_a
+	multiply_add(n1, m, m1, r1.w.data.data(), n1, a.w.data.data() + 1, m, r.w.data.data(), n);
+	multiply_add(n2, m, m2, r2.w.data.data(), n2, a.w.data.data() + 1 + m1, m, r.w.data.data() + n1, n);
+	for (std::size_t j = 0; j < m; ++j) {
+		for (std::size_t i = 0; i < n1; ++i) {
+			r.w(i, j) += r1.w(i, m1) * c0 * a.w(0, j);
+		}
+		if (sqre) {
+			for (std::size_t i = 0; i < n2; ++i) {
+				r.w(n1 + i, j) += r2.w(i, m2) * s0 * a.w(0, j);
+			}
+		}
+	}
+
+	if (sqre) {
+		for (std::size_t i = 0; i < n1; ++i) {
+			r.w(i, m) = -s0 * r1.w(i, m1);
+		}
+		for (std::size_t i = 0; i < n2; ++i) {
+			r.w(n1 + i, m) = c0 * r2.w(i, m2);
+		}
+	}
+
+	return r;
+}
+
+/* SVD of the m-by-(m+sqre) upper bidiagonal matrix with diagonal d and superdiagonal e, cf. LAPACK's xLASD0 */
+template<typename Real>
+dc_result<Real>
+divide_and_conquer(Real const* d, Real const* e, std::size_t m, bool sqre) {
+	if (m == 0) {
+		return { {}, matrix<Real>{}, identity<Real>(sqre ? 1 : 0) };
+	}
+
+	if (m == 1) {
+		if (!sqre) {
+			matrix<Real> u{1, 1};
+			u(0, 0) = d[0] < Real{0} ? Real{-1} : Real{1};
+			return { {std::abs(d[0])}, std::move(u), identity<Real>(1) };
+		}
+
+		Real const h = std::hypot(d[0], e[0]);
+		if (h == Real{0}) {
+			return { {Real{0}}, identity<Real>(1), identity<Real>(2) };
+		}
+		matrix<Real> w{2, 2};
+		w(0, 0) = d[0] / h;
+		w(1, 0) = e[0] / h;
+		w(0, 1) = -e[0] / h;
+		w(1, 1) = d[0] / h;
+		return { {h}, identity<Real>(1), std::move(w) };
+	}
+
+	std::size_t const k = m / 2;
+	std::size_t const m2 = m - k - 1;
+	dc_result<Real> r1, r2;
+
+	if (m >= task_threshold) {
+		parallel_invoke(
+			[&]() { r2 = divide_and_conquer(d + k + 1, e + k + 1, m2, sqre); },
+			[&]() { r1 = divide_and_conquer(d, e, k, true); }
+		);
+	} else {
+		r1 = divide_and_conquer(d, e, k, true);
+		r2 = divide_and_conquer(d + k + 1, e + k + 1, m2, sqre);
+	}
+
+	return merge(d[k], (m2 > 0 || sqre) ? e[k] : Real{0}, r1, r2, sqre);
+}
+
+/* Eigenvalues of the qd array q, ee (i.e. of L*U with diagonal q and superdiagonal ee of U) plus the shift sigma are
+ * appended to values. Returns false if they did not converge within max_iterations_per_value * q.size() iterations, in
+ * which case values is incomplete.
+ */
+template<typename Real>
+bool
+dqds(
+	std::vector<Real> q, std::vector<Real> ee, Real sigma, std::vector<Real> & values,
+	std::size_t max_iterations_per_value
+) {
+	Real const tol = 100 * std::numeric_limits<Real>::epsilon();
+	Real const tol2 = tol * tol;
+
+	std::size_t n = q.size();
+	std::vector<Real> qh(n), eh(n);
+	Real shift{0};
+	std::size_t iterations = max_iterations_per_value * n;
+
+	while (n > 0) {
+		if (n == 1) {
+			values.push_back(sigma + q[0]);
+			break;
+		}
+
+		if (ee[n - 2] <= tol2 * (sigma + q[n - 1])) {
+			values.push_back(sigma + q[n - 1]);
+			--n;
+			continue;
+		}
+
+		if (n == 2 || ee[n - 3] <= tol2 * (sigma + q[n - 2])) {
+			// eigenvalues of the trailing 2-by-2 block
+			Real const t = (q[n - 2] + ee[n - 2] + q[n - 1]) / 2;
+			Real const det = q[n - 2] * q[n - 1];
+			Real const l1 = t + std::sqrt(std::max(t * t - det, Real{0}));
+			values.push_back(sigma + l1);
+			values.push_back(sigma + (l1 > Real{0} ? det / l1 : Real{0}));
+			n -= 2;
+			continue;
+		}
+
+		if (iterations == 0) {
+			return false;
+		}
+		--iterations;
+
+		// dqds transform with a shift below the smallest eigenvalue, which keeps all qd values positive
+		for (std::size_t attempt = 0;; ++attempt) {
+			Real dd = q[0] - shift;
+			Real dmin = dd;
+			bool ok = dd >= Real{0};
+			for (std::size_t i = 0; ok && i + 1 < n; ++i) {
+				qh[i] = dd + ee[i];
+				if (!(qh[i] > Real{0})) {
+					ok = false;
+					break;
+				}
+				Real const t = q[i + 1] / qh[i];
+				eh[i] = ee[i] * t;
+				dd = dd * t - shift;
+				ok = dd >= Real{0};
+				dmin = std::min(dmin, dd);
+			}
+
+			if (ok) {
+				qh[n - 1] = dd;
+				std::copy_n(qh.begin(), n, q.begin());
+				std::copy_n(eh.begin(), n - 1, ee.begin());
+				sigma += shift;
+				shift = dmin;
+				break;
+			}
+
+			// shift was too large
+			shift = attempt < 2 ? shift / 4 : Real{0};
+		}
+
+		// small eigenvalues often converge in the interior first, so split off the trailing block at negligible ee
+		for (std::size_t i = n - 2; i-- > 0;) {
+			if (ee[i] <= tol2 * (sigma + std::min(q[i], q[i + 1]))) {
+				bool const converged = dqds(
+					std::vector<Real>(q.begin() + i + 1, q.begin() + n),
+					std::vector<Real>(ee.begin() + i + 1, ee.begin() + n),
+					sigma, values, max_iterations_per_value);
+				if (!converged) {
+					return false;
+				}
+				n = i + 1;
+				shift = Real{0};
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+/* namespace bidiagonal_svd_impl */ }
+
+/*
+ * Divide-and-conquer SVD of the n-by-n upper bidiagonal matrix with diagonal d and superdiagonal e [1]. B is split into
+ * two halves which are solved recursively as independent tasks of the thread pool, after which both solutions are
+ * merged by solving a secular equation and a matrix-matrix product.
+ *
+ * Ref.:
+ * [1] M. Gu and S. C. Eisenstat, "A Divide-and-Conquer Algorithm for the Bidiagonal SVD", SIAM Journal on Matrix
+ *     Analysis and Applications, 16(1), 1995.
+ */
+template<typename Real>
+bidiagonal_svd_result<Real>
+bidiagonal_svd_dc(std::vector<Real> d, std::vector<Real> e) {
+	using namespace bidiagonal_svd_impl;
+	std::size_t const n = d.size();
+	BOOST_ASSERT(n == 0 || e.size() + 1 == n);
+
+	// scale to avoid overflow and underflow
+	Real scale{0};
+	for (std::size_t i = 0; i < n; ++i) {
+		scale = std::max(scale, std::abs(d[i]));
+		if (i + 1 < n) {
+			scale = std::max(scale, std::abs(e[i]));
+		}
+	}
+	if (scale == Real{0}) {
+		return { std::vector<Real>(n, Real{0}), identity<Real>(n).data, identity<Real>(n).data };
+	}
+	for (auto & x : d) { x /= scale; }
+	for (auto & x : e) { x /= scale; }
+
+	dc_result<Real> r = divide_and_conquer(d.data(), e.data(), n, false);
+
+	for (auto & s : r.s) { s *= scale; }
+	return { std::move(r.s), std::move(r.u.data), std::move(r.w.data) };
+}
+
+/*
+ * Singular values of the n-by-n upper bidiagonal matrix with diagonal d and superdiagonal e computed with the
+ * differential qd algorithm with shifts [1], which computes all singular values to high relative accuracy in O(n^2).
+ * Matrices with a zero on the diagonal and matrices for which dqds does not converge within max_iterations_per_value * n
+ * iterations, like LAPACK's dlasq2 with info > 0, are handed over to bidiagonal_svd_dc().
+ *
+ * Ref.:
+ * [1] K. V. Fernando and B. N. Parlett, "Accurate singular values and differential qd algorithms", Numerische
+ *     Mathematik, 67(2), 1994.
+ */
+template<typename Real>
+std::vector<Real>
+bidiagonal_svd_dqds(
+	std::vector<Real> const& d, std::vector<Real> const& e, std::size_t max_iterations_per_value = 30
+) {
+	std::size_t const n = d.size();
+	BOOST_ASSERT(n == 0 || e.size() + 1 == n);
+	Real const eps = std::numeric_limits<Real>::epsilon();
+
+	Real scale{0};
+	for (std::size_t i = 0; i < n; ++i) {
+		if (d[i] == Real{0}) {
+			return bidiagonal_svd_dc(d, e).s;
+		}
+		scale = std::max(scale, std::abs(d[i]));
+		if (i + 1 < n) {
+			scale = std::max(scale, std::abs(e[i]));
+		}
+	}
+
+	std::vector<Real> values;
+	values.reserve(n);
+
+	// split into unreduced blocks
+	for (std::size_t begin = 0; begin < n;) {
+		std::size_t end = begin + 1;
+		while (end < n && std::abs(e[end - 1]) > eps * (std::abs(d[end - 1]) + std::abs(d[end]))) {
+			++end;
+		}
+
+		std::vector<Real> q(end - begin), ee(end - begin);
+		for (std::size_t i = begin; i < end; ++i) {
+			q[i - begin] = (d[i] / scale) * (d[i] / scale);
+			if (i + 1 < end) {
+				ee[i - begin] = (e[i] / scale) * (e[i] / scale);
+			}
+		}
+		if (!bidiagonal_svd_impl::dqds(std::move(q), std::move(ee), Real{0}, values, max_iterations_per_value)) {
+			return bidiagonal_svd_dc(d, e).s;
+		}
+		begin = end;
+	}
+
+	for (auto & v : values) {
+		v = std::sqrt(std::max(v, Real{0})) * scale;
+	}
+	std::sort(values.begin(), values.end(), [](Real a, Real b) { return a > b; });
+	return values;
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_BIDIAGONAL_SVD_IMPL_HPP
@@ -0,0 +1,131 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE bidiagonal_svd_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/bidiagonal_svd.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_SUITE(bidiagonal_svd_test)
+
+namespace {
+
+struct bidiagonal {
+	std::vector<double> d, e;
+};
+
+std::vector<bidiagonal>
+make_test_matrices() {
+	std::vector<bidiagonal> bs;
+	for (std::size_t n : { 1, 2, 3, 7, 64, 300 }) {
+		bidiagonal b;
+		for (std::size_t i = 0; i < n; ++i) {
+			b.d.push_back(std::sin(1. + 3. * i) + 1.5);
+			if (i + 1 < n) {
+				b.e.push_back(std::cos(2. + 5. * i));
+			}
+		}
+		bs.push_back(b);
+	}
+	
+	// identity, i.e. all singular values are equal
+	bs.push_back({ std::vector<double>(20, 1.), std::vector<double>(19, 0.) });
+	// graded matrix
+	bidiagonal graded;
+	for (std::size_t i = 0; i < 12; ++i) {
+		graded.d.push_back(std::pow(10., -double(i)));
+		if (i + 1 < 12) {
+			graded.e.push_back(std::pow(10., -double(i) - .5));
+		}
+	}
+	bs.push_back(graded);
+	// singular matrix
+	bs.push_back({ {2., 0., 3., 1.}, {1., 1., .5} });
+	return bs;
+}
+
+/* namespace */ }
+
+BOOST_AUTO_TEST_CASE(divide_and_conquer, * utf::tolerance(0.000000001)) {
+	using namespace hbrs::mpl;
+	
+	for (auto const& b : make_test_matrices()) {
+		std::size_t const n = b.d.size();
+		BOOST_TEST_MESSAGE("n=" << n);
+		auto const r = detail::bidiagonal_svd_dc(b.d, b.e);
+		BOOST_TEST_REQUIRE(r.s.size() == n);
+		BOOST_TEST_REQUIRE(r.u.size() == n * n);
+		BOOST_TEST_REQUIRE(r.v.size() == n * n);
+		BOOST_TEST(std::is_sorted(r.s.begin(), r.s.end(), std::greater<double>{}));
+		
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				double usv = 0., uu = 0., vv = 0.;
+				for (std::size_t l = 0; l < n; ++l) {
+					usv += r.u[i + l * n] * r.s[l] * r.v[j + l * n];
+					uu += r.u[l + i * n] * r.u[l + j * n];
+					vv += r.v[l + i * n] * r.v[l + j * n];
+				}
+				double const b_ij = (i == j) ? b.d[i] : (j == i + 1 ? b.e[i] : 0.);
+				BOOST_TEST(usv + 1. == b_ij + 1.);
+				BOOST_TEST(uu == (i == j ? 1. : 0.));
+				BOOST_TEST(vv == (i == j ? 1. : 0.));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(dqds, * utf::tolerance(0.000000001)) {
+	using namespace hbrs::mpl;
+	
+	for (auto const& b : make_test_matrices()) {
+		BOOST_TEST_MESSAGE("n=" << b.d.size());
+		auto const s = detail::bidiagonal_svd_dqds(b.d, b.e);
+		auto const r = detail::bidiagonal_svd_dc(b.d, b.e);
+		BOOST_TEST_REQUIRE(s.size() == r.s.size());
+		for (std::size_t i = 0; i < s.size(); ++i) {
+			BOOST_TEST(s[i] + 1. == r.s[i] + 1.);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(dqds_not_converged, * utf::tolerance(0.000000001)) {
+	using namespace hbrs::mpl;
+	
+	// without iterations dqds cannot converge, hence the singular values are computed by divide and conquer
+	for (auto const& b : make_test_matrices()) {
+		BOOST_TEST_MESSAGE("n=" << b.d.size());
+		auto const s = detail::bidiagonal_svd_dqds(b.d, b.e, 0);
+		auto const r = detail::bidiagonal_svd_dc(b.d, b.e);
+		BOOST_TEST_REQUIRE(s.size() == r.s.size());
+		for (std::size_t i = 0; i < s.size(); ++i) {
+			BOOST_TEST(s[i] + 1. == r.s[i] + 1.);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
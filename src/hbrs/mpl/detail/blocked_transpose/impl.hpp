@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HBRS_MPL_DETAIL_BLOCKED_TRANSPOSE_IMPL_HPP
+#define HBRS_MPL_DETAIL_BLOCKED_TRANSPOSE_IMPL_HPP
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/detail/thread_pool.hpp>
+#include <cstddef>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/* Number of rows and columns of a block which is transposed directly, i.e. without further recursion.
+ * A 32x32 block of doubles (8KiB) fits into the L1 cache of all x86-64 cpus together with its transpose.
+ */
+constexpr std::size_t blocked_transpose_leaf_size = 32;
+
+/* Blocks with fewer elements are transposed on the calling thread instead of splitting them into two parallel tasks */
+constexpr std::size_t blocked_transpose_task_size = 256 * 256;
+
+/*
+ * Cache-oblivious out-of-place transpose [1, Chapter 3.3]
+ * Writes the transpose of the rows-by-cols block src, which is stored row by row with leading dimension src_ld, to the
+ * cols-by-rows block dst, which is stored row by row with leading dimension dst_ld. The larger dimension is halved
+ * recursively until a block fits into the cache, so that both src and dst are accessed in cache-friendly order
+ * without knowing the cache sizes.
+ *
+ * Both halves of large blocks are transposed in parallel by the thread pool, because they do not overlap in src or dst.
+ *
+ * A column-major matrix is a row-major matrix with rows and columns swapped, hence this function can be used to change
+ * the storage order of a matrix, too.
+ *
+ * Ref.:
+ * [1] Frigo, Leiserson, Prokop and Ramachandran. Cache-Oblivious Algorithms. FOCS 1999.
+ */
+template<typename From, typename To>
+void
+blocked_transpose(
+	From const* src, std::size_t src_ld,
+	To * dst, std::size_t dst_ld,
+	std::size_t rows, std::size_t cols
+) {
+	if (rows <= blocked_transpose_leaf_size && cols <= blocked_transpose_leaf_size) {
+		for (std::size_t i = 0; i < rows; ++i) {
+			for (std::size_t j = 0; j < cols; ++j) {
+				dst[j * dst_ld + i] = src[i * src_ld + j];
+			}
+		}
+	} else if (rows >= cols) {
+		std::size_t const half = rows / 2;
+		auto const first  = [=]() { blocked_transpose(src,                 src_ld, dst,        dst_ld, half,        cols); };
+		auto const second = [=]() { blocked_transpose(src + half * src_ld, src_ld, dst + half, dst_ld, rows - half, cols); };
+		if (rows * cols >= blocked_transpose_task_size) {
+			parallel_invoke(first, second);
+		} else {
+			first();
+			second();
+		}
+	} else {
+		std::size_t const half = cols / 2;
+		auto const first  = [=]() { blocked_transpose(src,        src_ld, dst,                 dst_ld, rows, half       ); };
+		auto const second = [=]() { blocked_transpose(src + half, src_ld, dst + half * dst_ld, dst_ld, rows, cols - half); };
+		if (rows * cols >= blocked_transpose_task_size) {
+			parallel_invoke(first, second);
+		} else {
+			first();
+			second();
+		}
+	}
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_BLOCKED_TRANSPOSE_IMPL_HPP
@@ -19,6 +19,7 @@
 
 #include <hbrs/mpl/config.hpp>
 #include <hbrs/mpl/dt/storage_order.hpp>
+#include <hbrs/mpl/dt/rtsam/fwd.hpp>
 #include <initializer_list>
 
 HBRS_MPL_NAMESPACE_BEGIN
@@ -32,6 +33,10 @@ template <typename From, typename To>
 constexpr decltype(auto)
 copy_matrix(From const& from, To & to);
 
+template <typename Ring, storage_order FromOrder, storage_order ToOrder>
+decltype(auto)
+copy_matrix(rtsam<Ring, FromOrder> const& from, rtsam<Ring, ToOrder> & to);
+
 template <typename From, storage_order Order, typename To>
 constexpr decltype(auto)
 copy_matrix(std::initializer_list<From> from, storage_order_<Order>, To && to);
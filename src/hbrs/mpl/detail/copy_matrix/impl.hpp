@@ -21,6 +21,7 @@
 
 #include <hbrs/mpl/core/preprocessor.hpp>
 #include <hbrs/mpl/detail/translate_index.hpp>
+#include <hbrs/mpl/detail/thread_pool.hpp>
 
 #include <hbrs/mpl/fn/at.hpp>
 #include <hbrs/mpl/fn/m.hpp>
@@ -35,6 +36,7 @@
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/assert.hpp>
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 
@@ -119,6 +121,33 @@ copy_matrix(From const& from, To & to) {
 	return copy_matrix_impl(from, to);
 }
 
+/* Dense matrices are copied as a whole instead of element by element, i.e. with std::copy on chunks of the buffer in
+ * parallel if storage orders match and with a cache-oblivious blocked transpose of the underlying buffer otherwise.
+ */
+template <typename Ring, storage_order FromOrder, storage_order ToOrder>
+decltype(auto)
+copy_matrix(rtsam<Ring, FromOrder> const& from, rtsam<Ring, ToOrder> & to) {
+	if (from.size() != to.size()) {
+		BOOST_THROW_EXCEPTION((
+			incompatible_matrices_exception{}
+			<< errinfo_matrix_sizes{{from.size(), to.size()}}
+		));
+	}
+	
+	if constexpr (FromOrder == ToOrder) {
+		Ring const* src = from.data().data();
+		Ring * dst = to.data().data();
+		std::size_t const length = from.data().size();
+		parallel_for(0, length, grain_size(length, 1), [src, dst](std::size_t first, std::size_t last) {
+			std::copy(src + first, src + last, dst + first);
+		});
+	} else {
+		to = from;
+	}
+	
+	return to;
+}
+
 template <
 	typename From,
 	storage_order Order,
@@ -19,27 +19,39 @@
 #include <hbrs/mpl/core/preprocessor.hpp>
 #include <hbrs/mpl/dt/exception.hpp>
 #include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/thread_pool.hpp>
+#include <hbrs/mpl/detail/validation.hpp>
 #include <boost/assert.hpp>
 #include <boost/throw_exception.hpp>
 #include <algorithm>
 #include <iostream>
+#include <vector>
 
 #ifdef HBRS_MPL_ENABLE_ELEMENTAL
 	#include <El.hpp>
 #endif
 
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+#if defined(_OPENMP) && defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
 #include <mpi.h>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace detail {
 
 struct mpi_environment {
-	mpi_environment() {
-		setup(nullptr, nullptr);
+	mpi_environment(mpi_thread_level level) {
+		setup(nullptr, nullptr, level);
 	}
 	
-	mpi_environment(int & argc, char** &argv) {
-		setup(&argc, &argv);
+	mpi_environment(int & argc, char** &argv, mpi_thread_level level) {
+		setup(&argc, &argv, level);
 	}
 	
 	~mpi_environment() {
@@ -53,7 +65,7 @@ struct mpi_environment {
 	}
 	
 	void
-	setup(int * argc, char*** argv) {
+	setup(int * argc, char*** argv, mpi_thread_level level) {
 		++initialize_count;
 		
 		if (initialize_count > 1) {
@@ -62,19 +74,19 @@ struct mpi_environment {
 		
 		do_initialize = !detail::mpi::initialized();
 		if (!do_initialize) {
+			// MPI has been initialized by someone else, e.g. the application
+			int provided_;
+			MPI_Query_thread(&provided_);
+			provided = static_cast<mpi_thread_level>(provided_);
 			return;
 		}
 		
-		#if defined(HBRS_MPL_ENABLE_ELEMENTAL) && defined(EL_HYBRID)
-			/* Ref.:
-			 *  https://github.com/elemental/Elemental/blob/master/src/core/environment.cpp#L150
-			 *  https://github.com/elemental/Elemental/blob/master/src/core/imports/mpi.cpp#L69
-			 */
-			int provided;
-			int ec = MPI_Init_thread(argc, argv, MPI_THREAD_MULTIPLE, &provided);
-		#else
-			int ec = MPI_Init(argc, argv);
-		#endif
+		/* Ref.:
+		 *  https://github.com/elemental/Elemental/blob/master/src/core/environment.cpp#L150
+		 *  https://github.com/elemental/Elemental/blob/master/src/core/imports/mpi.cpp#L69
+		 */
+		int provided_;
+		int ec = MPI_Init_thread(argc, argv, static_cast<int>(level), &provided_);
 		
 		if (ec != MPI_SUCCESS) {
 			BOOST_THROW_EXCEPTION((
@@ -82,8 +94,12 @@ struct mpi_environment {
 				<< errinfo_mpi_error_info{mpi_error_info{ec}}
 			));
 		}
+		
+		provided = static_cast<mpi_thread_level>(provided_);
 	}
 	
+	static mpi_thread_level provided;
+	
 private:
 	static int initialize_count;
 	static bool do_initialize;
@@ -91,23 +107,118 @@ private:
 
 int mpi_environment::initialize_count = 0;
 bool mpi_environment::do_initialize = false;
+mpi_thread_level mpi_environment::provided = mpi_thread_level::single;
+
+static void
+setup_threads(execution_control const& ctrl) {
+	/* the native kernels do not use OpenMP but the thread pool, which shares the limit of threads per rank */
+	if (ctrl.threads_per_rank() > 0) {
+		set_concurrency(ctrl.threads_per_rank());
+	}
+	
+#ifdef _OPENMP
+	if (ctrl.threads_per_rank() > 0) {
+		omp_set_num_threads(ctrl.threads_per_rank());
+	}
+	
+	if (ctrl.binding() == thread_binding::none) {
+		return;
+	}
+	
+	#ifdef __linux__
+		/* OMP_PROC_BIND is read once when the OpenMP runtime is loaded (e.g. by libgomp), so it cannot be changed from
+		 * here. Instead each thread of the (persistent) OpenMP thread pool pins itself to one of the cpus that this rank
+		 * is allowed to run on, e.g. the cores of a socket with mpirun --bind-to socket. Memory which is first touched by
+		 * a thread is then placed on the NUMA node of its cpu and stays there.
+		 */
+		cpu_set_t allowed;
+		CPU_ZERO(&allowed);
+		if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+			return;
+		}
+		
+		std::vector<int> cpus;
+		for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+			if (CPU_ISSET(cpu, &allowed)) {
+				cpus.push_back(cpu);
+			}
+		}
+		
+		if (cpus.empty()) {
+			return;
+		}
+		
+		#pragma omp parallel
+		{
+			std::size_t const thread = omp_get_thread_num();
+			std::size_t const threads = omp_get_num_threads();
+			std::size_t const idx = ctrl.binding() == thread_binding::close
+				? thread % cpus.size()
+				: (thread * cpus.size() / threads) % cpus.size();
+			
+			cpu_set_t cpu;
+			CPU_ZERO(&cpu);
+			CPU_SET(cpus[idx], &cpu);
+			pthread_setaffinity_np(pthread_self(), sizeof(cpu), &cpu);
+		}
+	#endif
+#endif
+}
+
+/* Checks of distributed matrices are collective (see all_finite()), so whether they run must not differ between ranks.
+ * The validation level might differ though, e.g. if HBRS_MPL_VALIDATION is set for some ranks only, hence all ranks
+ * adopt the level of rank 0.
+ */
+static void
+setup_validation() {
+	int level = static_cast<int>(get_validation_level());
+	MPI_Request request = mpi::ibcast(&level, 1, 0, MPI_COMM_WORLD);
+	mpi::wait(request);
+	set_validation_level(static_cast<validation_level>(level));
+}
+
+execution_control::execution_control()
+: threads_per_rank_{0}, binding_{thread_binding::none},
+#if defined(HBRS_MPL_ENABLE_ELEMENTAL) && defined(EL_HYBRID)
+	thread_level_{mpi_thread_level::multiple}
+#else
+	thread_level_{mpi_thread_level::single}
+#endif
+{}
+
+execution_control::execution_control(int threads_per_rank, thread_binding binding, mpi_thread_level thread_level)
+: threads_per_rank_{threads_per_rank}, binding_{binding}, thread_level_{thread_level} {
+	BOOST_ASSERT(threads_per_rank >= 0);
+}
 
 struct environment::pimpl {
-	pimpl()
-		: mpi_{}
+	pimpl(execution_control const& ctrl)
+		: ctrl_{ctrl}
+		, mpi_{ctrl.thread_level()}
 	#ifdef HBRS_MPL_ENABLE_ELEMENTAL
 		, elemental_{}
 	#endif
-	{};
+	{
+		setup_threads(ctrl_);
+		setup_validation();
+	};
 	
-	pimpl(int & argc, char ** &argv)
-		: mpi_{argc, argv}
+	pimpl(int & argc, char ** &argv, execution_control const& ctrl)
+		: ctrl_{ctrl}
+		, mpi_{argc, argv, ctrl.thread_level()}
 	#ifdef HBRS_MPL_ENABLE_ELEMENTAL
 		, elemental_{argc, argv}
 	#endif
-	{}
+	{
+		setup_threads(ctrl_);
+		setup_validation();
+	}
+	
+	execution_control const&
+	control() const { return ctrl_; }
 	
 private:
+	execution_control ctrl_;
 	mpi_environment mpi_;
 #ifdef HBRS_MPL_ENABLE_ELEMENTAL
 	El::Environment elemental_;
@@ -115,10 +226,16 @@ private:
 };
 
 environment::environment()
-: m{std::make_unique<pimpl>()} {}
+: m{std::make_unique<pimpl>(execution_control{})} {}
 
 environment::environment(int & argc, char ** &argv)
-: m{std::make_unique<pimpl>(argc, argv)} {}
+: m{std::make_unique<pimpl>(argc, argv, execution_control{})} {}
+
+environment::environment(execution_control const& ctrl)
+: m{std::make_unique<pimpl>(ctrl)} {}
+
+environment::environment(int & argc, char ** &argv, execution_control const& ctrl)
+: m{std::make_unique<pimpl>(argc, argv, ctrl)} {}
 
 environment::~environment() {}
 
@@ -126,7 +243,7 @@ environment::environment(environment const& other)
 : m{std::make_unique<pimpl>(*other.m)} {}
 
 environment::environment(environment&& other)
-: m{std::make_unique<pimpl>()}
+: m{std::make_unique<pimpl>(execution_control{})}
 	/* it's also possible to initialize m with m{}, but then
 	 * the following code will crash:
 	 *  environment a;
@@ -144,6 +261,25 @@ environment & environment::operator=(environment other) {
 	return *this;
 }
 
+execution_control const&
+environment::control() const {
+	return m->control();
+}
+
+mpi_thread_level
+environment::provided_thread_level() const {
+	return mpi_environment::provided;
+}
+
+int
+environment::threads_per_rank() const {
+#ifdef _OPENMP
+	return omp_get_max_threads();
+#else
+	return static_cast<int>(concurrency());
+#endif
+}
+
 void environment::swap(environment& other) {
 	using std::swap;
 	swap(this->m, other.m);
@@ -25,10 +25,66 @@
 HBRS_MPL_NAMESPACE_BEGIN
 namespace detail {
 
+/* Level of thread support requested from MPI, see MPI_Init_thread() */
+enum class mpi_thread_level {
+	single = MPI_THREAD_SINGLE,
+	funneled = MPI_THREAD_FUNNELED,
+	serialized = MPI_THREAD_SERIALIZED,
+	multiple = MPI_THREAD_MULTIPLE
+};
+
+/* Pinning of the OpenMP threads of each rank to the cpus the rank may run on, similar to OMP_PROC_BIND */
+enum class thread_binding {
+	none /* leave pinning to the OpenMP runtime, e.g. OMP_PROC_BIND and OMP_PLACES */,
+	close /* thread i is pinned to the i-th cpu */,
+	spread /* threads are pinned to cpus evenly spaced across all cpus of the rank */
+};
+
+/*
+ * Execution model of a rank, i.e. the number of OpenMP threads per MPI rank, their pinning and the MPI thread level.
+ * The default keeps the OpenMP runtime's settings and requests MPI_THREAD_MULTIPLE if Elemental has been built with
+ * EL_HYBRID and MPI_THREAD_SINGLE else, like environment did before.
+ *
+ * For hybrid deployments with one rank per socket (or NUMA node), start the ranks with e.g. mpirun --map-by socket
+ * --bind-to socket, set threads_per_rank to the number of cores per socket and use thread_binding::close.
+ */
+struct HBRS_MPL_API execution_control {
+	execution_control();
+	execution_control(int threads_per_rank, thread_binding binding, mpi_thread_level thread_level);
+	
+	/* number of OpenMP threads and of thread pool threads per rank, 0 keeps the defaults, e.g. OMP_NUM_THREADS */
+	int
+	threads_per_rank() const { return threads_per_rank_; }
+	
+	thread_binding
+	binding() const { return binding_; }
+	
+	mpi_thread_level
+	thread_level() const { return thread_level_; }
+	
+private:
+	int threads_per_rank_;
+	thread_binding binding_;
+	mpi_thread_level thread_level_;
+};
+
 struct HBRS_MPL_API environment {
 	environment();
 	environment(int & argc, char ** &argv);
+	explicit environment(execution_control const& ctrl);
+	environment(int & argc, char ** &argv, execution_control const& ctrl);
 	virtual ~environment();
+	
+	execution_control const&
+	control() const;
+	
+	/* Level of thread support provided by MPI, which might be lower than the requested level */
+	mpi_thread_level
+	provided_thread_level() const;
+	
+	/* Number of OpenMP threads each rank uses in parallel regions, the thread pool size if OpenMP is not available */
+	int
+	threads_per_rank() const;
 
 	environment(environment const& other);
 	environment & operator=(environment other);
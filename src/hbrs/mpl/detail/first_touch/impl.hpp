@@ -0,0 +1,72 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DETAIL_FIRST_TOUCH_IMPL_HPP
+#define HBRS_MPL_DETAIL_FIRST_TOUCH_IMPL_HPP
+
+#include <hbrs/mpl/config.hpp>
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+#include <El.hpp>
+#include <algorithm>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/* Matrices with less entries are zeroed by the calling thread only, because spawning threads would take longer */
+constexpr El::Int first_touch_min_size = 1 << 15;
+
+/*
+ * Zeros the entries of a freshly allocated local matrix in parallel.
+ *
+ * Operating systems like Linux place a memory page on the NUMA node of the thread which writes to it first. El::Zero()
+ * writes all entries from the calling thread, so a large matrix would end up on a single memory node and threads on
+ * other sockets would access it remotely afterwards. Instead, the columns are distributed to threads in the same way
+ * (static schedule over columns) as the EL_PARALLEL_FOR loops in e.g. times() or pca() do, so that each thread later
+ * finds its columns in local memory. Requires threads which are pinned to cpus, see execution_control.
+ */
+template<typename Ring>
+void
+first_touch_zero(El::Matrix<Ring> & a) {
+	El::Int const a_m = a.Height();
+	El::Int const a_n = a.Width();
+	
+	if (a_m * a_n < first_touch_min_size || a_n < 2) {
+		El::Zero(a);
+		return;
+	}
+	
+	El::Int const a_ldim = a.LDim();
+	Ring * a_buf = a.Buffer();
+	
+	EL_PARALLEL_FOR
+	for (El::Int j = 0; j < a_n; ++j) {
+		std::fill_n(a_buf + j * a_ldim, a_m, Ring(0));
+	}
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+void
+first_touch_zero(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> & a) {
+	first_touch_zero(a.Matrix());
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+#endif // !HBRS_MPL_DETAIL_FIRST_TOUCH_IMPL_HPP
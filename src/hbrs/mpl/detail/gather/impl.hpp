@@ -43,6 +43,8 @@
 #include <hbrs/mpl/dt/srv.hpp>
 #include <boost/hana/ext/std/array.hpp>
 #include <boost/hana/ext/std/vector.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
 #include <type_traits>
 
 HBRS_MPL_NAMESPACE_BEGIN
@@ -79,25 +81,99 @@ gather(T && t) {
 }
 
 #ifdef HBRS_MPL_ENABLE_ELEMENTAL
-	#define _DEF_GATHER_DIST(kind)                                                                                     \
+	/* Gathers a distributed matrix or vector at process root. Only process root receives the full matrix, all other
+	 * processes get an empty placeholder (0x0 for matrices, 0x1 for column and 1x0 for row vectors), so that memory is
+	 * not wasted on p full-sized copies.
+	 */
+	#define _DEF_GATHER_DIST(kind, empty_m, empty_n)                                                                   \
 		template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>                         \
 		constexpr auto                                                                                                 \
-		gather(el_dist_ ## kind<Ring, Columnwise, Rowwise, Wrapping> const& t) {                                       \
+		gather(el_dist_ ## kind<Ring, Columnwise, Rowwise, Wrapping> const& t, int root = 0) {                         \
 			typedef std::decay_t<Ring> _Ring_;                                                                         \
-			El::DistMatrix<_Ring_, El::CIRC, El::CIRC, Wrapping> dmat{t.data()};                                       \
+			El::DistMatrix<_Ring_, El::CIRC, El::CIRC, Wrapping> dmat{t.data().Grid(), root};                          \
+			dmat = t.data();                                                                                           \
 			                                                                                                           \
-			if (dmat.Grid().Rank() == 0) {                                                                             \
-				return make_el_ ## kind(dmat.Matrix());                                                                \
+			if (dmat.CrossRank() == dmat.Root()) {                                                                     \
+				return make_el_ ## kind(std::move(dmat.Matrix()));                                                     \
 			} else {                                                                                                   \
-				return make_el_ ## kind(El::Matrix<_Ring_>{dmat.Height(), dmat.Width()});                              \
+				return make_el_ ## kind(El::Matrix<_Ring_>{empty_m, empty_n});                                         \
 			}                                                                                                          \
 		}
 	
-	_DEF_GATHER_DIST(column_vector)
-	_DEF_GATHER_DIST(row_vector)
-	_DEF_GATHER_DIST(matrix)
+	_DEF_GATHER_DIST(column_vector, 0, 1)
+	_DEF_GATHER_DIST(row_vector, 1, 0)
+	_DEF_GATHER_DIST(matrix, 0, 0)
 	
 	#undef _DEF_GATHER_DIST
+	
+	/* Streams a distributed matrix to process root in panels of at most panel_size columns (rows if by_rows is true).
+	 * For each panel, sink(offset, panel) is called on process root only, where offset is the index of the first
+	 * column (row) of the panel and panel is a El::Matrix<Ring> const&. Memory on process root is hence bounded by
+	 * panel_size*m (panel_size*n) elements instead of m*n elements. Must be called by all processes of the grid.
+	 */
+	template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Sink>
+	void
+	collect_panels(
+		El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+		bool by_rows,
+		El::Int panel_size,
+		int root,
+		Sink && sink
+	) {
+		BOOST_ASSERT(panel_size > 0);
+		
+		El::Int const length = by_rows ? a.Height() : a.Width();
+		El::DistMatrix<Ring, El::CIRC, El::CIRC, Wrapping> panel{a.Grid(), root};
+		
+		for (El::Int offset = 0; offset < length; offset += panel_size) {
+			El::Int const end = std::min(offset + panel_size, length);
+			
+			if (by_rows) {
+				panel = a(El::IR(offset, end), El::ALL);
+			} else {
+				panel = a(El::ALL, El::IR(offset, end));
+			}
+			
+			if (panel.CrossRank() == panel.Root()) {
+				sink(offset, panel.LockedMatrix());
+			}
+		}
+	}
+	
+	/* Collects a distributed matrix (row vector) at process root in panels of panel_size columns, see collect_panels */
+	template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Sink>
+	void
+	collect(
+		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& t,
+		El::Int panel_size,
+		Sink && sink,
+		int root = 0
+	) {
+		collect_panels(t.data(), false, panel_size, root, HBRS_MPL_FWD(sink));
+	}
+	
+	template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Sink>
+	void
+	collect(
+		el_dist_row_vector<Ring, Columnwise, Rowwise, Wrapping> const& t,
+		El::Int panel_size,
+		Sink && sink,
+		int root = 0
+	) {
+		collect_panels(t.data(), false, panel_size, root, HBRS_MPL_FWD(sink));
+	}
+	
+	/* Collects a distributed column vector at process root in panels of panel_size rows, see collect_panels */
+	template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Sink>
+	void
+	collect(
+		el_dist_column_vector<Ring, Columnwise, Rowwise, Wrapping> const& t,
+		El::Int panel_size,
+		Sink && sink,
+		int root = 0
+	) {
+		collect_panels(t.data(), true, panel_size, root, HBRS_MPL_FWD(sink));
+	}
 #endif
 
 /* namespace detail */ }
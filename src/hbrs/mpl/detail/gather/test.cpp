@@ -0,0 +1,149 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE gather_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/gather.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/test.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_vector.hpp>
+#include <El.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(gather_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+static double
+entry(El::Int i, El::Int j) {
+	return 1000. * i + j;
+}
+
+BOOST_AUTO_TEST_CASE(collect_matrix_panels) {
+	using namespace hbrs::mpl;
+	namespace mpi = hbrs::mpl::detail::mpi;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	int const root = mpi::comm_size() - 1;
+	
+	// 11 columns in panels of 3 columns leave a smaller last panel
+	static constexpr El::Int m_ = 7, n_ = 11, panel_size = 3;
+	el_dist_matrix<double> a{grid, m_, n_};
+	for (El::Int j = 0; j < a.data().LocalWidth(); ++j) {
+		for (El::Int i = 0; i < a.data().LocalHeight(); ++i) {
+			a.data().SetLocal(i, j, entry(a.data().GlobalRow(i), a.data().GlobalCol(j)));
+		}
+	}
+	
+	std::vector<El::Int> offsets;
+	El::Matrix<double> collected{m_, n_};
+	El::Zero(collected);
+	detail::collect(a, panel_size, [&](El::Int offset, El::Matrix<double> const& panel) {
+		BOOST_TEST(panel.Height() == m_);
+		BOOST_TEST(panel.Width() == std::min(panel_size, n_ - offset));
+		offsets.push_back(offset);
+		auto block = collected(El::ALL, El::IR(offset, offset + panel.Width()));
+		El::Copy(panel, block);
+	}, root);
+	
+	if (mpi::comm_rank() == root) {
+		BOOST_TEST(offsets == (std::vector<El::Int>{0, 3, 6, 9}));
+		for (El::Int i = 0; i < m_; ++i) {
+			for (El::Int j = 0; j < n_; ++j) {
+				BOOST_TEST(collected.Get(i, j) == entry(i, j));
+			}
+		}
+	} else {
+		// the sink is called on process root only
+		BOOST_TEST(offsets.empty());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(collect_column_vector_panels) {
+	using namespace hbrs::mpl;
+	namespace mpi = hbrs::mpl::detail::mpi;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	int const root = mpi::comm_size() - 1;
+	
+	// column vectors are collected in panels of rows
+	static constexpr El::Int m_ = 10, panel_size = 4;
+	el_dist_column_vector<double> v{grid, m_};
+	for (El::Int i = 0; i < v.data().LocalHeight(); ++i) {
+		for (El::Int j = 0; j < v.data().LocalWidth(); ++j) {
+			v.data().SetLocal(i, j, entry(v.data().GlobalRow(i), 0));
+		}
+	}
+	
+	std::vector<double> collected;
+	detail::collect(v, panel_size, [&](El::Int offset, El::Matrix<double> const& panel) {
+		BOOST_TEST(panel.Width() == 1);
+		BOOST_TEST(offset == (El::Int)collected.size());
+		for (El::Int i = 0; i < panel.Height(); ++i) {
+			collected.push_back(panel.Get(i, 0));
+		}
+	}, root);
+	
+	if (mpi::comm_rank() == root) {
+		BOOST_TEST(collected.size() == (std::size_t)m_);
+		for (El::Int i = 0; i < (El::Int)collected.size(); ++i) {
+			BOOST_TEST(collected[i] == entry(i, 0));
+		}
+	} else {
+		BOOST_TEST(collected.empty());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(gather_vectors) {
+	using namespace hbrs::mpl;
+	namespace mpi = hbrs::mpl::detail::mpi;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	int const root = mpi::comm_size() - 1;
+	
+	static constexpr El::Int length = 9;
+	el_dist_column_vector<double> c{grid, length};
+	el_dist_row_vector<double> r{grid, length};
+	for (El::Int i = 0; i < length; ++i) {
+		c.data().Set(i, 0, entry(i, 0));
+		r.data().Set(0, i, entry(0, i));
+	}
+	
+	// processes other than root get empty vectors which are still column and row vectors respectively
+	auto c_ = detail::gather(c, root);
+	auto r_ = detail::gather(r, root);
+	BOOST_TEST(c_.data().Width() == 1);
+	BOOST_TEST(r_.data().Height() == 1);
+	
+	if (mpi::comm_rank() == root) {
+		BOOST_TEST(c_.length() == length);
+		BOOST_TEST(r_.length() == length);
+		for (El::Int i = 0; i < length; ++i) {
+			BOOST_TEST(c_.at(i) == entry(i, 0));
+			BOOST_TEST(r_.at(i) == entry(0, i));
+		}
+	} else {
+		BOOST_TEST(c_.length() == 0);
+		BOOST_TEST(r_.length() == 0);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "impl.hpp"
+
+#include <hbrs/mpl/detail/shared_matrix.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+namespace mpi {
+
+HBRS_MPL_API
+bool
+is_hierarchical(MPI_Comm comm) {
+	node_communicators const& comms = split_by_node(comm);
+	return comms.nodes > 1 && comms.nodes < comm_size(comm);
+}
+
+HBRS_MPL_API
+bool
+prefers_hierarchical_allreduce(std::size_t bytes, MPI_Comm comm) {
+	return bytes >= hierarchical_allreduce_min_bytes && is_hierarchical(comm);
+}
+
+static int
+free_shared_window(MPI_Comm, int, void *attribute, void *) {
+	delete static_cast<shared_window *>(attribute);
+	return MPI_SUCCESS;
+}
+
+/* Returns shared memory of at least bytes bytes for the ranks of comms.node, which is cached as attribute of the node
+ * communicator and replaced by a larger one if required. Collective over comms.node.
+ */
+static shared_window &
+scratch_window(node_communicators const& comms, std::size_t bytes) {
+	static int const keyval = []() {
+		int keyval;
+		int const ec = MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &free_shared_window, &keyval, nullptr);
+		BOOST_VERIFY(ec == MPI_SUCCESS);
+		return keyval;
+	}();
+	
+	void * attribute;
+	int found;
+	BOOST_VERIFY(MPI_Comm_get_attr(comms.node, keyval, &attribute, &found) == MPI_SUCCESS);
+	if (found && static_cast<shared_window *>(attribute)->size() >= bytes) {
+		return *static_cast<shared_window *>(attribute);
+	}
+	
+	// all ranks of the node ask for the same size, hence they agree on replacing the window
+	auto * window = new shared_window{comms, bytes};
+	// frees the previous window, if any
+	BOOST_VERIFY(MPI_Comm_set_attr(comms.node, keyval, window) == MPI_SUCCESS);
+	return *window;
+}
+
+HBRS_MPL_API
+void
+hierarchical_allreduce(
+	void const* sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm
+) {
+	if (!prefers_hierarchical_allreduce(count * type_extent(datatype), comm)) {
+		allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+		return;
+	}
+	hierarchical_allreduce(sendbuf, recvbuf, count, datatype, op, split_by_node(comm));
+}
+
+HBRS_MPL_API
+void
+hierarchical_allreduce(
+	void const* sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op,
+	node_communicators const& comms
+) {
+	BOOST_ASSERT(initialized());
+	int const node_rank = comm_rank(comms.node);
+	int const node_size = comm_size(comms.node);
+	std::size_t const extent = type_extent(datatype);
+	std::size_t const bytes = count * extent;
+	
+	// layout: [ buffer of node rank 0 | ... | buffer of node rank node_size-1 | result ]
+	shared_window & window = scratch_window(comms, bytes * (node_size + 1));
+	char * slots = static_cast<char *>(window.data());
+	char * result = slots + bytes * node_size;
+	
+	std::memcpy(slots + bytes * node_rank, sendbuf == MPI_IN_PLACE ? recvbuf : sendbuf, bytes);
+	window.synchronize();
+	
+	// each rank reduces a slice of all elements over the buffers of all ranks of its node
+	std::size_t const first = count * node_rank / node_size;
+	std::size_t const last = count * (node_rank + 1) / node_size;
+	std::size_t const offset = first * extent;
+	if (last > first) {
+		std::memcpy(result + offset, slots + offset, (last - first) * extent);
+		for(int r = 1; r < node_size; ++r) {
+			reduce_local(slots + bytes * r + offset, result + offset, last - first, datatype, op);
+		}
+	}
+	window.synchronize();
+	
+	if (comms.leaders != MPI_COMM_NULL) {
+		allreduce(MPI_IN_PLACE, result, count, datatype, op, comms.leaders);
+	}
+	window.synchronize();
+	
+	// no barrier afterwards, because the next call writes to result only after its first synchronize()
+	std::memcpy(recvbuf, result, bytes);
+}
+
+/* namespace mpi */ }
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
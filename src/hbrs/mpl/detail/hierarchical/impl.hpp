@@ -0,0 +1,90 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef HBRS_MPL_DETAIL_HIERARCHICAL_IMPL_HPP
+#define HBRS_MPL_DETAIL_HIERARCHICAL_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <mpi.h>
+#include <cstddef>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+namespace detail {
+namespace mpi {
+
+/* True if comm spans several nodes and at least one node runs several ranks of comm, i.e. if hierarchical collectives
+ * send fewer inter-node messages than flat ones.
+ */
+HBRS_MPL_API
+bool
+is_hierarchical(MPI_Comm comm);
+
+/*
+ * Reductions of fewer bytes are latency-bound and the node barriers of hierarchical_allreduce() cost more than the
+ * messages they save, e.g. for flags which are combined with MPI_LOR.
+ */
+constexpr std::size_t hierarchical_allreduce_min_bytes = 8192;
+
+/* True if hierarchical_allreduce() on comm uses the hierarchical algorithm for bytes bytes, i.e. if comm is
+ * hierarchical and bytes is at least hierarchical_allreduce_min_bytes. Collective over comm.
+ */
+HBRS_MPL_API
+bool
+prefers_hierarchical_allreduce(std::size_t bytes, MPI_Comm comm);
+
+/*
+ * Allreduce in three stages: The ranks of each node reduce their buffers through shared memory, each rank a slice of
+ * the elements. Then only the node leaders run an allreduce over the network and finally all ranks copy the result from
+ * shared memory. Hence each node sends one message per inter-node step instead of one per rank.
+ *
+ * The shared memory is cached on the node communicator and reused by later calls. If comm is not hierarchical or the
+ * buffers are small, see prefers_hierarchical_allreduce(), then this is a plain allreduce. op has to be commutative, like MPI's builtin operations and those
+ * from op().
+ */
+HBRS_MPL_API
+void
+hierarchical_allreduce(
+	void const* sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+
+/* Same as above but with an explicit split of comm into nodes and node leaders, e.g. from split_by_node(), and
+ * without a fallback to a plain allreduce
+ */
+HBRS_MPL_API
+void
+hierarchical_allreduce(
+	void const* sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op,
+	node_communicators const& comms);
+
+template<typename T, typename Count>
+void
+hierarchical_allreduce(T const* sendbuf, T* recvbuf, Count count, MPI_Op op, MPI_Comm comm) {
+	return hierarchical_allreduce(
+		sendbuf, recvbuf, boost::numeric_cast<std::size_t>(count), datatype(hana::type_c<T>), op, comm);
+}
+
+/* namespace mpi */ }
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_HIERARCHICAL_IMPL_HPP
@@ -0,0 +1,107 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE hierarchical_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/hierarchical.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/test.hpp>
+#include <boost/hana/type.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(hierarchical_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+namespace hana = boost::hana;
+
+/* Pretends that pairs of consecutive ranks run on separate nodes, so that the hierarchical code path is taken even if
+ * all ranks run on a single node.
+ */
+static hbrs::mpl::detail::mpi::node_communicators
+split_into_pairs() {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	
+	mpi::node_communicators comms{MPI_COMM_NULL, MPI_COMM_NULL, (size + 1) / 2};
+	MPI_Comm_split(MPI_COMM_WORLD, rank / 2, rank, &comms.node);
+	MPI_Comm_split(MPI_COMM_WORLD, rank % 2 == 0 ? 0 : MPI_UNDEFINED, rank, &comms.leaders);
+	return comms;
+}
+
+BOOST_AUTO_TEST_CASE(allreduce_flat) {
+	using namespace hbrs::mpl::detail;
+	
+	int const size = mpi::comm_size();
+	// flags and other small buffers always use a plain allreduce
+	BOOST_TEST(!mpi::prefers_hierarchical_allreduce(sizeof(int), MPI_COMM_WORLD));
+	
+	std::vector<int> send{1, 2, 3}, recv(3);
+	mpi::hierarchical_allreduce(send.data(), recv.data(), send.size(), MPI_SUM, MPI_COMM_WORLD);
+	for (int i = 0; i < 3; ++i) {
+		BOOST_TEST(recv[i] == (i+1) * size);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(allreduce_pairs) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	mpi::node_communicators comms = split_into_pairs();
+	
+	// growing counts replace the cached shared memory, odd counts leave slices of different sizes
+	for (std::size_t count : {1u, 5u, 3u, 17u, 1000u}) {
+		std::vector<double> send(count), recv(count, -1.);
+		for (std::size_t i = 0; i < count; ++i) {
+			send[i] = rank + 1. + i;
+		}
+		
+		mpi::hierarchical_allreduce(
+			send.data(), recv.data(), count, mpi::datatype(hana::type_c<double>), MPI_SUM, comms);
+		for (std::size_t i = 0; i < count; ++i) {
+			BOOST_TEST(recv[i] == size * (size + 1) / 2. + (double)i * size);
+		}
+		
+		mpi::hierarchical_allreduce(
+			MPI_IN_PLACE, send.data(), count, mpi::datatype(hana::type_c<double>), MPI_MAX, comms);
+		for (std::size_t i = 0; i < count; ++i) {
+			BOOST_TEST(send[i] == size + (double)i);
+		}
+	}
+	
+	// pairs of values and ranks
+	std::vector<mpi::pair<double,int>> maxima{ {(double)(rank % 3), rank} };
+	mpi::hierarchical_allreduce(
+		MPI_IN_PLACE, maxima.data(), maxima.size(), mpi::datatype(hana::type_c<mpi::pair<double,int>>), MPI_MAXLOC,
+		comms);
+	BOOST_TEST(maxima[0].first == (size >= 3 ? 2. : (double)(size - 1)));
+	BOOST_TEST(maxima[0].second == (size >= 3 ? 2 : size - 1));
+	
+	if (comms.leaders != MPI_COMM_NULL) {
+		MPI_Comm_free(&comms.leaders);
+	}
+	MPI_Comm_free(&comms.node);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,6 +21,13 @@
 #include <boost/throw_exception.hpp>
 #include <boost/assert.hpp>
 #include <mpi.h>
+#include <boost/numeric/conversion/cast.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace detail {
@@ -36,6 +43,66 @@ safe(int ec) {
 	}
 }
 
+/* Largest element count which is passed to the int count arguments of the classic MPI bindings, see
+ * set_int_count_limit()
+ */
+static std::atomic<std::size_t> max_int_count{(std::size_t)std::numeric_limits<int>::max()};
+
+#if MPI_VERSION >= 4
+	#define HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+#endif
+
+#ifndef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+/* Committed datatype which describes count contiguous elements of type element, i.e. a whole large buffer. It is
+ * composed of chunks of max_int_count elements plus a remainder and has an extent of count elements, hence it is
+ * passed with a count of 1 to the classic bindings. Freeing it while a non-blocking operation is still pending is
+ * safe, MPI defers the deallocation until the operation has completed.
+ */
+struct contiguous_datatype {
+	contiguous_datatype(std::size_t count, MPI_Datatype element) {
+		std::size_t const limit = max_int_count;
+		std::size_t const chunks = count / limit;
+		std::size_t const remainder = count % limit;
+		BOOST_ASSERT(chunks <= limit);
+		
+		MPI_Aint lb, extent;
+		safe(MPI_Type_get_extent(element, &lb, &extent));
+		
+		MPI_Datatype chunk, body, packed;
+		safe(MPI_Type_contiguous((int)limit, element, &chunk));
+		safe(MPI_Type_contiguous((int)chunks, chunk, &body));
+		
+		int blocklengths[2] = { 1, (int)remainder };
+		MPI_Aint displacements[2] = { 0, (MPI_Aint)(chunks * limit) * extent };
+		MPI_Datatype types[2] = { body, element };
+		safe(MPI_Type_create_struct(remainder > 0 ? 2 : 1, blocklengths, displacements, types, &packed));
+		safe(MPI_Type_create_resized(packed, 0, (MPI_Aint)count * extent, &type));
+		safe(MPI_Type_commit(&type));
+		
+		safe(MPI_Type_free(&packed));
+		safe(MPI_Type_free(&body));
+		safe(MPI_Type_free(&chunk));
+	}
+	
+	contiguous_datatype(contiguous_datatype const&) = delete;
+	contiguous_datatype& operator=(contiguous_datatype const&) = delete;
+	
+	~contiguous_datatype() {
+		if (!finalized()) {
+			MPI_Type_free(&type);
+		}
+	}
+	
+	MPI_Datatype type;
+};
+#endif
+
+HBRS_MPL_API
+MPI_Datatype
+datatype(hana::basic_type<float>) {
+	return MPI_FLOAT;
+}
+
 HBRS_MPL_API
 MPI_Datatype
 datatype(hana::basic_type<double>) {
@@ -48,6 +115,18 @@ datatype(hana::basic_type<int>) {
 	return MPI_INT;
 }
 
+HBRS_MPL_API
+MPI_Datatype
+datatype(hana::basic_type<long>) {
+	return MPI_LONG;
+}
+
+HBRS_MPL_API
+MPI_Datatype
+datatype(hana::basic_type<long long>) {
+	return MPI_LONG_LONG;
+}
+
 HBRS_MPL_API
 MPI_Datatype
 datatype(hana::basic_type<unsigned long>) {
@@ -90,6 +169,76 @@ datatype(hana::basic_type<pair<double,int>>) {
 	return MPI_DOUBLE_INT;
 }
 
+static std::vector<std::function<void()>> &
+finalizers() {
+	static std::vector<std::function<void()>> finalizers;
+	return finalizers;
+}
+
+static int
+run_finalizers(MPI_Comm, int, void *, void *) {
+	auto & fs = finalizers();
+	// reverse order of registration, like destructors
+	for(auto it = fs.rbegin(); it != fs.rend(); ++it) {
+		(*it)();
+	}
+	fs.clear();
+	return MPI_SUCCESS;
+}
+
+HBRS_MPL_API
+void
+at_finalize(std::function<void()> f) {
+	BOOST_ASSERT(initialized());
+	static std::mutex mutex;
+	std::lock_guard<std::mutex> lock{mutex};
+	
+	if (finalizers().empty()) {
+		// attributes of MPI_COMM_SELF are deleted at the beginning of MPI_Finalize, see MPI 3.1 Sec. 8.7.1
+		int keyval;
+		safe(MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &run_finalizers, &keyval, nullptr));
+		safe(MPI_Comm_set_attr(MPI_COMM_SELF, keyval, nullptr));
+		safe(MPI_Comm_free_keyval(&keyval));
+	}
+	finalizers().push_back(std::move(f));
+}
+
+HBRS_MPL_API
+MPI_Datatype
+create_struct_datatype(
+	int count, int const* blocklengths, MPI_Aint const* displacements, MPI_Datatype const* types, std::size_t extent
+) {
+	BOOST_ASSERT(initialized());
+	MPI_Datatype packed, type;
+	safe(MPI_Type_create_struct(count, blocklengths, displacements, types, &packed));
+	safe(MPI_Type_create_resized(packed, 0, (MPI_Aint)extent, &type));
+	safe(MPI_Type_free(&packed));
+	safe(MPI_Type_commit(&type));
+	at_finalize([type]() mutable { MPI_Type_free(&type); });
+	return type;
+}
+
+HBRS_MPL_API
+MPI_Datatype
+create_contiguous_datatype(std::size_t count, MPI_Datatype element) {
+	BOOST_ASSERT(initialized());
+	MPI_Datatype type;
+	safe(MPI_Type_contiguous(boost::numeric_cast<int>(count), element, &type));
+	safe(MPI_Type_commit(&type));
+	at_finalize([type]() mutable { MPI_Type_free(&type); });
+	return type;
+}
+
+HBRS_MPL_API
+MPI_Op
+create_op(MPI_User_function * function, bool commute) {
+	BOOST_ASSERT(initialized());
+	MPI_Op op;
+	safe(MPI_Op_create(function, commute ? 1 : 0, &op));
+	at_finalize([op]() mutable { MPI_Op_free(&op); });
+	return op;
+}
+
 HBRS_MPL_API
 bool
 initialized() {
@@ -138,12 +287,77 @@ abort(MPI_Comm comm, int errorcode) {
 	safe(MPI_Abort(comm, errorcode));
 }
 
+static int
+free_node_communicators(MPI_Comm, int, void *attribute, void *) {
+	auto * comms = static_cast<node_communicators *>(attribute);
+	if (comms->leaders != MPI_COMM_NULL) {
+		MPI_Comm_free(&comms->leaders);
+	}
+	MPI_Comm_free(&comms->node);
+	delete comms;
+	return MPI_SUCCESS;
+}
+
+HBRS_MPL_API
+node_communicators const&
+split_by_node(MPI_Comm comm) {
+	BOOST_ASSERT(initialized());
+	static int const keyval = []() {
+		int keyval;
+		safe(MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &free_node_communicators, &keyval, nullptr));
+		return keyval;
+	}();
+	
+	void * attribute;
+	int found;
+	safe(MPI_Comm_get_attr(comm, keyval, &attribute, &found));
+	if (found) {
+		return *static_cast<node_communicators *>(attribute);
+	}
+	
+	auto * comms = new node_communicators{MPI_COMM_NULL, MPI_COMM_NULL, 0};
+	safe(MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, comm_rank(comm), MPI_INFO_NULL, &comms->node));
+	
+	bool const leader = comm_rank(comms->node) == 0;
+	safe(MPI_Comm_split(comm, leader ? 0 : MPI_UNDEFINED, comm_rank(comm), &comms->leaders));
+	
+	if (leader) {
+		comms->nodes = comm_size(comms->leaders);
+	}
+	safe(MPI_Bcast(&comms->nodes, 1, MPI_INT, 0, comms->node));
+	
+	safe(MPI_Comm_set_attr(comm, keyval, comms));
+	return *comms;
+}
+
+HBRS_MPL_API
+std::size_t
+int_count_limit() {
+	return max_int_count;
+}
+
+HBRS_MPL_API
+void
+set_int_count_limit(std::size_t limit) {
+	BOOST_ASSERT(limit > 0 && limit <= (std::size_t)std::numeric_limits<int>::max());
+	max_int_count = limit;
+}
+
 HBRS_MPL_API
 MPI_Request
-ibcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm) {
+ibcast(void *buffer, std::size_t count, MPI_Datatype datatype, int root, MPI_Comm comm) {
 	BOOST_ASSERT(initialized());
 	MPI_Request request;
-	safe(MPI_Ibcast(buffer, count, datatype, root, comm, &request));
+	if (count <= max_int_count) {
+		safe(MPI_Ibcast(buffer, (int)count, datatype, root, comm, &request));
+	} else {
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+		safe(MPI_Ibcast_c(buffer, (MPI_Count)count, datatype, root, comm, &request));
+#else
+		contiguous_datatype large{count, datatype};
+		safe(MPI_Ibcast(buffer, 1, large.type, root, comm, &request));
+#endif
+	}
 	return request;
 }
 
@@ -156,6 +370,22 @@ wait(MPI_Request & request) {
 	return status;
 }
 
+HBRS_MPL_API
+void
+waitall(int count, MPI_Request * requests) {
+	BOOST_ASSERT(initialized());
+	safe(MPI_Waitall(count, requests, MPI_STATUSES_IGNORE));
+}
+
+HBRS_MPL_API
+bool
+test(MPI_Request & request) {
+	BOOST_ASSERT(initialized());
+	int flag;
+	safe(MPI_Test(&request, &flag, MPI_STATUS_IGNORE));
+	return flag != 0;
+}
+
 HBRS_MPL_API
 MPI_Status
 probe(int source, int tag, MPI_Comm comm) {
@@ -166,64 +396,271 @@ probe(int source, int tag, MPI_Comm comm) {
 }
 
 HBRS_MPL_API
-int
+std::size_t
 get_count(MPI_Status const& status, MPI_Datatype datatype) {
 	BOOST_ASSERT(initialized());
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+	MPI_Count count;
+	safe(MPI_Get_count_c(&status, datatype, &count));
+	BOOST_ASSERT(count != MPI_UNDEFINED);
+	return (std::size_t)count;
+#else
 	int count;
 	safe(MPI_Get_count(&status, datatype, &count));
-	return count;
+	if (count != MPI_UNDEFINED) {
+		return (std::size_t)count;
+	}
+	
+	// count does not fit into an int, so derive it from the size of the message in bytes instead
+	MPI_Count bytes, size;
+	safe(MPI_Get_elements_x(&status, MPI_BYTE, &bytes));
+	safe(MPI_Type_size_x(datatype, &size));
+	BOOST_ASSERT(size > 0 && bytes % size == 0);
+	return (std::size_t)(bytes / size);
+#endif
 }
 
 HBRS_MPL_API
 MPI_Request
-isend(void const *buffer, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) {
+isend(void const *buffer, std::size_t count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) {
 	BOOST_ASSERT(initialized());
 	MPI_Request request;
-	safe(MPI_Isend(buffer, count, datatype, dest, tag, comm, &request));
+	if (count <= max_int_count) {
+		safe(MPI_Isend(buffer, (int)count, datatype, dest, tag, comm, &request));
+	} else {
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+		safe(MPI_Isend_c(buffer, (MPI_Count)count, datatype, dest, tag, comm, &request));
+#else
+		contiguous_datatype large{count, datatype};
+		safe(MPI_Isend(buffer, 1, large.type, dest, tag, comm, &request));
+#endif
+	}
 	return request;
 }
 
 HBRS_MPL_API
 MPI_Request
-irecv(void *buffer, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm) {
+irecv(void *buffer, std::size_t count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm) {
 	BOOST_ASSERT(initialized());
 	MPI_Request request;
-	safe(MPI_Irecv(buffer, count, datatype, source, tag, comm, &request));
+	if (count <= max_int_count) {
+		safe(MPI_Irecv(buffer, (int)count, datatype, source, tag, comm, &request));
+	} else {
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+		safe(MPI_Irecv_c(buffer, (MPI_Count)count, datatype, source, tag, comm, &request));
+#else
+		contiguous_datatype large{count, datatype};
+		safe(MPI_Irecv(buffer, 1, large.type, source, tag, comm, &request));
+#endif
+	}
 	return request;
 }
 
 HBRS_MPL_API
 void
-allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+allreduce(const void *sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
 	BOOST_ASSERT(initialized());
-	safe(MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm));
+	if (count <= max_int_count) {
+		safe(MPI_Allreduce(sendbuf, recvbuf, (int)count, datatype, op, comm));
+		return;
+	}
+	
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+	safe(MPI_Allreduce_c(sendbuf, recvbuf, (MPI_Count)count, datatype, op, comm));
+#else
+	// predefined reduction operations are not defined on derived datatypes, so reduce in chunks instead
+	MPI_Aint lb, extent;
+	safe(MPI_Type_get_extent(datatype, &lb, &extent));
+	
+	std::size_t const limit = max_int_count;
+	for(std::size_t offset = 0; offset < count; offset += limit) {
+		int const chunk = (int)std::min(limit, count - offset);
+		MPI_Aint const displacement = (MPI_Aint)offset * extent;
+		safe(MPI_Allreduce(
+			sendbuf == MPI_IN_PLACE ? MPI_IN_PLACE : static_cast<char const*>(sendbuf) + displacement,
+			static_cast<char*>(recvbuf) + displacement,
+			chunk, datatype, op, comm));
+	}
+#endif
 }
 
 HBRS_MPL_API
 MPI_Request
-iallreduce(void const *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+iallreduce(void const *sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
 	BOOST_ASSERT(initialized());
 	MPI_Request request;
-	safe(MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, &request));
+	if (count <= max_int_count) {
+		safe(MPI_Iallreduce(sendbuf, recvbuf, (int)count, datatype, op, comm, &request));
+	} else {
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+		safe(MPI_Iallreduce_c(sendbuf, recvbuf, (MPI_Count)count, datatype, op, comm, &request));
+#else
+		// chunks cannot be chained into a single request, hence fall back to a blocking reduction
+		allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+		request = MPI_REQUEST_NULL;
+#endif
+	}
 	return request;
 }
 
 HBRS_MPL_API
 void
-allgather(void const* sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm) {
+reduce_local(void const* inbuf, void *inoutbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op) {
 	BOOST_ASSERT(initialized());
-	safe(MPI_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm));
+	std::size_t const extent = type_extent(datatype);
+	std::size_t const limit = max_int_count;
+	for(std::size_t offset = 0; offset < count; offset += limit) {
+		int const chunk = (int)std::min(limit, count - offset);
+		safe(MPI_Reduce_local(
+			static_cast<char const*>(inbuf) + offset * extent,
+			static_cast<char*>(inoutbuf) + offset * extent,
+			chunk, datatype, op));
+	}
+}
+
+HBRS_MPL_API
+std::size_t
+type_extent(MPI_Datatype datatype) {
+	BOOST_ASSERT(initialized());
+	MPI_Aint lb, extent;
+	safe(MPI_Type_get_extent(datatype, &lb, &extent));
+	return (std::size_t)extent;
 }
 
 HBRS_MPL_API
 MPI_Request
-iallgather(void const* sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm) {
+allreduce_init(void const *sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+	BOOST_ASSERT(initialized());
+	MPI_Request request = MPI_REQUEST_NULL;
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+	if (count <= max_int_count) {
+		safe(MPI_Allreduce_init(sendbuf, recvbuf, (int)count, datatype, op, comm, MPI_INFO_NULL, &request));
+	} else {
+		safe(MPI_Allreduce_init_c(sendbuf, recvbuf, (MPI_Count)count, datatype, op, comm, MPI_INFO_NULL, &request));
+	}
+#endif
+	return request;
+}
+
+HBRS_MPL_API
+void
+start(MPI_Request & request) {
+	BOOST_ASSERT(initialized());
+	safe(MPI_Start(&request));
+}
+
+HBRS_MPL_API
+void
+request_free(MPI_Request & request) {
+	BOOST_ASSERT(initialized());
+	safe(MPI_Request_free(&request));
+}
+
+HBRS_MPL_API
+void
+allgather(
+	void const* sendbuf, std::size_t sendcount, MPI_Datatype sendtype,
+	void *recvbuf, std::size_t recvcount, MPI_Datatype recvtype,
+	MPI_Comm comm
+) {
+	BOOST_ASSERT(initialized());
+	if ((sendbuf == MPI_IN_PLACE || sendcount <= max_int_count) && recvcount <= max_int_count) {
+		safe(MPI_Allgather(sendbuf, (int)sendcount, sendtype, recvbuf, (int)recvcount, recvtype, comm));
+		return;
+	}
+	
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+	safe(MPI_Allgather_c(sendbuf, (MPI_Count)sendcount, sendtype, recvbuf, (MPI_Count)recvcount, recvtype, comm));
+#else
+	// sendcount and sendtype are ignored for MPI_IN_PLACE, sendtype might even be MPI_DATATYPE_NULL
+	std::optional<contiguous_datatype> large_send;
+	if (sendbuf != MPI_IN_PLACE) {
+		large_send.emplace(sendcount, sendtype);
+	}
+	contiguous_datatype large_recv{recvcount, recvtype};
+	safe(MPI_Allgather(sendbuf, 1, large_send ? large_send->type : MPI_DATATYPE_NULL, recvbuf, 1, large_recv.type, comm));
+#endif
+}
+
+HBRS_MPL_API
+MPI_Request
+iallgather(
+	void const* sendbuf, std::size_t sendcount, MPI_Datatype sendtype,
+	void *recvbuf, std::size_t recvcount, MPI_Datatype recvtype,
+	MPI_Comm comm
+) {
 	BOOST_ASSERT(initialized());
 	MPI_Request request;
-	safe(MPI_Iallgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, &request));
+	if ((sendbuf == MPI_IN_PLACE || sendcount <= max_int_count) && recvcount <= max_int_count) {
+		safe(MPI_Iallgather(sendbuf, (int)sendcount, sendtype, recvbuf, (int)recvcount, recvtype, comm, &request));
+		return request;
+	}
+	
+#ifdef HBRS_MPL_DETAIL_MPI_LARGE_COUNT
+	safe(MPI_Iallgather_c(
+		sendbuf, (MPI_Count)sendcount, sendtype, recvbuf, (MPI_Count)recvcount, recvtype, comm, &request));
+#else
+	// sendcount and sendtype are ignored for MPI_IN_PLACE, sendtype might even be MPI_DATATYPE_NULL
+	std::optional<contiguous_datatype> large_send;
+	if (sendbuf != MPI_IN_PLACE) {
+		large_send.emplace(sendcount, sendtype);
+	}
+	contiguous_datatype large_recv{recvcount, recvtype};
+	safe(MPI_Iallgather(
+		sendbuf, 1, large_send ? large_send->type : MPI_DATATYPE_NULL, recvbuf, 1, large_recv.type, comm, &request));
+#endif
 	return request;
 }
 
+HBRS_MPL_API
+MPI_Win
+win_allocate_shared(std::size_t size, int disp_unit, MPI_Comm comm) {
+	BOOST_ASSERT(initialized());
+	MPI_Win win;
+	void * baseptr;
+	safe(MPI_Win_allocate_shared((MPI_Aint)size, disp_unit, MPI_INFO_NULL, comm, &baseptr, &win));
+	return win;
+}
+
+HBRS_MPL_API
+void *
+win_shared_query(MPI_Win win, int rank) {
+	BOOST_ASSERT(initialized());
+	MPI_Aint size;
+	int disp_unit;
+	void * baseptr;
+	safe(MPI_Win_shared_query(win, rank, &size, &disp_unit, &baseptr));
+	return baseptr;
+}
+
+HBRS_MPL_API
+void
+win_lock_all(MPI_Win win, int mode) {
+	BOOST_ASSERT(initialized());
+	safe(MPI_Win_lock_all(mode, win));
+}
+
+HBRS_MPL_API
+void
+win_unlock_all(MPI_Win win) {
+	BOOST_ASSERT(initialized());
+	safe(MPI_Win_unlock_all(win));
+}
+
+HBRS_MPL_API
+void
+win_sync(MPI_Win win) {
+	BOOST_ASSERT(initialized());
+	safe(MPI_Win_sync(win));
+}
+
+HBRS_MPL_API
+void
+win_free(MPI_Win & win) {
+	BOOST_ASSERT(initialized());
+	safe(MPI_Win_free(&win));
+}
+
 /* namespace mpi */ }
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
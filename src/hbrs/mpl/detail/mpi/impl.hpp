@@ -23,6 +23,16 @@
 #include <cstdlib>
 #include <boost/hana/type.hpp>
 #include <boost/config.hpp> 
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/second.hpp>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <type_traits>
 
 HBRS_MPL_NAMESPACE_BEGIN
@@ -237,6 +247,9 @@ struct alignas(sizeof(T1)) pair{
 };
 #pragma pack(pop)
 
+HBRS_MPL_API
+MPI_Datatype
+datatype(hana::basic_type<float>);
 HBRS_MPL_API
 MPI_Datatype
 datatype(hana::basic_type<double>);
@@ -245,6 +258,12 @@ MPI_Datatype
 datatype(hana::basic_type<int>);
 HBRS_MPL_API
 MPI_Datatype
+datatype(hana::basic_type<long>);
+HBRS_MPL_API
+MPI_Datatype
+datatype(hana::basic_type<long long>);
+HBRS_MPL_API
+MPI_Datatype
 datatype(hana::basic_type<unsigned long>);
 HBRS_MPL_API
 MPI_Datatype
@@ -265,6 +284,101 @@ HBRS_MPL_API
 MPI_Datatype
 datatype(hana::basic_type<pair<double,int>>);
 
+/* Registers f to be called during MPI_Finalize, before MPI frees its own objects */
+HBRS_MPL_API
+void
+at_finalize(std::function<void()> f);
+
+/* Returns a committed struct datatype with the given members and extent, which is freed in MPI_Finalize */
+HBRS_MPL_API
+MPI_Datatype
+create_struct_datatype(
+	int count, int const* blocklengths, MPI_Aint const* displacements, MPI_Datatype const* types, std::size_t extent);
+
+/* Returns a committed datatype of count contiguous elements, which is freed in MPI_Finalize */
+HBRS_MPL_API
+MPI_Datatype
+create_contiguous_datatype(std::size_t count, MPI_Datatype element);
+
+/* Returns a reduction operation, which is freed in MPI_Finalize */
+HBRS_MPL_API
+MPI_Op
+create_op(MPI_User_function * function, bool commute);
+
+template<typename T>
+struct is_std_array : std::false_type {};
+
+template<typename T, std::size_t N>
+struct is_std_array<std::array<T, N>> : std::true_type {};
+
+/* Datatypes of trivially copyable class types, which are used with user-defined reduction operations, see op().
+ *
+ * Boost.Hana structs (BOOST_HANA_DEFINE_STRUCT) are described member by member, std::array's as contiguous elements
+ * and all other classes as opaque bytes. The datatype is created on first use, cached and freed in MPI_Finalize.
+ */
+template<
+	typename T,
+	typename std::enable_if_t<std::is_class_v<T> && std::is_trivially_copyable_v<T>>* = nullptr
+>
+MPI_Datatype
+datatype(hana::basic_type<T>) {
+	static MPI_Datatype const type = []() {
+		if constexpr (hana::Struct<T>::value) {
+			static_assert(std::is_default_constructible_v<T>, "");
+			constexpr std::size_t count = decltype(hana::length(hana::accessors<T>()))::value;
+			std::array<int, count> blocklengths;
+			std::array<MPI_Aint, count> displacements;
+			std::array<MPI_Datatype, count> types;
+			
+			T const sample{};
+			std::size_t i = 0;
+			hana::for_each(hana::accessors<T>(), [&](auto accessor) {
+				auto const& member = hana::second(accessor)(sample);
+				blocklengths[i] = 1;
+				displacements[i] =
+					reinterpret_cast<char const*>(std::addressof(member)) -
+					reinterpret_cast<char const*>(std::addressof(sample));
+				types[i] = datatype(hana::type_c<std::decay_t<decltype(member)>>);
+				++i;
+			});
+			
+			return create_struct_datatype(
+				(int)count, blocklengths.data(), displacements.data(), types.data(), sizeof(T));
+		} else if constexpr (is_std_array<T>::value) {
+			return create_contiguous_datatype(
+				std::tuple_size<T>::value, datatype(hana::type_c<typename T::value_type>));
+		} else {
+			return create_contiguous_datatype(sizeof(T), MPI_BYTE);
+		}
+	}();
+	return type;
+}
+
+template<typename T, typename F>
+struct user_function {
+	static void
+	apply(void * in, void * inout, int * len, MPI_Datatype *) {
+		T const* a = static_cast<T const*>(in);
+		T * b = static_cast<T *>(inout);
+		for(int i = 0; i < *len; ++i) {
+			b[i] = F{}(a[i], b[i]);
+		}
+	}
+};
+
+/* Commutative reduction operation on elements of type T, which combines two elements with the binary function object
+ * F. F has to be stateless, because MPI calls it through a plain function pointer. Reducing buffers of T with
+ * datatype(hana::type_c<T>) and this operation computes element-wise folds like a builtin operation. The operation is
+ * created on first use, cached and freed in MPI_Finalize.
+ */
+template<typename T, typename F>
+MPI_Op
+op(hana::basic_type<T>, F const&) {
+	static_assert(std::is_empty_v<F> && std::is_default_constructible_v<F>, "");
+	static MPI_Op const op = create_op(&user_function<T, F>::apply, true);
+	return op;
+}
+
 HBRS_MPL_API
 bool
 initialized();
@@ -289,88 +403,198 @@ HBRS_MPL_API
 void
 abort(MPI_Comm comm = MPI_COMM_WORLD, int errorcode = EXIT_FAILURE);
 
+/* Ranks of a communicator grouped by the shared-memory node they run on */
+struct node_communicators {
+	/* all ranks of the communicator which run on the same node as the calling rank */
+	MPI_Comm node;
+	/* the ranks with rank 0 in their node communicator, MPI_COMM_NULL on all other ranks */
+	MPI_Comm leaders;
+	/* number of nodes spanned by the communicator */
+	int nodes;
+};
+
+/* Splits comm into node-local communicators with MPI_Comm_split_type(MPI_COMM_TYPE_SHARED) and a communicator of
+ * node leaders. This is collective over comm on the first call only, the result is cached as an attribute of comm
+ * and freed together with it.
+ */
+HBRS_MPL_API
+node_communicators const&
+split_by_node(MPI_Comm comm);
+
+/* Element counts of the point-to-point and collective wrappers below are std::size_t instead of MPI's int, so that
+ * buffers with more than 2^31-1 elements can be transferred [1]. Counts which fit into an int are passed through to
+ * the classic bindings. Larger counts use the MPI-4 large-count bindings (MPI_Isend_c et al.) if available. Else
+ * ibcast, isend, irecv and (i)allgather describe the whole buffer with a single contiguous derived datatype and
+ * allreduce is split into chunks of at most 2^31-1 elements. Derived datatypes do not work with predefined reduction
+ * operations, hence on MPI-3 a large-count iallreduce is executed blocking and returns MPI_REQUEST_NULL.
+ *
+ * Ref.:
+ *  [1] https://www.mpi-forum.org/docs/mpi-4.0/mpi40-report.pdf, Sec. 2.5.8 and 5.8
+ */
+
+/* Counts above this limit take the large-count code paths described above. It is 2^31-1 by default and is lowered by
+ * tests only, to exercise those paths with small buffers. All ranks of a communicator have to use the same limit.
+ */
+HBRS_MPL_API
+std::size_t
+int_count_limit();
+
+HBRS_MPL_API
+void
+set_int_count_limit(std::size_t limit);
+
 HBRS_MPL_API
 MPI_Request
-ibcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);
+ibcast(void *buffer, std::size_t count, MPI_Datatype datatype, int root, MPI_Comm comm);
 
-template<typename T>
+template<typename T, typename Count>
 MPI_Request
-ibcast(T *buffer, int count, int root, MPI_Comm comm) {
-	return ibcast(buffer, count, datatype(hana::type_c<T>), root, comm);
+ibcast(T *buffer, Count count, int root, MPI_Comm comm) {
+	return ibcast(buffer, boost::numeric_cast<std::size_t>(count), datatype(hana::type_c<T>), root, comm);
 }
 
 HBRS_MPL_API
 MPI_Status
 wait(MPI_Request & request);
 
+HBRS_MPL_API
+void
+waitall(int count, MPI_Request * requests);
+
+HBRS_MPL_API
+bool
+test(MPI_Request & request);
+
 HBRS_MPL_API
 MPI_Status
 probe(int source, int tag, MPI_Comm comm);
 
 HBRS_MPL_API
-int
+std::size_t
 get_count(MPI_Status const& status, MPI_Datatype datatype);
 
 HBRS_MPL_API
 MPI_Request
-isend(void const* buffer, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm);
+isend(void const* buffer, std::size_t count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm);
 
-template<typename T>
+template<typename T, typename Count>
 MPI_Request
-isend(T const* buffer, int count, int dest, int tag, MPI_Comm comm) {
-	return isend(buffer, count, datatype(hana::type_c<T>), dest, tag, comm);
+isend(T const* buffer, Count count, int dest, int tag, MPI_Comm comm) {
+	return isend(buffer, boost::numeric_cast<std::size_t>(count), datatype(hana::type_c<T>), dest, tag, comm);
 }
 
 HBRS_MPL_API
 MPI_Request
-irecv(void *buffer, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm);
+irecv(void *buffer, std::size_t count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm);
 
-template<typename T>
+template<typename T, typename Count>
 MPI_Request
-irecv(T *buffer, int count, int source, int tag, MPI_Comm comm) {
-	return irecv(buffer, count, datatype(hana::type_c<T>), source, tag, comm);
+irecv(T *buffer, Count count, int source, int tag, MPI_Comm comm) {
+	return irecv(buffer, boost::numeric_cast<std::size_t>(count), datatype(hana::type_c<T>), source, tag, comm);
 }
 
 HBRS_MPL_API
 void
-allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+allreduce(const void *sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
 
-template<typename T>
+template<typename T, typename Count>
 void
-allreduce(T const* sendbuf, T* recvbuf, int count, MPI_Op op, MPI_Comm comm) {
-	return allreduce(sendbuf, recvbuf, count, datatype(hana::type_c<T>), op, comm);
+allreduce(T const* sendbuf, T* recvbuf, Count count, MPI_Op op, MPI_Comm comm) {
+	return allreduce(sendbuf, recvbuf, boost::numeric_cast<std::size_t>(count), datatype(hana::type_c<T>), op, comm);
 }
 
 HBRS_MPL_API
 MPI_Request
-iallreduce(void const *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+iallreduce(void const *sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
 
-template<typename T>
+template<typename T, typename Count>
 MPI_Request
-iallreduce(T const *sendbuf, T *recvbuf, int count, MPI_Op op, MPI_Comm comm) {
-	return iallreduce(sendbuf, recvbuf, count, datatype(hana::type_c<T>), op, comm);
+iallreduce(T const *sendbuf, T *recvbuf, Count count, MPI_Op op, MPI_Comm comm) {
+	return iallreduce(sendbuf, recvbuf, boost::numeric_cast<std::size_t>(count), datatype(hana::type_c<T>), op, comm);
 }
 
+/* Computes inoutbuf = inbuf op inoutbuf element-wise on the calling process only */
 HBRS_MPL_API
 void
-allgather(void const* sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm);
+reduce_local(void const* inbuf, void *inoutbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op);
+
+/* Returns the extent of datatype in bytes, i.e. the stride between consecutive elements of a buffer */
+HBRS_MPL_API
+std::size_t
+type_extent(MPI_Datatype datatype);
 
-template<typename S, typename R>
+/* Creates a persistent allreduce with MPI-4's MPI_Allreduce_init, which is started with start(). Returns
+ * MPI_REQUEST_NULL if the MPI library does not provide persistent collectives.
+ */
+HBRS_MPL_API
+MPI_Request
+allreduce_init(void const *sendbuf, void *recvbuf, std::size_t count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
+
+HBRS_MPL_API
+void
+start(MPI_Request & request);
+
+HBRS_MPL_API
 void
-allgather(S const* sendbuf, int sendcount, R *recvbuf, int recvcount, MPI_Comm comm) {
-	return allgather(sendbuf, sendcount, datatype(hana::type_c<S>), recvbuf, recvcount, datatype(hana::type_c<R>), comm);
+request_free(MPI_Request & request);
+
+HBRS_MPL_API
+void
+allgather(
+	void const* sendbuf, std::size_t sendcount, MPI_Datatype sendtype,
+	void *recvbuf, std::size_t recvcount, MPI_Datatype recvtype,
+	MPI_Comm comm);
+
+template<typename S, typename R, typename SendCount, typename RecvCount>
+void
+allgather(S const* sendbuf, SendCount sendcount, R *recvbuf, RecvCount recvcount, MPI_Comm comm) {
+	return allgather(
+		sendbuf, boost::numeric_cast<std::size_t>(sendcount), datatype(hana::type_c<S>),
+		recvbuf, boost::numeric_cast<std::size_t>(recvcount), datatype(hana::type_c<R>),
+		comm);
 }
 
 HBRS_MPL_API
 MPI_Request
-iallgather(void const* sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount, MPI_Datatype recvtype, MPI_Comm comm);
+iallgather(
+	void const* sendbuf, std::size_t sendcount, MPI_Datatype sendtype,
+	void *recvbuf, std::size_t recvcount, MPI_Datatype recvtype,
+	MPI_Comm comm);
 
-template<typename S, typename R>
+template<typename S, typename R, typename SendCount, typename RecvCount>
 MPI_Request
-iallgather(S const* sendbuf, int sendcount, R *recvbuf, int recvcount, MPI_Comm comm) {
-	return iallgather(sendbuf, sendcount, datatype(hana::type_c<S>), recvbuf, recvcount, datatype(hana::type_c<R>), comm);
+iallgather(S const* sendbuf, SendCount sendcount, R *recvbuf, RecvCount recvcount, MPI_Comm comm) {
+	return iallgather(
+		sendbuf, boost::numeric_cast<std::size_t>(sendcount), datatype(hana::type_c<S>),
+		recvbuf, boost::numeric_cast<std::size_t>(recvcount), datatype(hana::type_c<R>),
+		comm);
 }
 
+HBRS_MPL_API
+MPI_Win
+win_allocate_shared(std::size_t size, int disp_unit, MPI_Comm comm);
+
+/* Returns the base address of the memory which rank has contributed to the shared-memory window win */
+HBRS_MPL_API
+void *
+win_shared_query(MPI_Win win, int rank);
+
+HBRS_MPL_API
+void
+win_lock_all(MPI_Win win, int mode = 0);
+
+HBRS_MPL_API
+void
+win_unlock_all(MPI_Win win);
+
+HBRS_MPL_API
+void
+win_sync(MPI_Win win);
+
+HBRS_MPL_API
+void
+win_free(MPI_Win & win);
+
 /* namespace mpi */ }
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
@@ -0,0 +1,153 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE mpi_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/test.hpp>
+#include <boost/hana/type.hpp>
+#include <algorithm>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(mpi_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+namespace hana = boost::hana;
+
+/* Lowers the int count limit, so that small buffers take the code paths for more than 2^31-1 elements */
+struct small_int_count_limit {
+	small_int_count_limit() : previous{hbrs::mpl::detail::mpi::int_count_limit()} {
+		hbrs::mpl::detail::mpi::set_int_count_limit(limit);
+	}
+	
+	~small_int_count_limit() {
+		hbrs::mpl::detail::mpi::set_int_count_limit(previous);
+	}
+	
+	static constexpr std::size_t limit = 4;
+	std::size_t previous;
+};
+
+// counts which are no multiple of the limit leave a remainder after the last full chunk
+static constexpr std::size_t count = 3 * small_int_count_limit::limit + 2;
+
+BOOST_FIXTURE_TEST_CASE(ibcast_large, small_int_count_limit) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	int const root = size - 1;
+	
+	std::vector<int> buffer(count, -1);
+	if (rank == root) {
+		for (std::size_t i = 0; i < count; ++i) {
+			buffer[i] = (int)i;
+		}
+	}
+	
+	MPI_Request request = mpi::ibcast(buffer.data(), count, root, MPI_COMM_WORLD);
+	mpi::wait(request);
+	for (std::size_t i = 0; i < count; ++i) {
+		BOOST_TEST(buffer[i] == (int)i);
+	}
+}
+
+BOOST_FIXTURE_TEST_CASE(isend_irecv_large, small_int_count_limit) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	
+	std::vector<double> send(count), recv(count, -1.);
+	for (std::size_t i = 0; i < count; ++i) {
+		send[i] = rank + 0.5 * i;
+	}
+	
+	int const source = (rank + size - 1) % size;
+	MPI_Request requests[2] = {
+		mpi::irecv(recv.data(), count, source, 0, MPI_COMM_WORLD),
+		mpi::isend(send.data(), count, (rank + 1) % size, 0, MPI_COMM_WORLD)
+	};
+	mpi::waitall(2, requests);
+	for (std::size_t i = 0; i < count; ++i) {
+		BOOST_TEST(recv[i] == source + 0.5 * i);
+	}
+}
+
+BOOST_FIXTURE_TEST_CASE(allreduce_large, small_int_count_limit) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	MPI_Datatype const type = mpi::datatype(hana::type_c<int>);
+	
+	std::vector<int> send(count), recv(count, -1);
+	for (std::size_t i = 0; i < count; ++i) {
+		send[i] = rank + (int)i;
+	}
+	
+	mpi::allreduce(send.data(), recv.data(), count, type, MPI_SUM, MPI_COMM_WORLD);
+	for (std::size_t i = 0; i < count; ++i) {
+		BOOST_TEST(recv[i] == size * (size - 1) / 2 + size * (int)i);
+	}
+	
+	MPI_Request request = mpi::iallreduce(MPI_IN_PLACE, send.data(), count, type, MPI_SUM, MPI_COMM_WORLD);
+	mpi::wait(request);
+	BOOST_TEST(send == recv);
+	
+	mpi::reduce_local(recv.data(), send.data(), count, type, MPI_SUM);
+	for (std::size_t i = 0; i < count; ++i) {
+		BOOST_TEST(send[i] == 2 * recv[i]);
+	}
+}
+
+BOOST_FIXTURE_TEST_CASE(allgather_large, small_int_count_limit) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	MPI_Datatype const type = mpi::datatype(hana::type_c<int>);
+	
+	std::vector<int> send(count), recv(count * size, -1);
+	for (std::size_t i = 0; i < count; ++i) {
+		send[i] = rank * (int)count + (int)i;
+	}
+	
+	mpi::allgather(send.data(), count, type, recv.data(), count, type, MPI_COMM_WORLD);
+	for (std::size_t i = 0; i < recv.size(); ++i) {
+		BOOST_TEST(recv[i] == (int)i);
+	}
+	
+	// sendcount and sendtype are ignored for MPI_IN_PLACE
+	std::vector<int> inplace(count * size, -1);
+	std::copy(send.begin(), send.end(), inplace.begin() + rank * count);
+	MPI_Request request = mpi::iallgather(
+		MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, inplace.data(), count, type, MPI_COMM_WORLD);
+	mpi::wait(request);
+	BOOST_TEST(inplace == recv);
+	
+	std::fill(inplace.begin(), inplace.end(), -1);
+	std::copy(send.begin(), send.end(), inplace.begin() + rank * count);
+	mpi::allgather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, inplace.data(), count, type, MPI_COMM_WORLD);
+	BOOST_TEST(inplace == recv);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,207 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef HBRS_MPL_DETAIL_REDUCTION_IMPL_HPP
+#define HBRS_MPL_DETAIL_REDUCTION_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/*
+ * Partial results of reductions that MPI has no builtin operation for. Each one is a Boost.Hana struct, so that
+ * mpi::datatype(hana::type_c<T>) describes it member by member, and comes with a stateless merge function object for
+ * mpi::op(hana::type_c<T>, F{}). Hence a single allreduce of per-process partial results computes e.g. means and
+ * variances at once, instead of one collective per statistic.
+ */
+
+/* Number of samples, mean and sum of squared deviations from the mean of a sequence, updated with Welford's method */
+template<typename Real>
+struct welford {
+	BOOST_HANA_DEFINE_STRUCT(welford,
+		(Real, count),
+		(Real, mean),
+		(Real, m2)
+	);
+	
+	void
+	add(Real x) {
+		count += 1;
+		Real const delta = x - mean;
+		mean += delta / count;
+		m2 += delta * (x - mean);
+	}
+};
+
+/*
+ * Merges partial moments of two sequences as proposed by Chan et al. [1], where only the difference of the means is
+ * affected by cancellation instead of the whole sum of squares.
+ *
+ * Ref.:
+ * [1] T. F. Chan, G. H. Golub and R. J. LeVeque, "Algorithms for Computing the Sample Variance: Analysis and
+ *     Recommendations", The American Statistician, 37(3), 1983.
+ */
+struct welford_merge {
+	template<typename Real>
+	welford<Real>
+	operator()(welford<Real> const& a, welford<Real> const& b) const {
+		Real const count = a.count + b.count;
+		if (count == 0) {
+			return a;
+		}
+		
+		Real const delta = b.mean - a.mean;
+		welford<Real> c;
+		c.count = count;
+		c.mean = a.mean + delta * (b.count / count);
+		c.m2 = a.m2 + b.m2 + delta * delta * (a.count * b.count / count);
+		return c;
+	}
+};
+
+/* Sum of values with a running compensation for the lost low-order bits (Kahan-Babuska summation) */
+template<typename Real>
+struct compensated_sum {
+	BOOST_HANA_DEFINE_STRUCT(compensated_sum,
+		(Real, sum),
+		(Real, compensation)
+	);
+	
+	void
+	add(Real x) {
+		Real const t = sum + x;
+		compensation += (std::abs(sum) >= std::abs(x)) ? (sum - t) + x : (x - t) + sum;
+		sum = t;
+	}
+	
+	Real
+	value() const {
+		return sum + compensation;
+	}
+};
+
+struct compensated_sum_merge {
+	template<typename Real>
+	compensated_sum<Real>
+	operator()(compensated_sum<Real> const& a, compensated_sum<Real> const& b) const {
+		compensated_sum<Real> c = a;
+		c.add(b.sum);
+		c.compensation += b.compensation;
+		return c;
+	}
+};
+
+/* Value and index of an element, e.g. of the largest element in a column */
+template<typename Real>
+struct value_and_index {
+	BOOST_HANA_DEFINE_STRUCT(value_and_index,
+		(Real, value),
+		(long long, index)
+	);
+};
+
+/*
+ * Keeps the element with the larger value and, like MATLAB's max(), the smaller index if both values are equal. Works
+ * with all structs that have value and index members, so further members like the sign of an element are carried
+ * along with the maximum.
+ */
+struct arg_max {
+	template<typename T>
+	T
+	operator()(T const& a, T const& b) const {
+		if (a.value != b.value) {
+			return a.value > b.value ? a : b;
+		}
+		return a.index < b.index ? a : b;
+	}
+};
+
+/*
+ * The K largest values and their indices in descending order. Unused slots have the lowest value and index -1, so a
+ * default-initialized top_k from empty() is the identity of top_k_merge.
+ */
+template<typename Real, std::size_t K>
+struct top_k {
+	BOOST_HANA_DEFINE_STRUCT(top_k,
+		(std::array<Real, K>, values),
+		(std::array<long long, K>, indices)
+	);
+	
+	static top_k
+	empty() {
+		top_k t;
+		t.values.fill(std::numeric_limits<Real>::lowest());
+		t.indices.fill(-1);
+		return t;
+	}
+	
+	void
+	add(Real x, long long index) {
+		if (!(x > values[K-1])) {
+			return;
+		}
+		
+		std::size_t i = K-1;
+		for(; i > 0 && x > values[i-1]; --i) {
+			values[i] = values[i-1];
+			indices[i] = indices[i-1];
+		}
+		values[i] = x;
+		indices[i] = index;
+	}
+};
+
+struct top_k_merge {
+	template<typename Real, std::size_t K>
+	top_k<Real, K>
+	operator()(top_k<Real, K> const& a, top_k<Real, K> const& b) const {
+		top_k<Real, K> c;
+		std::size_t i = 0, j = 0;
+		for(std::size_t k = 0; k < K; ++k) {
+			// ties are resolved in favour of the smaller index, independent of the order of the operands
+			bool const take_a =
+				a.values[i] > b.values[j] ||
+				(a.values[i] == b.values[j] && a.indices[i] <= b.indices[j] && a.indices[i] >= 0) ||
+				b.indices[j] < 0;
+			if (take_a) {
+				c.values[k] = a.values[i];
+				c.indices[k] = a.indices[i];
+				++i;
+			} else {
+				c.values[k] = b.values[j];
+				c.indices[k] = b.indices[j];
+				++j;
+			}
+		}
+		return c;
+	}
+};
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_REDUCTION_IMPL_HPP
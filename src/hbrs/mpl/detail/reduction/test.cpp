@@ -0,0 +1,164 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE reduction_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/reduction.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/test.hpp>
+#include <boost/hana/type.hpp>
+#include <cmath>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(reduction_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+namespace hana = boost::hana;
+
+BOOST_AUTO_TEST_CASE(struct_datatype) {
+	using namespace hbrs::mpl::detail;
+	
+	typedef value_and_index<double> T;
+	MPI_Datatype type = mpi::datatype(hana::type_c<T>);
+	BOOST_TEST(type == mpi::datatype(hana::type_c<T>)); // cached
+	
+	MPI_Aint lb, extent;
+	MPI_Type_get_extent(type, &lb, &extent);
+	BOOST_TEST(lb == 0);
+	BOOST_TEST(extent == (MPI_Aint)sizeof(T));
+	
+	int size;
+	MPI_Type_size(type, &size);
+	BOOST_TEST(size == (int)(sizeof(double) + sizeof(long long)));
+	
+	typedef top_k<float, 3> U;
+	MPI_Type_get_extent(mpi::datatype(hana::type_c<U>), &lb, &extent);
+	BOOST_TEST(extent == (MPI_Aint)sizeof(U));
+}
+
+BOOST_AUTO_TEST_CASE(welford_allreduce) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	
+	// rank r holds the values r*10+0,...,r*10+r, i.e. r+1 values, and a second column with shifted values
+	std::vector<welford<double>> moments(2, welford<double>{0., 0., 0.});
+	for (int i = 0; i <= rank; ++i) {
+		moments[0].add(rank*10 + i);
+		moments[1].add(1e8 + rank*10 + i);
+	}
+	
+	mpi::allreduce(
+		MPI_IN_PLACE, moments.data(), moments.size(),
+		mpi::datatype(hana::type_c<welford<double>>), mpi::op(hana::type_c<welford<double>>, welford_merge{}),
+		MPI_COMM_WORLD);
+	
+	welford<double> expected{0., 0., 0.};
+	for (int r = 0; r < size; ++r) {
+		for (int i = 0; i <= r; ++i) {
+			expected.add(r*10 + i);
+		}
+	}
+	
+	for (auto const& m : moments) {
+		BOOST_TEST(m.count == expected.count);
+		BOOST_TEST(m.m2 == expected.m2, boost::test_tools::tolerance(1e-8));
+	}
+	BOOST_TEST(moments[0].mean == expected.mean, boost::test_tools::tolerance(1e-12));
+	BOOST_TEST(moments[1].mean - 1e8 == expected.mean, boost::test_tools::tolerance(1e-6));
+}
+
+BOOST_AUTO_TEST_CASE(compensated_sum_allreduce) {
+	using namespace hbrs::mpl::detail;
+	
+	int const size = mpi::comm_size();
+	
+	// 1 + size*n*1e-16 is lost completely by naive summation in double precision
+	compensated_sum<double> s{0., 0.};
+	if (mpi::comm_rank() == 0) {
+		s.add(1.);
+	}
+	int const n = 1000;
+	for (int i = 0; i < n; ++i) {
+		s.add(1e-16);
+	}
+	
+	mpi::allreduce(
+		MPI_IN_PLACE, &s, 1,
+		mpi::datatype(hana::type_c<compensated_sum<double>>),
+		mpi::op(hana::type_c<compensated_sum<double>>, compensated_sum_merge{}),
+		MPI_COMM_WORLD);
+	
+	BOOST_TEST(s.value() == 1. + size*n*1e-16, boost::test_tools::tolerance(1e-15));
+	BOOST_TEST(s.value() != 1.);
+}
+
+BOOST_AUTO_TEST_CASE(arg_max_allreduce) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	
+	// every rank has the same maximum in the first element, so the smallest index has to win
+	std::vector<value_and_index<double>> maxima{ {1., rank}, {(double)rank, 100-rank} };
+	
+	mpi::allreduce(
+		MPI_IN_PLACE, maxima.data(), maxima.size(),
+		mpi::datatype(hana::type_c<value_and_index<double>>),
+		mpi::op(hana::type_c<value_and_index<double>>, arg_max{}),
+		MPI_COMM_WORLD);
+	
+	BOOST_TEST(maxima[0].value == 1.);
+	BOOST_TEST(maxima[0].index == 0);
+	BOOST_TEST(maxima[1].value == size-1);
+	BOOST_TEST(maxima[1].index == 100-(size-1));
+}
+
+BOOST_AUTO_TEST_CASE(top_k_allreduce) {
+	using namespace hbrs::mpl::detail;
+	
+	int const rank = mpi::comm_rank();
+	int const size = mpi::comm_size();
+	
+	typedef top_k<double, 4> T;
+	T t = T::empty();
+	for (int i = 0; i < 3; ++i) {
+		long long const index = rank*3 + i;
+		t.add(std::fmod(index * 7., 11.), index);
+	}
+	
+	mpi::allreduce(
+		MPI_IN_PLACE, &t, 1, mpi::datatype(hana::type_c<T>), mpi::op(hana::type_c<T>, top_k_merge{}), MPI_COMM_WORLD);
+	
+	T expected = T::empty();
+	for (long long index = 0; index < size*3; ++index) {
+		expected.add(std::fmod(index * 7., 11.), index);
+	}
+	
+	for (std::size_t k = 0; k < 4; ++k) {
+		BOOST_TEST(t.values[k] == expected.values[k]);
+		BOOST_TEST(t.indices[k] == expected.indices[k]);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,48 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "impl.hpp"
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+shared_window::shared_window(MPI_Comm comm, std::size_t bytes)
+: shared_window{mpi::split_by_node(comm), bytes} {}
+
+shared_window::shared_window(mpi::node_communicators const& comms, std::size_t bytes)
+: comms_{comms}, window_{MPI_WIN_NULL}, data_{nullptr}, size_{bytes} {
+	window_ = mpi::win_allocate_shared(leader() ? size_ : 0, 1, comms_.node);
+	data_ = mpi::win_shared_query(window_, 0);
+	mpi::win_lock_all(window_, MPI_MODE_NOCHECK);
+}
+
+shared_window::~shared_window() {
+	if (!mpi::finalized()) {
+		MPI_Win_unlock_all(window_);
+		MPI_Win_free(&window_);
+	}
+}
+
+void
+shared_window::synchronize() {
+	mpi::win_sync(window_);
+	mpi::barrier(comms_.node);
+	mpi::win_sync(window_);
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
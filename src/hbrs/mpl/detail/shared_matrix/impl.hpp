@@ -0,0 +1,199 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef HBRS_MPL_DETAIL_SHARED_MATRIX_IMPL_HPP
+#define HBRS_MPL_DETAIL_SHARED_MATRIX_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <mpi.h>
+#include <cstddef>
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+#include <boost/hana/type.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <El.hpp>
+#include <algorithm>
+#include <memory>
+#endif
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+namespace detail {
+
+/*
+ * Memory which is allocated once per node with MPI_Win_allocate_shared and mapped into the address spaces of all ranks
+ * of a communicator on that node. The memory is owned by rank 0 of the node communicator, the leader, all other ranks
+ * contribute no memory.
+ *
+ * The window is locked with MPI_Win_lock_all for its whole lifetime, so ranks access the memory with plain loads and
+ * stores. Stores of one rank are visible to the other ranks of its node after all of them called synchronize().
+ */
+class HBRS_MPL_API shared_window {
+public:
+	/* Collective over comm, which has to outlive the window */
+	shared_window(MPI_Comm comm, std::size_t bytes);
+	
+	/* Collective over comms.node, where comms.node has to consist of ranks on the same node */
+	shared_window(mpi::node_communicators const& comms, std::size_t bytes);
+	~shared_window();
+	
+	shared_window(shared_window const&) = delete;
+	shared_window(shared_window &&) = delete;
+	
+	shared_window&
+	operator=(shared_window const&) = delete;
+	shared_window&
+	operator=(shared_window &&) = delete;
+	
+	void *
+	data() const {
+		return data_;
+	}
+	
+	std::size_t
+	size() const {
+		return size_;
+	}
+	
+	bool
+	leader() const {
+		return comms_.leaders != MPI_COMM_NULL;
+	}
+	
+	mpi::node_communicators const&
+	communicators() const {
+		return comms_;
+	}
+	
+	/* Memory barrier and barrier across all ranks of the node */
+	void
+	synchronize();
+	
+private:
+	mpi::node_communicators comms_;
+	MPI_Win window_;
+	void * data_;
+	std::size_t size_;
+};
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+/*
+ * Matrices of fewer bytes are replicated once per rank, because allocating a shared window and synchronizing the node
+ * costs more than it saves, e.g. for the vectors which times() expands to matrices.
+ */
+constexpr std::size_t shared_matrix_min_bytes = std::size_t{1} << 16;
+
+/*
+ * Read-only copy of a distributed matrix which is stored once per node in a shared_window instead of once per rank as
+ * with El::DistMatrix<Ring, El::STAR, El::STAR>. With r ranks per node this reduces the memory for replicated operands
+ * by a factor of r. Matrices smaller than shared_matrix_min_bytes are copied to a [STAR,STAR] matrix instead.
+ *
+ * Each rank stores the entries it owns into the copy of its node. If the grid spans several nodes, then the node
+ * leaders complete their copies with a single allreduce, because each entry has been stored by exactly one rank and is
+ * zero on all other nodes. Construction is collective over the grid of the matrix.
+ */
+template<typename Ring>
+class shared_matrix {
+public:
+	explicit
+	shared_matrix(El::AbstractDistMatrix<Ring> const& a) : window_{}, replica_{a.Grid()}, data_{} {
+		El::Int const m = a.Height();
+		El::Int const n = a.Width();
+		std::size_t const bytes = sizeof(Ring) * (std::size_t)m * (std::size_t)n;
+		
+		if (bytes < shared_matrix_min_bytes) {
+			replica_ = a;
+			data_.LockedAttach(m, n, replica_.LockedBuffer(), replica_.LDim());
+			return;
+		}
+		
+		window_ = std::make_unique<shared_window>(a.Grid().Comm().comm, bytes);
+		Ring * buf = static_cast<Ring *>(window_->data());
+		
+		if (window_->leader()) {
+			std::fill_n(buf, m*n, Ring(0));
+		}
+		window_->synchronize();
+		
+		if (a.Participating() && a.RedundantRank() == 0) {
+			El::Matrix<Ring> const& a_lcl = a.LockedMatrix();
+			El::Int const a_lcl_ldim = a_lcl.LDim();
+			Ring const* a_lcl_buf = a_lcl.LockedBuffer();
+			
+			for(El::Int j = 0; j < a_lcl.Width(); ++j) {
+				Ring * col = buf + a.GlobalCol(j)*m;
+				for(El::Int i = 0; i < a_lcl.Height(); ++i) {
+					col[a.GlobalRow(i)] = a_lcl_buf[i+j*a_lcl_ldim];
+				}
+			}
+		}
+		window_->synchronize();
+		
+		if (window_->communicators().nodes > 1) {
+			typedef El::Base<Ring> Real;
+			if (window_->leader()) {
+				// complex entries are summed as pairs of real numbers
+				mpi::allreduce(
+					MPI_IN_PLACE, reinterpret_cast<Real *>(buf),
+					boost::numeric_cast<std::size_t>((El::IsComplex<Ring>::value ? 2 : 1) * m*n),
+					mpi::datatype(hana::type_c<Real>), MPI_SUM, window_->communicators().leaders);
+			}
+			window_->synchronize();
+		}
+		
+		data_.LockedAttach(m, n, buf, std::max<El::Int>(m, 1));
+	}
+	
+	shared_matrix(shared_matrix const&) = delete;
+	shared_matrix(shared_matrix &&) = delete;
+	
+	shared_matrix&
+	operator=(shared_matrix const&) = delete;
+	shared_matrix&
+	operator=(shared_matrix &&) = delete;
+	
+	El::Int
+	m() const {
+		return data_.Height();
+	}
+	
+	El::Int
+	n() const {
+		return data_.Width();
+	}
+	
+	/* Column-major view of all entries */
+	El::Matrix<Ring> const&
+	data() const {
+		return data_;
+	}
+	
+private:
+	std::unique_ptr<shared_window> window_;
+	El::DistMatrix<Ring, El::STAR, El::STAR> replica_;
+	El::Matrix<Ring> data_;
+};
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_SHARED_MATRIX_IMPL_HPP
@@ -0,0 +1,126 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE shared_matrix_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/detail/shared_matrix.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/test.hpp>
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+	#include <El.hpp>
+	#include <cstddef>
+#endif
+
+BOOST_AUTO_TEST_SUITE(shared_matrix_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+BOOST_AUTO_TEST_CASE(split_by_node) {
+	using namespace hbrs::mpl::detail;
+	
+	mpi::node_communicators const& comms = mpi::split_by_node(MPI_COMM_WORLD);
+	BOOST_TEST(comms.nodes >= 1);
+	BOOST_TEST(mpi::comm_size(comms.node) <= mpi::comm_size());
+	BOOST_TEST((comms.leaders != MPI_COMM_NULL) == (mpi::comm_rank(comms.node) == 0));
+	
+	// cached, so later calls return the same communicators
+	BOOST_TEST(&mpi::split_by_node(MPI_COMM_WORLD) == &comms);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window_visibility) {
+	using namespace hbrs::mpl::detail;
+	
+	mpi::node_communicators const& comms = mpi::split_by_node(MPI_COMM_WORLD);
+	int const node_rank = mpi::comm_rank(comms.node);
+	int const node_size = mpi::comm_size(comms.node);
+	
+	shared_window window{MPI_COMM_WORLD, sizeof(int) * node_size};
+	BOOST_TEST(window.size() == sizeof(int) * node_size);
+	BOOST_TEST(window.leader() == (node_rank == 0));
+	
+	int * buf = static_cast<int *>(window.data());
+	buf[node_rank] = node_rank + 1;
+	window.synchronize();
+	
+	for (int i = 0; i < node_size; ++i) {
+		BOOST_TEST(buf[i] == i + 1);
+	}
+	window.synchronize();
+}
+
+BOOST_AUTO_TEST_CASE(shared_window_empty) {
+	using namespace hbrs::mpl::detail;
+	
+	shared_window window{MPI_COMM_WORLD, 0};
+	BOOST_TEST(window.size() == 0u);
+	window.synchronize();
+}
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+BOOST_AUTO_TEST_CASE(shared_matrix_distributions) {
+	using namespace hbrs::mpl::detail;
+	
+	El::Grid grid{El::mpi::COMM_WORLD};
+	
+	// 100x100 doubles are above and 10x10 doubles are below shared_matrix_min_bytes
+	for (El::Int const n : { El::Int{100}, El::Int{10} }) {
+		El::DistMatrix<double, El::STAR, El::STAR> expected{n, n, grid};
+		for (El::Int j = 0; j < n; ++j) {
+			for (El::Int i = 0; i < n; ++i) {
+				expected.Set(i, j, i * n + j + 1.);
+			}
+		}
+		BOOST_TEST(
+			(static_cast<std::size_t>(n*n) * sizeof(double) >= shared_matrix_min_bytes) == (n == 100)
+		);
+		
+		auto check = [&](El::AbstractDistMatrix<double> const& a) {
+			shared_matrix<double> s{a};
+			BOOST_TEST(s.m() == n);
+			BOOST_TEST(s.n() == n);
+			
+			El::Matrix<double> const& lcl = s.data();
+			El::Matrix<double> const& ref = expected.LockedMatrix();
+			BOOST_TEST(lcl.Height() == n);
+			BOOST_TEST(lcl.Width() == n);
+			for (El::Int j = 0; j < n; ++j) {
+				for (El::Int i = 0; i < n; ++i) {
+					BOOST_TEST(lcl.Get(i, j) == ref.Get(i, j));
+				}
+			}
+		};
+		
+		El::DistMatrix<double, El::MC, El::MR> mc_mr{grid};
+		El::Copy(expected, mc_mr);
+		check(mc_mr);
+		
+		El::DistMatrix<double, El::VC, El::STAR> vc_star{grid};
+		El::Copy(expected, vc_star);
+		check(vc_star);
+		
+		check(expected);
+	}
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
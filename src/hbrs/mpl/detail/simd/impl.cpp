@@ -0,0 +1,335 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "impl.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#define HBRS_MPL_DETAIL_SIMD_X86
+#endif
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+namespace simd {
+
+/*
+ * Kernels are written once as templates which are inlined into wrappers compiled for each instruction set level, see
+ * HBRS_MPL_DETAIL_SIMD_KERNELS. Loops use OpenMP's simd construct like EL_SIMD, which permits reordering reductions.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+	#define HBRS_MPL_DETAIL_SIMD_INLINE inline __attribute__((always_inline))
+#else
+	#define HBRS_MPL_DETAIL_SIMD_INLINE inline
+#endif
+
+template<typename Real>
+static HBRS_MPL_DETAIL_SIMD_INLINE void
+multiply_kernel(Real const* a, Real const* b, Real * c, std::size_t n) {
+	#pragma omp simd
+	for (std::size_t i = 0; i < n; ++i) {
+		c[i] = a[i] * b[i];
+	}
+}
+
+template<typename Real>
+static HBRS_MPL_DETAIL_SIMD_INLINE void
+scale_kernel(Real * x, std::size_t n, Real alpha) {
+	#pragma omp simd
+	for (std::size_t i = 0; i < n; ++i) {
+		x[i] *= alpha;
+	}
+}
+
+template<typename Real>
+static HBRS_MPL_DETAIL_SIMD_INLINE Real
+sum_kernel(Real const* x, std::size_t n) {
+	Real sum = 0;
+	#pragma omp simd reduction(+:sum)
+	for (std::size_t i = 0; i < n; ++i) {
+		sum += x[i];
+	}
+	return sum;
+}
+
+template<typename Real>
+static HBRS_MPL_DETAIL_SIMD_INLINE Real
+sum_of_squared_deviations_kernel(Real const* x, std::size_t n, Real mu) {
+	Real sum = 0;
+	#pragma omp simd reduction(+:sum)
+	for (std::size_t i = 0; i < n; ++i) {
+		sum += (x[i] - mu) * (x[i] - mu);
+	}
+	return sum;
+}
+
+template<typename Real>
+static HBRS_MPL_DETAIL_SIMD_INLINE std::size_t
+index_of_abs_max_kernel(Real const* x, std::size_t n) {
+	// the maximum is found with a vectorized reduction, its first position with an early exit scan
+	Real max = -1;
+	#pragma omp simd reduction(max:max)
+	for (std::size_t i = 0; i < n; ++i) {
+		Real const abs = x[i] < 0 ? -x[i] : x[i];
+		max = abs > max ? abs : max;
+	}
+	
+	if (max < 0) {
+		return n;
+	}
+	
+	for (std::size_t i = 0; i < n; ++i) {
+		if ((x[i] < 0 ? -x[i] : x[i]) == max) {
+			return i;
+		}
+	}
+	return n;
+}
+
+template<typename Real>
+static HBRS_MPL_DETAIL_SIMD_INLINE void
+gemm_kernel(
+	std::size_t m, std::size_t n, std::size_t k,
+	Real const* a, std::size_t lda, Real const* b, std::size_t ldb, Real * c, std::size_t ldc
+) {
+	for (std::size_t i = 0; i < m; ++i) {
+		Real * c_row = c + i*ldc;
+		#pragma omp simd
+		for (std::size_t j = 0; j < n; ++j) {
+			c_row[j] = 0;
+		}
+		
+		for (std::size_t l = 0; l < k; ++l) {
+			Real const a_il = a[i*lda + l];
+			Real const* b_row = b + l*ldb;
+			#pragma omp simd
+			for (std::size_t j = 0; j < n; ++j) {
+				c_row[j] += a_il * b_row[j];
+			}
+		}
+	}
+}
+
+/* Function pointers to the kernels for one instruction set level */
+template<typename Real>
+struct kernel_table {
+	void (*multiply)(Real const*, Real const*, Real *, std::size_t);
+	void (*scale)(Real *, std::size_t, Real);
+	Real (*sum)(Real const*, std::size_t);
+	Real (*sum_of_squared_deviations)(Real const*, std::size_t, Real);
+	std::size_t (*index_of_abs_max)(Real const*, std::size_t);
+	void (*gemm)(
+		std::size_t, std::size_t, std::size_t, Real const*, std::size_t, Real const*, std::size_t, Real *, std::size_t);
+};
+
+/* Defines struct level with the kernels compiled with the given function attributes and their kernel_table */
+#define HBRS_MPL_DETAIL_SIMD_KERNELS(level, attributes)                                                                \
+	template<typename Real>                                                                                            \
+	struct level {                                                                                                     \
+		attributes static void                                                                                         \
+		multiply(Real const* a, Real const* b, Real * c, std::size_t n) {                                              \
+			multiply_kernel(a, b, c, n);                                                                               \
+		}                                                                                                              \
+		                                                                                                               \
+		attributes static void                                                                                         \
+		scale(Real * x, std::size_t n, Real alpha) {                                                                   \
+			scale_kernel(x, n, alpha);                                                                                 \
+		}                                                                                                              \
+		                                                                                                               \
+		attributes static Real                                                                                         \
+		sum(Real const* x, std::size_t n) {                                                                            \
+			return sum_kernel(x, n);                                                                                   \
+		}                                                                                                              \
+		                                                                                                               \
+		attributes static Real                                                                                         \
+		sum_of_squared_deviations(Real const* x, std::size_t n, Real mu) {                                             \
+			return sum_of_squared_deviations_kernel(x, n, mu);                                                         \
+		}                                                                                                              \
+		                                                                                                               \
+		attributes static std::size_t                                                                                  \
+		index_of_abs_max(Real const* x, std::size_t n) {                                                               \
+			return index_of_abs_max_kernel(x, n);                                                                      \
+		}                                                                                                              \
+		                                                                                                               \
+		attributes static void                                                                                         \
+		gemm(                                                                                                          \
+			std::size_t m, std::size_t n, std::size_t k,                                                               \
+			Real const* a, std::size_t lda, Real const* b, std::size_t ldb, Real * c, std::size_t ldc                  \
+		) {                                                                                                            \
+			gemm_kernel(m, n, k, a, lda, b, ldb, c, ldc);                                                              \
+		}                                                                                                              \
+		                                                                                                               \
+		static constexpr kernel_table<Real> table{                                                                     \
+			&multiply, &scale, &sum, &sum_of_squared_deviations, &index_of_abs_max, &gemm                              \
+		};                                                                                                             \
+	};
+
+HBRS_MPL_DETAIL_SIMD_KERNELS(generic_kernels, )
+#ifdef HBRS_MPL_DETAIL_SIMD_X86
+HBRS_MPL_DETAIL_SIMD_KERNELS(sse4_2_kernels, __attribute__((target("sse4.2"))))
+HBRS_MPL_DETAIL_SIMD_KERNELS(avx2_kernels, __attribute__((target("avx2,fma"))))
+HBRS_MPL_DETAIL_SIMD_KERNELS(avx512_kernels, __attribute__((target("avx512f,avx512dq,avx2,fma"))))
+#endif
+
+#undef HBRS_MPL_DETAIL_SIMD_KERNELS
+
+isa
+supported_isa() {
+#ifdef HBRS_MPL_DETAIL_SIMD_X86
+	static isa const level = []() {
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+			return isa::avx512;
+		} else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+			return isa::avx2;
+		} else if (__builtin_cpu_supports("sse4.2")) {
+			return isa::sse4_2;
+		}
+		return isa::generic;
+	}();
+	return level;
+#else
+	return isa::generic;
+#endif
+}
+
+static isa
+default_isa() {
+	char const* env = std::getenv("HBRS_MPL_ISA");
+	if (env != nullptr) {
+		for (isa level : { isa::generic, isa::sse4_2, isa::avx2, isa::avx512 }) {
+			if (std::strcmp(env, name(level)) == 0) {
+				return std::min(level, supported_isa());
+			}
+		}
+	}
+	return supported_isa();
+}
+
+static std::atomic<isa> &
+current_isa() {
+	static std::atomic<isa> level{default_isa()};
+	return level;
+}
+
+isa
+get_isa() {
+	return current_isa().load(std::memory_order_relaxed);
+}
+
+isa
+set_isa(isa level) {
+	level = std::min(level, supported_isa());
+	current_isa().store(level, std::memory_order_relaxed);
+	return level;
+}
+
+char const*
+name(isa level) {
+	switch (level) {
+		case isa::sse4_2: return "sse4.2";
+		case isa::avx2:   return "avx2";
+		case isa::avx512: return "avx512";
+		default:          return "generic";
+	}
+}
+
+template<typename Real>
+static kernel_table<Real> const&
+kernels() {
+	switch (get_isa()) {
+#ifdef HBRS_MPL_DETAIL_SIMD_X86
+		case isa::sse4_2: return sse4_2_kernels<Real>::table;
+		case isa::avx2:   return avx2_kernels<Real>::table;
+		case isa::avx512: return avx512_kernels<Real>::table;
+#endif
+		default:          return generic_kernels<Real>::table;
+	}
+}
+
+void
+multiply(float const* a, float const* b, float * c, std::size_t n) {
+	kernels<float>().multiply(a, b, c, n);
+}
+
+void
+multiply(double const* a, double const* b, double * c, std::size_t n) {
+	kernels<double>().multiply(a, b, c, n);
+}
+
+void
+scale(float * x, std::size_t n, float alpha) {
+	kernels<float>().scale(x, n, alpha);
+}
+
+void
+scale(double * x, std::size_t n, double alpha) {
+	kernels<double>().scale(x, n, alpha);
+}
+
+float
+sum(float const* x, std::size_t n) {
+	return kernels<float>().sum(x, n);
+}
+
+double
+sum(double const* x, std::size_t n) {
+	return kernels<double>().sum(x, n);
+}
+
+float
+sum_of_squared_deviations(float const* x, std::size_t n, float mu) {
+	return kernels<float>().sum_of_squared_deviations(x, n, mu);
+}
+
+double
+sum_of_squared_deviations(double const* x, std::size_t n, double mu) {
+	return kernels<double>().sum_of_squared_deviations(x, n, mu);
+}
+
+std::size_t
+index_of_abs_max(float const* x, std::size_t n) {
+	return kernels<float>().index_of_abs_max(x, n);
+}
+
+std::size_t
+index_of_abs_max(double const* x, std::size_t n) {
+	return kernels<double>().index_of_abs_max(x, n);
+}
+
+void
+gemm(
+	std::size_t m, std::size_t n, std::size_t k,
+	float const* a, std::size_t lda, float const* b, std::size_t ldb, float * c, std::size_t ldc
+) {
+	kernels<float>().gemm(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void
+gemm(
+	std::size_t m, std::size_t n, std::size_t k,
+	double const* a, std::size_t lda, double const* b, std::size_t ldb, double * c, std::size_t ldc
+) {
+	kernels<double>().gemm(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+/* namespace simd */ }
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
@@ -0,0 +1,141 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef HBRS_MPL_DETAIL_SIMD_IMPL_HPP
+#define HBRS_MPL_DETAIL_SIMD_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <cstddef>
+#include <type_traits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+namespace simd {
+
+/*
+ * Instruction set levels for which the kernels below are compiled. All levels are built into the same library and the
+ * kernels for the highest level which the cpu supports are chosen at runtime, so a single binary neither crashes with
+ * illegal instructions on older cpus nor wastes vector width on newer ones. Levels other than generic exist on x86
+ * only and with compilers that support __attribute__((target)), i.e. GCC and Clang.
+ *  generic - whatever the library has been compiled for, e.g. with -march
+ *  sse4_2  - SSE4.2
+ *  avx2    - AVX2 and FMA
+ *  avx512  - AVX-512F and AVX-512DQ
+ */
+enum class isa { generic, sse4_2, avx2, avx512 };
+
+/* Highest level which both the cpu and the library support */
+HBRS_MPL_API
+isa
+supported_isa();
+
+/*
+ * Level of the kernels which are used by subsequent calls. It can be lowered with set_isa() or with environment
+ * variable HBRS_MPL_ISA ("generic", "sse4.2", "avx2" or "avx512") which is read on first use, e.g. to reproduce
+ * results of reductions across machines with different vector widths. Levels above supported_isa() are clamped.
+ * Defaults to supported_isa().
+ */
+HBRS_MPL_API
+isa
+get_isa();
+
+/* Returns the level which has actually been set */
+HBRS_MPL_API
+isa
+set_isa(isa level);
+
+/* Name of the level as accepted by HBRS_MPL_ISA */
+HBRS_MPL_API
+char const*
+name(isa level);
+
+/* True if the kernels below are available for element type T */
+template<typename T>
+constexpr bool has_kernels_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/* c[i] = a[i] * b[i], c may alias a or b */
+HBRS_MPL_API
+void
+multiply(float const* a, float const* b, float * c, std::size_t n);
+
+HBRS_MPL_API
+void
+multiply(double const* a, double const* b, double * c, std::size_t n);
+
+/* x[i] *= alpha */
+HBRS_MPL_API
+void
+scale(float * x, std::size_t n, float alpha);
+
+HBRS_MPL_API
+void
+scale(double * x, std::size_t n, double alpha);
+
+/* Sum of x[0..n), summands are reordered, hence the result depends on get_isa() */
+HBRS_MPL_API
+float
+sum(float const* x, std::size_t n);
+
+HBRS_MPL_API
+double
+sum(double const* x, std::size_t n);
+
+/* Sum of (x[i] - mu)^2 over [0..n), summands are reordered like in sum() */
+HBRS_MPL_API
+float
+sum_of_squared_deviations(float const* x, std::size_t n, float mu);
+
+HBRS_MPL_API
+double
+sum_of_squared_deviations(double const* x, std::size_t n, double mu);
+
+/* Index of the first element with the largest absolute value, NaNs are skipped. Returns n if there is none. */
+HBRS_MPL_API
+std::size_t
+index_of_abs_max(float const* x, std::size_t n);
+
+HBRS_MPL_API
+std::size_t
+index_of_abs_max(double const* x, std::size_t n);
+
+/*
+ * c = a * b for small row-major matrices a (m x k), b (k x n) and c (m x n) with leading dimensions lda, ldb and ldc.
+ * Each row of c is accumulated from scaled rows of b, i.e. the entries of c are summed up in the order of k. The avx2
+ * and avx512 kernels are compiled with FMA and GCC contracts their multiply-adds, which skips the rounding of the
+ * products, hence results differ bitwise from the generic and sse4.2 kernels. Set HBRS_MPL_ISA=generic (see get_isa())
+ * for bitwise reproducible results across machines.
+ */
+HBRS_MPL_API
+void
+gemm(
+	std::size_t m, std::size_t n, std::size_t k,
+	float const* a, std::size_t lda, float const* b, std::size_t ldb, float * c, std::size_t ldc);
+
+HBRS_MPL_API
+void
+gemm(
+	std::size_t m, std::size_t n, std::size_t k,
+	double const* a, std::size_t lda, double const* b, std::size_t ldb, double * c, std::size_t ldc);
+
+/* namespace simd */ }
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_SIMD_IMPL_HPP
@@ -0,0 +1,162 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#define BOOST_TEST_MODULE simd_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/simd.hpp>
+#include <boost/mpl/list.hpp>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(simd_test)
+
+typedef boost::mpl::list<float, double> real_types;
+
+/* Runs f once for each level which the cpu supports and restores the previous level afterwards */
+template<typename F>
+static void
+for_each_supported_isa(F && f) {
+	using namespace hbrs::mpl::detail::simd;
+	
+	isa const previous = get_isa();
+	for (isa level : { isa::generic, isa::sse4_2, isa::avx2, isa::avx512 }) {
+		if (level > supported_isa()) {
+			break;
+		}
+		BOOST_TEST_CONTEXT("isa " << name(level)) {
+			BOOST_TEST((set_isa(level) == level));
+			f();
+		}
+	}
+	set_isa(previous);
+}
+
+BOOST_AUTO_TEST_CASE(levels) {
+	using namespace hbrs::mpl::detail::simd;
+	
+	BOOST_TEST((get_isa() <= supported_isa()));
+	
+	isa const previous = get_isa();
+	BOOST_TEST((set_isa(isa::avx512) == supported_isa()));
+	BOOST_TEST((set_isa(isa::generic) == isa::generic));
+	BOOST_TEST((get_isa() == isa::generic));
+	set_isa(previous);
+	
+	BOOST_TEST(name(isa::generic) == "generic");
+	BOOST_TEST(name(isa::sse4_2) == "sse4.2");
+	BOOST_TEST(name(isa::avx2) == "avx2");
+	BOOST_TEST(name(isa::avx512) == "avx512");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(elementwise, Real, real_types) {
+	using namespace hbrs::mpl::detail;
+	
+	// odd lengths leave remainders after the vectorized loops
+	for (std::size_t n : {0u, 1u, 7u, 33u, 1001u}) {
+		std::vector<Real> a(n), b(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			a[i] = Real(i % 17) - 8;
+			b[i] = Real(i % 5) / 4;
+		}
+		
+		for_each_supported_isa([&]() {
+			std::vector<Real> c(n);
+			simd::multiply(a.data(), b.data(), c.data(), n);
+			for (std::size_t i = 0; i < n; ++i) {
+				BOOST_TEST(c[i] == a[i] * b[i]);
+			}
+			
+			simd::scale(c.data(), n, Real(-2));
+			for (std::size_t i = 0; i < n; ++i) {
+				BOOST_TEST(c[i] == a[i] * b[i] * -2);
+			}
+		});
+	}
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(reductions, Real, real_types) {
+	using namespace hbrs::mpl::detail;
+	
+	Real const nan = std::numeric_limits<Real>::quiet_NaN();
+	
+	for (std::size_t n : {1u, 7u, 33u, 1001u}) {
+		// small integers are summed up exactly in any order
+		std::vector<Real> x(n);
+		Real expected_sum = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			x[i] = Real(i % 9) - 3;
+			expected_sum += x[i];
+		}
+		Real const mu = 2;
+		Real expected_ssd = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			expected_ssd += (x[i] - mu) * (x[i] - mu);
+		}
+		
+		for_each_supported_isa([&]() {
+			BOOST_TEST(simd::sum(x.data(), n) == expected_sum);
+			BOOST_TEST(simd::sum_of_squared_deviations(x.data(), n, mu) == expected_ssd);
+			
+			std::vector<Real> y(n, Real(1));
+			y[n/2] = -5;
+			if (n > 2) {
+				y[n-1] = 5;
+			}
+			BOOST_TEST(simd::index_of_abs_max(y.data(), n) == n/2);
+			
+			// NaN is skipped, a column of NaNs has no maximum
+			y[n/2] = nan;
+			BOOST_TEST(simd::index_of_abs_max(y.data(), n) == (n > 2 ? n-1 : (n > 1 ? 0 : n)));
+		});
+	}
+	
+	BOOST_TEST(simd::index_of_abs_max(static_cast<Real const*>(nullptr), 0) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(small_gemm, Real, real_types) {
+	using namespace hbrs::mpl::detail;
+	
+	std::size_t const m = 5, k = 7, n = 19, ldc = n + 3;
+	std::vector<Real> a(m*k), b(k*n);
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		a[i] = Real(i % 7) - 3;
+	}
+	for (std::size_t i = 0; i < b.size(); ++i) {
+		b[i] = Real(i % 11) / 2;
+	}
+	
+	for_each_supported_isa([&]() {
+		std::vector<Real> c(m*ldc, std::numeric_limits<Real>::quiet_NaN());
+		simd::gemm(m, n, k, a.data(), k, b.data(), n, c.data(), ldc);
+		for (std::size_t i = 0; i < m; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				Real expected = 0;
+				for (std::size_t l = 0; l < k; ++l) {
+					expected += a[i*k+l] * b[l*n+j];
+				}
+				BOOST_TEST(c[i*ldc+j] == expected);
+			}
+		}
+	});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
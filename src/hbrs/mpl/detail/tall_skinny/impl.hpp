@@ -0,0 +1,249 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef HBRS_MPL_DETAIL_TALL_SKINNY_IMPL_HPP
+#define HBRS_MPL_DETAIL_TALL_SKINNY_IMPL_HPP
+
+#include <hbrs/mpl/config.hpp>
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+#include <hbrs/mpl/detail/async.hpp>
+#include <hbrs/mpl/detail/hierarchical.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/reduction.hpp>
+#include <hbrs/mpl/detail/simd.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <El.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+namespace detail {
+
+/* Matrices with at least this many rows per column are handled with 1D row distributions, see is_tall_skinny() */
+constexpr El::Int tall_skinny_min_aspect_ratio = 8;
+
+/* n x n factors like R, V or A'*A are replicated on all processes, hence the number of columns is bounded */
+constexpr El::Int tall_skinny_max_width = 4096;
+
+constexpr bool
+is_tall_skinny(El::Int m, El::Int n) {
+	return (n > 0) && (n <= tall_skinny_max_width) && (m >= tall_skinny_min_aspect_ratio * n);
+}
+
+/*
+ * True if each process owns complete rows of a matrix with the given distribution, e.g. [VC,STAR], [MC,STAR] or
+ * [STAR,STAR]. Column-wise reductions of such matrices need one reduction over the column communicator only and
+ * products with small [STAR,STAR] factors need no communication at all.
+ */
+template<El::Dist Columnwise, El::Dist Rowwise>
+constexpr bool is_row_distributed_v = (Rowwise == El::STAR) && (Columnwise != El::MD) && (Columnwise != El::CIRC);
+
+/*
+ * Elemental's TSQR (El::qr::ExplicitTS) reduces the local R factors of all processes in a binary tree, which requires
+ * a power-of-two number of processes, each owning at least as many rows as the matrix has columns.
+ */
+inline bool
+is_tsqr_applicable(El::Int m, El::Int n, El::Grid const& grid) {
+	El::Int const p = grid.Size();
+	return is_tall_skinny(m, n) && ((p & (p-1)) == 0) && (m >= n * p);
+}
+
+/* Redistributes a matrix to [VC,STAR], i.e. rows are distributed cyclically to all processes of the grid */
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+El::DistMatrix<Ring, El::VC, El::STAR>
+to_vc_star(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a) {
+	El::DistMatrix<Ring, El::VC, El::STAR> b{a.Grid()};
+	El::Copy(a, b);
+	return b;
+}
+
+template<typename Ring>
+El::DistMatrix<Ring, El::VC, El::STAR>
+to_vc_star(El::DistMatrix<Ring, El::VC, El::STAR> && a) {
+	return std::move(a);
+}
+
+/*
+ * Columns per panel, the reduction of a panel is in flight while the sums of the next panel are computed. Matrices are
+ * split into at least four panels of 64 to 512 columns, so tall-skinny matrices with a few hundred columns overlap,
+ * too. Matrices with at most 64 columns are reduced at once.
+ */
+inline El::Int
+column_sums_panel_width(El::Int n) {
+	return std::clamp<El::Int>((n + 3) / 4, 64, 512);
+}
+
+/* Sums of all columns of a row-distributed matrix, reduced over the column communicator and returned as a 1 x n row.
+ * Real sums are reduced in overlapping panels or, if the column communicator spans several multi-rank nodes and the
+ * sums are large enough, at once with hierarchical_allreduce().
+ */
+template<typename Ring, El::Dist Columnwise, El::DistWrap Wrapping>
+El::DistMatrix<Ring, El::STAR, El::STAR>
+column_sums(El::DistMatrix<Ring, Columnwise, El::STAR, Wrapping> const& a) {
+	static_assert(is_row_distributed_v<Columnwise, El::STAR>, "");
+	
+	El::Matrix<Ring> const& a_lcl = a.LockedMatrix();
+	El::Int const a_lcl_m = a_lcl.Height();
+	El::Int const a_n = a_lcl.Width();
+	El::Int const a_lcl_ldim = a_lcl.LDim();
+	Ring const* a_lcl_buf = a_lcl.LockedBuffer();
+	
+	std::vector<Ring> buf(boost::numeric_cast<std::size_t>(a_n), Ring(0));
+	
+	auto local_sums = [&](El::Int j_begin, El::Int j_end) {
+		EL_PARALLEL_FOR
+		for(El::Int j = j_begin; j < j_end; ++j) {
+			if constexpr (simd::has_kernels_v<Ring>) {
+				buf[j] = simd::sum(a_lcl_buf + j*a_lcl_ldim, boost::numeric_cast<std::size_t>(a_lcl_m));
+				continue;
+			}
+			
+			Ring sum = 0;
+			EL_SIMD
+			for(El::Int i = 0; i < a_lcl_m; ++i) {
+				sum += a_lcl_buf[i+j*a_lcl_ldim];
+			}
+			buf[j] = sum;
+		}
+	};
+	
+	if constexpr (El::IsComplex<Ring>::value) {
+		local_sums(0, a_n);
+		El::mpi::AllReduce(buf.data(), boost::numeric_cast<int>(buf.size()), El::mpi::SUM, a.ColComm());
+	} else {
+		MPI_Comm const comm = a.ColComm().comm;
+		if (mpi::prefers_hierarchical_allreduce(buf.size() * sizeof(Ring), comm)) {
+			// on several nodes with several ranks each, one node-aware reduction beats overlapping flat reductions
+			local_sums(0, a_n);
+			mpi::hierarchical_allreduce(
+				MPI_IN_PLACE, buf.data(), buf.size(), mpi::datatype(hana::type_c<Ring>), MPI_SUM, comm);
+		} else {
+			mpi::pipeline pl;
+			El::Int const panel_width = column_sums_panel_width(a_n);
+			for(El::Int j = 0; j < a_n; j += panel_width) {
+				El::Int const j_end = std::min(a_n, j + panel_width);
+				local_sums(j, j_end);
+				pl.push(mpi::request{mpi::iallreduce(
+					MPI_IN_PLACE, buf.data() + j, boost::numeric_cast<std::size_t>(j_end - j),
+					mpi::datatype(hana::type_c<Ring>), MPI_SUM, comm
+				)});
+			}
+			pl.finish();
+		}
+	}
+	
+	El::DistMatrix<Ring, El::STAR, El::STAR> sums{a.Grid()};
+	El::Zeros(sums, 1, a_n);
+	for(El::Int j = 0; j < a_n; ++j) {
+		sums.SetLocal(0, j, buf[j]);
+	}
+	
+	return sums;
+}
+
+/*
+ * Sums and sums of squared deviations from the mean of all columns of a row-distributed real matrix, computed with a
+ * single reduction and returned as 1 x n rows.
+ *
+ * Each process computes the count, mean and sum of squared deviations M2_r of its m_r local rows in two passes. These
+ * triples are merged pairwise by the reduction itself, see welford_merge, so that only the differences of the means
+ * suffer from cancellation instead of the whole sum of squares as in the textbook formula sum x^2 - s^2/m.
+ */
+template<typename Ring, El::Dist Columnwise, El::DistWrap Wrapping>
+std::pair<El::DistMatrix<Ring, El::STAR, El::STAR>, El::DistMatrix<Ring, El::STAR, El::STAR>>
+column_moments(El::DistMatrix<Ring, Columnwise, El::STAR, Wrapping> const& a) {
+	static_assert(is_row_distributed_v<Columnwise, El::STAR>, "");
+	static_assert(!El::IsComplex<Ring>::value, "");
+	
+	El::Matrix<Ring> const& a_lcl = a.LockedMatrix();
+	El::Int const a_lcl_m = a_lcl.Height();
+	El::Int const a_n = a_lcl.Width();
+	El::Int const a_lcl_ldim = a_lcl.LDim();
+	Ring const* a_lcl_buf = a_lcl.LockedBuffer();
+	
+	// streaming workloads compute moments of many batches with the same width, which reuse buffer and plan
+	static thread_local mpi::allreduce_buffer<welford<Ring>> reduction;
+	welford<Ring> * moments = reduction.bind(
+		boost::numeric_cast<std::size_t>(a_n),
+		mpi::datatype(hana::type_c<welford<Ring>>), mpi::op(hana::type_c<welford<Ring>>, welford_merge{}),
+		a.ColComm().comm);
+	std::fill_n(moments, a_n, welford<Ring>{0, 0, 0});
+	
+	EL_PARALLEL_FOR
+	for(El::Int j = 0; j < a_n; ++j) {
+		if (a_lcl_m == 0) {
+			continue;
+		}
+		
+		Ring const* col = a_lcl_buf + j*a_lcl_ldim;
+		
+		if constexpr (simd::has_kernels_v<Ring>) {
+			std::size_t const col_m = boost::numeric_cast<std::size_t>(a_lcl_m);
+			Ring const mu = simd::sum(col, col_m) / a_lcl_m;
+			moments[j] = welford<Ring>{Ring(a_lcl_m), mu, simd::sum_of_squared_deviations(col, col_m, mu)};
+			continue;
+		}
+		
+		Ring sum = 0;
+		EL_SIMD
+		for(El::Int i = 0; i < a_lcl_m; ++i) {
+			sum += col[i];
+		}
+		
+		Ring const mu = sum / a_lcl_m;
+		Ring m2 = 0;
+		EL_SIMD
+		for(El::Int i = 0; i < a_lcl_m; ++i) {
+			m2 += (col[i] - mu) * (col[i] - mu);
+		}
+		
+		moments[j] = welford<Ring>{Ring(a_lcl_m), mu, m2};
+	}
+	
+	MPI_Comm const comm = a.ColComm().comm;
+	std::size_t const count = boost::numeric_cast<std::size_t>(a_n);
+	if (mpi::prefers_hierarchical_allreduce(count * sizeof(welford<Ring>), comm)) {
+		// several ranks per node merge their moments through shared memory before the nodes exchange them
+		mpi::hierarchical_allreduce(
+			MPI_IN_PLACE, moments, count,
+			mpi::datatype(hana::type_c<welford<Ring>>), mpi::op(hana::type_c<welford<Ring>>, welford_merge{}), comm);
+	} else {
+		reduction.plan().execute();
+	}
+	
+	El::DistMatrix<Ring, El::STAR, El::STAR> sums{a.Grid()}, m2s{a.Grid()};
+	El::Zeros(sums, 1, a_n);
+	El::Zeros(m2s, 1, a_n);
+	
+	for(El::Int j = 0; j < a_n; ++j) {
+		sums.SetLocal(0, j, moments[j].count * moments[j].mean);
+		m2s.SetLocal(0, j, moments[j].m2);
+	}
+	
+	return { std::move(sums), std::move(m2s) };
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+#endif // !HBRS_MPL_DETAIL_TALL_SKINNY_IMPL_HPP
@@ -0,0 +1,196 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "impl.hpp"
+
+#include <boost/assert.hpp>
+#include <cstdlib>
+#ifdef __linux__
+	#include <sched.h>
+#endif
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+namespace {
+
+std::mutex instance_mutex;
+std::unique_ptr<thread_pool> instance_;
+/* instance_.get() for lock-free lookups by task groups and grain sizes */
+std::atomic<thread_pool *> cached_instance{nullptr};
+std::size_t concurrency_ = 0;
+
+/* pool and queue index of the calling thread, if it is a worker */
+thread_local thread_pool * current_pool = nullptr;
+thread_local std::size_t current_queue = 0;
+
+/* Threads requested with OMP_NUM_THREADS, else cpus in the affinity mask of the process, else 1. MPI launchers bind each
+ * rank to its share of the cores, hence pure MPI runs do not oversubscribe nodes.
+ */
+std::size_t
+default_concurrency() {
+	char const* env = std::getenv("OMP_NUM_THREADS");
+	if (env != nullptr) {
+		long const threads = std::strtol(env, nullptr, 10);
+		if (threads > 0) {
+			return static_cast<std::size_t>(threads);
+		}
+	}
+	
+#ifdef __linux__
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0) {
+		return std::max(1, CPU_COUNT(&cpus));
+	}
+#endif
+	return 1;
+}
+
+/* namespace */ }
+
+std::size_t
+concurrency() {
+	std::lock_guard<std::mutex> lock{instance_mutex};
+	return concurrency_ > 0 ? concurrency_ : default_concurrency();
+}
+
+void
+set_concurrency(std::size_t threads) {
+	std::lock_guard<std::mutex> lock{instance_mutex};
+	concurrency_ = threads;
+	if (instance_ && instance_->size() != (threads > 0 ? threads : default_concurrency())) {
+		cached_instance.store(nullptr, std::memory_order_release);
+		instance_.reset();
+	}
+}
+
+thread_pool::thread_pool(std::size_t threads) : queues_{}, workers_{}, queued_{0}, stop_{false} {
+	threads = std::max<std::size_t>(threads, 1);
+	for (std::size_t i = 0; i < threads; ++i) {
+		queues_.push_back(std::make_unique<queue>());
+	}
+	
+	for (std::size_t i = 1; i < threads; ++i) {
+		workers_.emplace_back([this, i]() { work(i); });
+	}
+}
+
+thread_pool::~thread_pool() {
+	{
+		std::lock_guard<std::mutex> lock{sleep_mutex_};
+		stop_ = true;
+	}
+	wakeup_.notify_all();
+	
+	for (auto & worker : workers_) {
+		worker.join();
+	}
+}
+
+thread_pool&
+thread_pool::instance() {
+	thread_pool * pool = cached_instance.load(std::memory_order_acquire);
+	if (pool != nullptr) {
+		return *pool;
+	}
+	
+	std::lock_guard<std::mutex> lock{instance_mutex};
+	if (!instance_) {
+		instance_ = std::make_unique<thread_pool>(concurrency_ > 0 ? concurrency_ : default_concurrency());
+		cached_instance.store(instance_.get(), std::memory_order_release);
+	}
+	return *instance_;
+}
+
+void
+thread_pool::submit(task t) {
+	std::size_t const self = current_pool == this ? current_queue : 0;
+	{
+		std::lock_guard<std::mutex> lock{queues_[self]->mutex};
+		queues_[self]->tasks.push_back(std::move(t));
+	}
+	{
+		std::lock_guard<std::mutex> lock{sleep_mutex_};
+		queued_.fetch_add(1, std::memory_order_release);
+	}
+	wakeup_.notify_one();
+}
+
+bool
+thread_pool::take(std::size_t self, task & t) {
+	if (self != 0) {
+		queue & own = *queues_[self];
+		std::lock_guard<std::mutex> lock{own.mutex};
+		if (!own.tasks.empty()) {
+			t = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			queued_.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	
+	for (std::size_t i = 1; i <= queues_.size(); ++i) {
+		queue & victim = *queues_[(self + i) % queues_.size()];
+		std::lock_guard<std::mutex> lock{victim.mutex};
+		if (!victim.tasks.empty()) {
+			t = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			queued_.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+thread_pool::run_one() {
+	if (queued_.load(std::memory_order_acquire) <= 0) {
+		return false;
+	}
+	
+	task t;
+	if (!take(current_pool == this ? current_queue : 0, t)) {
+		return false;
+	}
+	t();
+	return true;
+}
+
+void
+thread_pool::work(std::size_t self) {
+	current_pool = this;
+	current_queue = self;
+	
+	task t;
+	while (true) {
+		if (take(self, t)) {
+			t();
+			t = nullptr;
+			continue;
+		}
+		
+		std::unique_lock<std::mutex> lock{sleep_mutex_};
+		wakeup_.wait(lock, [this]() { return stop_ || queued_.load(std::memory_order_acquire) > 0; });
+		if (stop_ && queued_.load(std::memory_order_acquire) <= 0) {
+			return;
+		}
+	}
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
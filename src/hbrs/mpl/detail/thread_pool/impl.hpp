@@ -0,0 +1,294 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DETAIL_THREAD_POOL_IMPL_HPP
+#define HBRS_MPL_DETAIL_THREAD_POOL_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/*
+ * Number of threads, including the calling thread, which the native (hbrs_mpl) kernels use at most. Defaults to
+ * OMP_NUM_THREADS if set and else to the number of cpus which the process is bound to, e.g. one per rank for pure MPI
+ * runs. environment sets it to execution_control::threads_per_rank() if that is nonzero. Passing 0 to
+ * set_concurrency() restores the default.
+ *
+ * Changing the concurrency replaces the global thread pool, so set_concurrency() must not be called while parallel
+ * work is running, e.g. call it once at startup.
+ */
+HBRS_MPL_API
+std::size_t
+concurrency();
+
+HBRS_MPL_API
+void
+set_concurrency(std::size_t threads);
+
+/*
+ * Work-stealing thread pool without any OpenMP dependency.
+ *
+ * Each worker owns a deque of tasks: it pushes and pops tasks at the back (LIFO, which keeps the data of recently
+ * forked tasks in cache) while idle workers steal from the front of other deques (FIFO, which takes the largest pieces
+ * of a recursively split range first). Tasks submitted by threads outside of the pool go to a shared deque which all
+ * workers steal from. A pool of size() threads has size()-1 workers, because the thread which waits for its tasks
+ * executes tasks, too, see run_one().
+ */
+class HBRS_MPL_API thread_pool {
+public:
+	typedef std::function<void()> task;
+	
+	explicit thread_pool(std::size_t threads);
+	~thread_pool();
+	
+	thread_pool(thread_pool const&) = delete;
+	thread_pool&
+	operator=(thread_pool const&) = delete;
+	
+	/* Global pool with concurrency() threads, created on first use */
+	static thread_pool&
+	instance();
+	
+	/* Number of threads which execute tasks, i.e. workers plus the waiting thread */
+	std::size_t
+	size() const { return queues_.size(); }
+	
+	void
+	submit(task t);
+	
+	/* Executes one pending task, if any, on the calling thread and returns whether a task has been executed */
+	bool
+	run_one();
+	
+private:
+	struct queue {
+		std::mutex mutex;
+		std::deque<task> tasks;
+	};
+	
+	bool
+	take(std::size_t self, task & t);
+	
+	void
+	work(std::size_t self);
+	
+	/* queues_[0] is shared by all threads outside of the pool, queues_[i] is owned by worker i */
+	std::vector<std::unique_ptr<queue>> queues_;
+	std::vector<std::thread> workers_;
+	std::atomic<long> queued_;
+	std::mutex sleep_mutex_;
+	std::condition_variable wakeup_;
+	bool stop_;
+};
+
+/*
+ * Fork-join group of tasks. run() forks a task, wait() joins all tasks forked so far and rethrows the first exception
+ * thrown by any of them. While waiting, the calling thread executes pending tasks of the pool, hence task groups can be
+ * nested arbitrarily, e.g. in recursive algorithms, without blocking workers.
+ */
+class task_group {
+public:
+	task_group() : task_group{thread_pool::instance()} {}
+	explicit task_group(thread_pool & pool) : pool_{pool}, pending_{0}, error_{} {}
+	
+	task_group(task_group const&) = delete;
+	task_group&
+	operator=(task_group const&) = delete;
+	
+	~task_group() {
+		join();
+	}
+	
+	template<typename F>
+	void
+	run(F && f) {
+		if (pool_.size() == 1) {
+			invoke(f);
+			return;
+		}
+		
+		pending_.fetch_add(1, std::memory_order_relaxed);
+		pool_.submit([this, f = std::forward<F>(f)]() mutable {
+			invoke(f);
+			pending_.fetch_sub(1, std::memory_order_release);
+		});
+	}
+	
+	void
+	wait() {
+		join();
+		if (error_) {
+			std::exception_ptr error = std::move(error_);
+			error_ = nullptr;
+			std::rethrow_exception(error);
+		}
+	}
+	
+private:
+	template<typename F>
+	void
+	invoke(F & f) {
+		try {
+			f();
+		} catch (...) {
+			std::lock_guard<std::mutex> lock{error_mutex_};
+			if (!error_) {
+				error_ = std::current_exception();
+			}
+		}
+	}
+	
+	void
+	join() {
+		while (pending_.load(std::memory_order_acquire) > 0) {
+			if (!pool_.run_one()) {
+				std::this_thread::yield();
+			}
+		}
+	}
+	
+	thread_pool & pool_;
+	std::atomic<std::size_t> pending_;
+	std::mutex error_mutex_;
+	std::exception_ptr error_;
+};
+
+/* Executes f() and g() in parallel and returns when both have completed */
+template<typename F, typename G>
+void
+parallel_invoke(F && f, G && g) {
+	task_group group;
+	group.run(std::forward<G>(g));
+	f();
+	group.wait();
+}
+
+/* Default grain size which splits [first,last) into about four chunks per thread for load balancing */
+inline std::size_t
+default_grain_size(std::size_t first, std::size_t last) {
+	std::size_t const chunks = 4 * thread_pool::instance().size();
+	return std::max<std::size_t>(1, (last - first + chunks - 1) / chunks);
+}
+
+/* Minimal number of scalar operations per task, smaller tasks cost more to fork than they save */
+constexpr std::size_t parallel_min_work = std::size_t{1} << 15;
+
+/* Grain size for parallel_for() and parallel_reduce() over n elements which take work_per_element operations each */
+inline std::size_t
+grain_size(std::size_t n, std::size_t work_per_element) {
+	work_per_element = std::max<std::size_t>(work_per_element, 1);
+	return std::max(default_grain_size(0, n), (parallel_min_work + work_per_element - 1) / work_per_element);
+}
+
+template<typename F>
+void
+parallel_for_impl(thread_pool & pool, std::size_t first, std::size_t last, std::size_t grain, F const& f) {
+	task_group group{pool};
+	while (last - first > grain) {
+		std::size_t const mid = first + (last - first) / 2;
+		group.run([&pool, mid, last, grain, &f]() { parallel_for_impl(pool, mid, last, grain, f); });
+		last = mid;
+	}
+	f(first, last);
+	group.wait();
+}
+
+/*
+ * Calls f(begin, end) for disjoint subranges [begin,end) which cover [first,last). The range is halved recursively
+ * until subranges have at most grain elements, so idle threads steal large subranges and split them further. A grain
+ * size of 0 picks default_grain_size().
+ */
+template<typename F>
+void
+parallel_for(std::size_t first, std::size_t last, std::size_t grain, F const& f) {
+	if (last <= first) {
+		return;
+	}
+	
+	if (grain == 0) {
+		grain = default_grain_size(first, last);
+	}
+	
+	thread_pool & pool = thread_pool::instance();
+	if (last - first <= grain || pool.size() == 1) {
+		f(first, last);
+		return;
+	}
+	
+	parallel_for_impl(pool, first, last, grain, f);
+}
+
+template<typename T, typename Map, typename Combine>
+T
+parallel_reduce_impl(
+	thread_pool & pool, std::size_t first, std::size_t last, std::size_t grain, T const& identity, Map const& map,
+	Combine const& combine
+) {
+	if (last - first <= grain) {
+		return map(first, last, identity);
+	}
+	
+	std::size_t const mid = first + (last - first) / 2;
+	T right = identity;
+	task_group group{pool};
+	group.run([&]() { right = parallel_reduce_impl(pool, mid, last, grain, identity, map, combine); });
+	T left = parallel_reduce_impl(pool, first, mid, grain, identity, map, combine);
+	group.wait();
+	return combine(std::move(left), std::move(right));
+}
+
+/*
+ * Reduces [first,last) by computing map(begin, end, identity) for subranges like parallel_for() and merging the partial
+ * results pairwise with combine(left, right). Partial results are always combined in the same tree, hence results of
+ * floating-point reductions are reproducible for a given grain size, regardless of which threads computed them.
+ */
+template<typename T, typename Map, typename Combine>
+T
+parallel_reduce(
+	std::size_t first, std::size_t last, std::size_t grain, T const& identity, Map const& map, Combine const& combine
+) {
+	if (last <= first) {
+		return identity;
+	}
+	
+	if (grain == 0) {
+		grain = default_grain_size(first, last);
+	}
+	
+	return parallel_reduce_impl(thread_pool::instance(), first, last, grain, identity, map, combine);
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_THREAD_POOL_IMPL_HPP
@@ -0,0 +1,126 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE thread_pool_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/thread_pool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(thread_pool_test)
+
+BOOST_AUTO_TEST_CASE(parallel_for_covers_range) {
+	using namespace hbrs::mpl::detail;
+	
+	for (std::size_t threads : { 1u, 2u, 4u }) {
+		set_concurrency(threads);
+		BOOST_TEST(concurrency() == threads);
+		BOOST_TEST(thread_pool::instance().size() == threads);
+		
+		for (std::size_t grain : { 0u, 1u, 7u, 1000u }) {
+			std::vector<int> hits(997, 0);
+			parallel_for(0, hits.size(), grain, [&hits](std::size_t begin, std::size_t end) {
+				for (std::size_t i = begin; i < end; ++i) {
+					++hits[i];
+				}
+			});
+			BOOST_TEST(std::all_of(hits.begin(), hits.end(), [](int h) { return h == 1; }));
+		}
+	}
+	set_concurrency(0);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_reduce_is_reproducible) {
+	using namespace hbrs::mpl::detail;
+	
+	std::vector<double> x(10000);
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		x[i] = 1. / (i + 1.);
+	}
+	
+	auto sum = [&x]() {
+		return parallel_reduce(
+			0, x.size(), 64, 0.,
+			[&x](std::size_t begin, std::size_t end, double init) {
+				return std::accumulate(x.begin() + begin, x.begin() + end, init);
+			},
+			[](double lhs, double rhs) { return lhs + rhs; }
+		);
+	};
+	
+	set_concurrency(1);
+	double const serial = sum();
+	set_concurrency(4);
+	for (int run = 0; run < 10; ++run) {
+		BOOST_TEST(sum() == serial, boost::test_tools::tolerance(0.));
+	}
+	BOOST_TEST(serial == std::accumulate(x.begin(), x.end(), 0.), boost::test_tools::tolerance(1e-12));
+	set_concurrency(0);
+}
+
+BOOST_AUTO_TEST_CASE(task_group_nested) {
+	using namespace hbrs::mpl::detail;
+	set_concurrency(4);
+	
+	std::function<long(long)> fib = [&fib](long n) -> long {
+		if (n < 2) {
+			return n;
+		}
+		long a, b;
+		parallel_invoke([&]() { a = fib(n-1); }, [&]() { b = fib(n-2); });
+		return a + b;
+	};
+	BOOST_TEST(fib(20) == 6765);
+	
+	std::atomic<int> count{0};
+	parallel_for(0, 64, 1, [&count](std::size_t, std::size_t) {
+		parallel_for(0, 64, 1, [&count](std::size_t, std::size_t) { ++count; });
+	});
+	BOOST_TEST(count.load() == 64 * 64);
+	set_concurrency(0);
+}
+
+BOOST_AUTO_TEST_CASE(task_group_exception) {
+	using namespace hbrs::mpl::detail;
+	set_concurrency(4);
+	
+	std::atomic<int> count{0};
+	task_group group;
+	for (int i = 0; i < 100; ++i) {
+		group.run([i, &count]() {
+			++count;
+			if (i == 42) {
+				throw std::runtime_error{"42"};
+			}
+		});
+	}
+	BOOST_CHECK_THROW(group.wait(), std::runtime_error);
+	BOOST_TEST(count.load() == 100);
+	
+	group.run([&count]() { ++count; });
+	BOOST_CHECK_NO_THROW(group.wait());
+	BOOST_TEST(count.load() == 101);
+	set_concurrency(0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,64 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "impl.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+static validation_level
+default_validation_level() {
+	char const* env = std::getenv("HBRS_MPL_VALIDATION");
+	if (env != nullptr) {
+		if (std::strcmp(env, "off") == 0) {
+			return validation_level::off;
+		} else if (std::strcmp(env, "input") == 0) {
+			return validation_level::input;
+		} else if (std::strcmp(env, "all") == 0) {
+			return validation_level::all;
+		}
+	}
+	
+#ifdef NDEBUG
+	return validation_level::input;
+#else
+	return validation_level::all;
+#endif
+}
+
+static std::atomic<validation_level> &
+current_validation_level() {
+	static std::atomic<validation_level> level{default_validation_level()};
+	return level;
+}
+
+validation_level
+get_validation_level() {
+	return current_validation_level().load(std::memory_order_relaxed);
+}
+
+void
+set_validation_level(validation_level level) {
+	current_validation_level().store(level, std::memory_order_relaxed);
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
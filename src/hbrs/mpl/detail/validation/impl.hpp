@@ -0,0 +1,159 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DETAIL_VALIDATION_IMPL_HPP
+#define HBRS_MPL_DETAIL_VALIDATION_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/dt/exception.hpp>
+#include <hbrs/mpl/detail/hierarchical.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/throw_exception.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+	#include <El.hpp>
+#endif
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/*
+ * Controls which checks for NaN and Inf values are done at runtime:
+ *  off   - no checks at all
+ *  input - arguments passed to functions like pca() are checked, results of intermediate steps are not
+ *  all   - arguments and results of intermediate steps are checked
+ *
+ * The level can be set with set_validation_level() or with environment variable HBRS_MPL_VALIDATION ("off", "input"
+ * or "all") which is read on first use. Defaults to 'input' if NDEBUG is defined and to 'all' otherwise.
+ *
+ * Checks of distributed matrices are collective, so the level has to be the same on all ranks. environment adopts the
+ * level of rank 0 on all ranks during setup, later calls to set_validation_level() have to be made on all ranks alike.
+ */
+enum class validation_level { off, input, all };
+
+HBRS_MPL_API
+validation_level
+get_validation_level();
+
+HBRS_MPL_API
+void
+set_validation_level(validation_level level);
+
+/* True if checks for the given stage (input or all) are enabled */
+inline bool
+validates(validation_level stage) {
+	return get_validation_level() >= stage;
+}
+
+/* Entries per block, a column is only scanned up to the end of the first block which contains NaN or Inf */
+constexpr std::size_t all_finite_block_size = 1024;
+
+/*
+ * Returns false if any entry of a column-major buffer is NaN or Inf.
+ *
+ * NaN and Inf both turn into NaN when multiplied by zero while finite values turn into zero, so a single sum per block
+ * tests for both without branches in the inner loop, which can thus be vectorized.
+ */
+template<typename Real>
+std::enable_if_t<std::is_floating_point_v<Real>, bool>
+all_finite(Real const* buf, std::size_t m, std::size_t n, std::size_t ldim) {
+	for (std::size_t j = 0; j < n; ++j) {
+		Real const* col = buf + j*ldim;
+		for (std::size_t i0 = 0; i0 < m; i0 += all_finite_block_size) {
+			std::size_t const i1 = std::min(m, i0 + all_finite_block_size);
+			Real acc = 0;
+#ifdef _OPENMP
+			#pragma omp simd reduction(+:acc)
+#endif
+			for (std::size_t i = i0; i < i1; ++i) {
+				acc += col[i] * Real(0);
+			}
+			
+			if (std::isnan(acc)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+template<typename Real>
+bool
+all_finite(std::complex<Real> const* buf, std::size_t m, std::size_t n, std::size_t ldim) {
+	// std::complex<Real> is layout-compatible with Real[2]
+	return all_finite(reinterpret_cast<Real const*>(buf), 2*m, n, 2*ldim);
+}
+
+template<typename Integer>
+std::enable_if_t<std::is_integral_v<Integer>, bool>
+all_finite(Integer const*, std::size_t, std::size_t, std::size_t) {
+	return true;
+}
+
+template<typename Ring>
+bool
+all_finite(std::vector<Ring> const& a) {
+	return all_finite(a.data(), a.size(), 1u, a.size());
+}
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+template<typename Ring>
+bool
+all_finite(El::Matrix<Ring> const& a) {
+	return all_finite(
+		a.LockedBuffer(),
+		boost::numeric_cast<std::size_t>(a.Height()),
+		boost::numeric_cast<std::size_t>(a.Width()),
+		boost::numeric_cast<std::size_t>(a.LDim())
+	);
+}
+
+/* Checks the local matrices and combines their results with a single, node-aware MPI_LOR reduction */
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+bool
+all_finite(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a) {
+	int non_finite = all_finite(a.LockedMatrix()) ? 0 : 1;
+	mpi::hierarchical_allreduce(MPI_IN_PLACE, &non_finite, 1, MPI_INT, MPI_LOR, a.Grid().Comm().comm);
+	return non_finite == 0;
+}
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+
+/*
+ * Throws non_finite_value_exception if a contains NaN or Inf and checks for the given stage are enabled. a is any
+ * matrix or vector type whose data() is a std::vector, El::Matrix or El::DistMatrix, e.g. rtsam or el_dist_matrix.
+ */
+template<typename Matrix>
+void
+validate_finite(validation_level stage, Matrix const& a) {
+	if (validates(stage) && !all_finite(a.data())) {
+		BOOST_THROW_EXCEPTION(non_finite_value_exception{});
+	}
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_VALIDATION_IMPL_HPP
@@ -0,0 +1,93 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE validation_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/validation.hpp>
+#include <hbrs/mpl/dt/exception.hpp>
+#include <hbrs/mpl/dt/rtsam.hpp>
+#include <hbrs/mpl/dt/storage_order.hpp>
+#include <complex>
+#include <limits>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(validation_test)
+
+BOOST_AUTO_TEST_CASE(all_finite_kernel) {
+	using namespace hbrs::mpl::detail;
+	
+	double const nan = std::numeric_limits<double>::quiet_NaN();
+	double const inf = std::numeric_limits<double>::infinity();
+	
+	std::vector<double> v(3*all_finite_block_size + 7, 1.);
+	BOOST_TEST(all_finite(v));
+	
+	// non-finite values in the last block and in the remainder
+	for (double x : { nan, inf, -inf }) {
+		std::vector<double> w = v;
+		w.back() = x;
+		BOOST_TEST(!all_finite(w));
+		w.back() = 1.;
+		w[2*all_finite_block_size + 1] = x;
+		BOOST_TEST(!all_finite(w));
+	}
+	
+	// entries between the height and the leading dimension of a column are ignored
+	std::vector<double> a = { 1., 2., nan, 3., 4., inf };
+	BOOST_TEST(all_finite(a.data(), 2u, 2u, 3u));
+	BOOST_TEST(!all_finite(a.data(), 3u, 2u, 3u));
+	
+	std::vector<std::complex<double>> c = { {1., 2.}, {3., 4.} };
+	BOOST_TEST(all_finite(c));
+	c[1] = {3., nan};
+	BOOST_TEST(!all_finite(c));
+	
+	std::vector<int> i = { 1, 2, 3 };
+	BOOST_TEST(all_finite(i));
+}
+
+BOOST_AUTO_TEST_CASE(validation_levels) {
+	using namespace hbrs::mpl;
+	using namespace hbrs::mpl::detail;
+	
+	validation_level const previous = get_validation_level();
+	
+	rtsam<double, storage_order::row_major> a{2, 2};
+	a.at(make_matrix_index(1, 1)) = std::numeric_limits<double>::infinity();
+	
+	set_validation_level(validation_level::all);
+	BOOST_CHECK_THROW(validate_finite(validation_level::input, a), non_finite_value_exception);
+	BOOST_CHECK_THROW(validate_finite(validation_level::all, a), non_finite_value_exception);
+	
+	set_validation_level(validation_level::input);
+	BOOST_CHECK_THROW(validate_finite(validation_level::input, a), non_finite_value_exception);
+	BOOST_CHECK_NO_THROW(validate_finite(validation_level::all, a));
+	
+	set_validation_level(validation_level::off);
+	BOOST_CHECK_NO_THROW(validate_finite(validation_level::input, a));
+	
+	a.at(make_matrix_index(1, 1)) = 1.;
+	set_validation_level(validation_level::all);
+	BOOST_CHECK_NO_THROW(validate_finite(validation_level::all, a));
+	
+	set_validation_level(previous);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
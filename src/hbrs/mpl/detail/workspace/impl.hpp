@@ -0,0 +1,184 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DETAIL_WORKSPACE_IMPL_HPP
+#define HBRS_MPL_DETAIL_WORKSPACE_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/*
+ * Pool of std::vector<Ring> buffers which backs rtsam, rtsacv and rtsarv temporaries.
+ *
+ * Iterative algorithms like bidiag() or svd() create and destroy small matrices and vectors of the same sizes in every
+ * iteration. While a scoped_workspace<Ring> is alive on a thread, those containers hand their buffers back to the
+ * workspace on destruction and new containers take a buffer of sufficient capacity from it, so each iteration reuses
+ * the memory of the previous one instead of going through the heap. Without an active workspace, buffers are
+ * allocated and freed as usual.
+ *
+ * Workspaces are thread-local and not shared, so no locking is required.
+ */
+template<typename Ring>
+struct workspace {
+	/* Upper bound for the number of cached buffers, further buffers are freed right away */
+	static constexpr std::size_t max_cached = 64;
+	
+	workspace() = default;
+	workspace(workspace const&) = delete;
+	workspace(workspace &&) = delete;
+	
+	workspace&
+	operator=(workspace const&) = delete;
+	workspace&
+	operator=(workspace &&) = delete;
+	
+	/* Returns the workspace which is active on the calling thread or nullptr */
+	static workspace *&
+	current() {
+		static thread_local workspace * current_ = nullptr;
+		return current_;
+	}
+	
+	/* Returns a buffer with size elements, all set to value. Picks the smallest cached buffer that fits. */
+	std::vector<Ring>
+	acquire(std::size_t size, Ring const& value) {
+		auto buffer = take(size);
+		buffer.assign(size, value);
+		return buffer;
+	}
+	
+	/* Returns a copy of other, which reuses a cached buffer if possible */
+	std::vector<Ring>
+	acquire(std::vector<Ring> const& other) {
+		auto buffer = take(other.size());
+		buffer.assign(other.begin(), other.end());
+		return buffer;
+	}
+	
+	void
+	recycle(std::vector<Ring> && buffer) {
+		if (buffer.capacity() == 0 || cached_.size() >= max_cached) {
+			return;
+		}
+		buffer.clear();
+		cached_.push_back(std::move(buffer));
+	}
+	
+	/* Frees all cached buffers */
+	void
+	clear() {
+		cached_.clear();
+	}
+	
+	std::size_t
+	cached() const {
+		return cached_.size();
+	}
+	
+private:
+	std::vector<Ring>
+	take(std::size_t size) {
+		auto best = cached_.end();
+		for (auto it = cached_.begin(); it != cached_.end(); ++it) {
+			if (it->capacity() >= size && (best == cached_.end() || it->capacity() < best->capacity())) {
+				best = it;
+			}
+		}
+		
+		if (best == cached_.end()) {
+			return {};
+		}
+		
+		std::swap(*best, cached_.back());
+		std::vector<Ring> buffer = std::move(cached_.back());
+		cached_.pop_back();
+		return buffer;
+	}
+	
+	std::vector<std::vector<Ring>> cached_;
+};
+
+/*
+ * Activates a workspace<Ring> on the calling thread for the lifetime of this object.
+ * If a workspace is active already, e.g. because svd() calls bidiag(), then the outer workspace is used and this
+ * object does nothing. Buffers which are cached when the outermost scope ends are freed.
+ */
+template<typename Ring>
+struct scoped_workspace {
+	scoped_workspace() : owner_{workspace<Ring>::current() == nullptr} {
+		if (owner_) {
+			workspace<Ring>::current() = &workspace_;
+		}
+	}
+	
+	~scoped_workspace() {
+		if (owner_) {
+			BOOST_ASSERT(workspace<Ring>::current() == &workspace_);
+			workspace<Ring>::current() = nullptr;
+		}
+	}
+	
+	scoped_workspace(scoped_workspace const&) = delete;
+	scoped_workspace(scoped_workspace &&) = delete;
+	
+	scoped_workspace&
+	operator=(scoped_workspace const&) = delete;
+	scoped_workspace&
+	operator=(scoped_workspace &&) = delete;
+	
+private:
+	workspace<Ring> workspace_;
+	bool const owner_;
+};
+
+/* Returns a buffer with size elements set to value, taken from the active workspace if any */
+template<typename Ring>
+std::vector<Ring>
+acquire_buffer(std::size_t size, Ring const& value) {
+	workspace<Ring> * ws = workspace<Ring>::current();
+	return ws ? ws->acquire(size, value) : std::vector<Ring>(size, value);
+}
+
+/* Returns a copy of other, taken from the active workspace if any */
+template<typename Ring>
+std::vector<Ring>
+acquire_buffer(std::vector<Ring> const& other) {
+	workspace<Ring> * ws = workspace<Ring>::current();
+	return ws ? ws->acquire(other) : other;
+}
+
+/* Hands buffer over to the active workspace if any, else leaves it untouched */
+template<typename Ring>
+void
+recycle_buffer(std::vector<Ring> & buffer) {
+	workspace<Ring> * ws = workspace<Ring>::current();
+	if (ws) {
+		ws->recycle(std::move(buffer));
+	}
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DETAIL_WORKSPACE_IMPL_HPP
@@ -0,0 +1,91 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE workspace_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <hbrs/mpl/detail/workspace.hpp>
+#include <hbrs/mpl/dt/rtsam.hpp>
+#include <hbrs/mpl/dt/rtsacv.hpp>
+#include <hbrs/mpl/dt/storage_order.hpp>
+
+BOOST_AUTO_TEST_SUITE(workspace_test)
+
+BOOST_AUTO_TEST_CASE(workspace_recycle) {
+	using namespace hbrs::mpl;
+	using detail::workspace;
+	using detail::scoped_workspace;
+	
+	BOOST_TEST((workspace<double>::current() == nullptr));
+	
+	{
+		scoped_workspace<double> outer;
+		workspace<double> * ws = workspace<double>::current();
+		BOOST_TEST((ws != nullptr));
+		
+		double const* buffer;
+		{
+			rtsam<double, storage_order::row_major> a{3, 4};
+			a.at(make_matrix_index(1, 2)) = 42.;
+			buffer = a.data().data();
+		}
+		BOOST_TEST(ws->cached() == 1u);
+		
+		{
+			// a smaller container reuses the buffer and is zeroed
+			rtsacv<double> v{5};
+			BOOST_TEST(v.data().data() == buffer);
+			BOOST_TEST(ws->cached() == 0u);
+			for (std::size_t i = 0; i < v.length(); ++i) {
+				BOOST_TEST(v.at(i) == 0.);
+			}
+			
+			// a copy draws from the workspace, too, and falls back to the heap if nothing fits
+			rtsacv<double> w = v;
+			BOOST_TEST(w.data().data() != buffer);
+			BOOST_TEST(w.length() == v.length());
+		}
+		BOOST_TEST(ws->cached() == 2u);
+		
+		{
+			// nested scopes share the outermost workspace
+			scoped_workspace<double> inner;
+			BOOST_TEST((workspace<double>::current() == ws));
+		}
+		BOOST_TEST((workspace<double>::current() == ws));
+		
+		// workspaces are per type
+		BOOST_TEST((workspace<float>::current() == nullptr));
+		
+		{
+			// moved-from containers do not hand over their (empty) buffer
+			rtsacv<double> v{2};
+			rtsacv<double> w = std::move(v);
+			BOOST_TEST(ws->cached() == 1u);
+		}
+		BOOST_TEST(ws->cached() == 2u);
+		
+		ws->clear();
+		BOOST_TEST(ws->cached() == 0u);
+	}
+	
+	BOOST_TEST((workspace<double>::current() == nullptr));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,32 @@
+/* Copyright (c) 2019 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HBRS_MPL_DT_DMD_AMPLITUDES_FWD_HPP
+#define HBRS_MPL_DT_DMD_AMPLITUDES_FWD_HPP
+
+#include <hbrs/mpl/config.hpp>
+
+HBRS_MPL_NAMESPACE_BEGIN
+
+/* Selects how dmd() computes the amplitudes of the DMD modes:
+ * least_squares solves the m-by-r least-squares problem modes*b = x1 exactly,
+ * projected solves an r-by-r system after projecting x1 onto the POD modes (see fn/dmd/impl/elemental.hpp).
+ */
+enum class dmd_amplitudes { least_squares, projected };
+
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DT_DMD_AMPLITUDES_FWD_HPP
@@ -30,6 +30,8 @@ struct dmd_control_tag {};
 constexpr auto make_dmd_control = hana::make<dmd_control_tag>;
 constexpr auto to_dmd_control = hana::to<dmd_control_tag>;
 
+constexpr int dmd_default_redundant_threshold = 128;
+
 HBRS_MPL_NAMESPACE_END
 
 #endif // !HBRS_MPL_DT_DMD_CONTROL_FWD_HPP
@@ -19,6 +19,7 @@
 
 #include "fwd.hpp"
 
+#include <hbrs/mpl/dt/dmd_amplitudes.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/to.hpp>
 #include <hbrs/mpl/core/preprocessor.hpp>
@@ -36,7 +37,10 @@ struct dmd_control {
 		>* = nullptr
 	>
 	constexpr
-	dmd_control() {}
+	dmd_control()
+	: redundant_threshold_(dmd_default_redundant_threshold),
+	  amplitudes_{dmd_amplitudes::least_squares}
+	{}
 	
 	template<
 		typename TargetRank_ = TargetRank,
@@ -47,7 +51,24 @@ struct dmd_control {
 	>
 	constexpr 
 	dmd_control(TargetRank_ && tr)
-	: target_rank_{HBRS_MPL_FWD(tr)}
+	: target_rank_{HBRS_MPL_FWD(tr)},
+	  redundant_threshold_(dmd_default_redundant_threshold),
+	  amplitudes_{dmd_amplitudes::least_squares}
+	{}
+	
+	template<
+		typename TargetRank_ = TargetRank,
+		typename RedundantThreshold_ = TargetRank,
+		typename std::enable_if_t<
+			detail::is_braces_constructible_v<TargetRank, TargetRank_> &&
+			detail::is_braces_constructible_v<TargetRank, RedundantThreshold_>
+		>* = nullptr
+	>
+	constexpr 
+	dmd_control(TargetRank_ && tr, RedundantThreshold_ && rt, dmd_amplitudes a = dmd_amplitudes::least_squares)
+	: target_rank_{HBRS_MPL_FWD(tr)},
+	  redundant_threshold_{HBRS_MPL_FWD(rt)},
+	  amplitudes_{a}
 	{}
 	
 	constexpr 
@@ -69,8 +90,31 @@ struct dmd_control {
 	constexpr decltype(auto)
 	target_rank() && { return HBRS_MPL_FWD(target_rank_); };
 	
+	/* Reduced-order operands (r-by-r with r <= target rank) up to this size are replicated on all ranks and processed
+	 * with local LAPACK routines instead of distributed ones, because the latter are latency-bound for tiny matrices.
+	 */
+	constexpr decltype(auto)
+	redundant_threshold() & { return (redundant_threshold_); };
+	
+	constexpr decltype(auto)
+	redundant_threshold() const& { return (redundant_threshold_); };
+	
+	constexpr decltype(auto)
+	redundant_threshold() && { return HBRS_MPL_FWD(redundant_threshold_); };
+	
+	constexpr decltype(auto)
+	amplitudes() & { return (amplitudes_); };
+	
+	constexpr decltype(auto)
+	amplitudes() const& { return (amplitudes_); };
+	
+	constexpr decltype(auto)
+	amplitudes() && { return HBRS_MPL_FWD(amplitudes_); };
+	
 private:
 	TargetRank target_rank_;
+	TargetRank redundant_threshold_;
+	dmd_amplitudes amplitudes_;
 };
 
 HBRS_MPL_NAMESPACE_END
@@ -91,6 +135,18 @@ struct make_impl<hbrs::mpl::dmd_control_tag> {
 	apply(TargetRank && tr) {
 		return { HBRS_MPL_FWD(tr) };
 	}
+	
+	template <typename TargetRank, typename RedundantThreshold>
+	static constexpr hbrs::mpl::dmd_control<
+		std::decay_t<TargetRank>
+	>
+	apply(
+		TargetRank && tr,
+		RedundantThreshold && rt,
+		hbrs::mpl::dmd_amplitudes a = hbrs::mpl::dmd_amplitudes::least_squares
+	) {
+		return { HBRS_MPL_FWD(tr), HBRS_MPL_FWD(rt), a };
+	}
 };
 
 /* namespace hana */ } /* namespace boost */ }
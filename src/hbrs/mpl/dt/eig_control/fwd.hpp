@@ -24,7 +24,21 @@
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
 
-template<typename = void>
+/* Symmetry hint for eig(): general matrices yield complex eigenvalues and eigenvectors, while hermitian (e.g. real and
+ * symmetric) matrices yield real eigenvalues and, for real matrices, real eigenvectors. Only the lower triangle of a
+ * hermitian matrix is referenced.
+ */
+enum class eig_symmetry { general, hermitian };
+
+/* Selects which eigenpairs of a hermitian matrix are computed, eigenvalues are always returned in descending order:
+ * all computes all eigenpairs,
+ * index_range computes the eigenpairs with indices first_index to last_index (inclusive), e.g. the largest k eigenpairs
+ * are selected with eig_control<eig_symmetry::hermitian>{0, k-1},
+ * value_range computes the eigenpairs whose eigenvalues lie in the half-open interval (lower_bound, upper_bound].
+ */
+enum class eig_subset { all, index_range, value_range };
+
+template<eig_symmetry = eig_symmetry::general>
 struct eig_control;
 struct eig_control_tag {};
 constexpr auto make_eig_control = hana::make<eig_control_tag>;
@@ -23,11 +23,12 @@
 #include <boost/hana/core/to.hpp>
 #include <hbrs/mpl/core/preprocessor.hpp>
 #include <hbrs/mpl/detail/is_braces_constructible.hpp>
+#include <cstddef>
 #include <type_traits>
 
 HBRS_MPL_NAMESPACE_BEGIN
 
-template<typename>
+template<eig_symmetry Symmetry>
 struct eig_control {
 	template<typename = void>
 	constexpr
@@ -44,12 +45,69 @@ struct eig_control {
 	operator=(eig_control &&) = default;
 };
 
+template<>
+struct eig_control<eig_symmetry::hermitian> {
+	constexpr
+	eig_control()
+	: subset_{eig_subset::all}, first_index_{0}, last_index_{0}, lower_bound_{0}, upper_bound_{0} {}
+	
+	template<
+		typename Index,
+		typename std::enable_if_t< std::is_integral_v<Index> >* = nullptr
+	>
+	constexpr
+	eig_control(Index first_index, Index last_index)
+	: subset_{eig_subset::index_range}, first_index_{static_cast<std::size_t>(first_index)},
+	  last_index_{static_cast<std::size_t>(last_index)}, lower_bound_{0}, upper_bound_{0} {}
+	
+	template<
+		typename Real,
+		typename std::enable_if_t< std::is_floating_point_v<Real> >* = nullptr
+	>
+	constexpr
+	eig_control(Real lower_bound, Real upper_bound)
+	: subset_{eig_subset::value_range}, first_index_{0}, last_index_{0}, lower_bound_{static_cast<double>(lower_bound)},
+	  upper_bound_{static_cast<double>(upper_bound)} {}
+	
+	constexpr 
+	eig_control(eig_control const&) = default;
+	constexpr 
+	eig_control(eig_control &&) = default;
+	
+	constexpr eig_control&
+	operator=(eig_control const&) = default;
+	constexpr eig_control&
+	operator=(eig_control &&) = default;
+	
+	constexpr eig_subset
+	subset() const { return subset_; };
+	
+	constexpr std::size_t
+	first_index() const { return first_index_; };
+	
+	constexpr std::size_t
+	last_index() const { return last_index_; };
+	
+	constexpr double
+	lower_bound() const { return lower_bound_; };
+	
+	constexpr double
+	upper_bound() const { return upper_bound_; };
+	
+private:
+	eig_subset subset_;
+	std::size_t first_index_;
+	std::size_t last_index_;
+	double lower_bound_;
+	double upper_bound_;
+};
+
 HBRS_MPL_NAMESPACE_END
 
 namespace boost { namespace hana {
 
-template <>
-struct tag_of< hbrs::mpl::eig_control<> > {
+template <hbrs::mpl::eig_symmetry Symmetry>
+struct tag_of< hbrs::mpl::eig_control<Symmetry> > {
 	using type = hbrs::mpl::eig_control_tag;
 };
 
@@ -59,6 +117,12 @@ struct make_impl<hbrs::mpl::eig_control_tag> {
 	apply() {
 		return {};
 	}
+	
+	template<typename First, typename Last>
+	static constexpr hbrs::mpl::eig_control<hbrs::mpl::eig_symmetry::hermitian>
+	apply(First first, Last last) {
+		return {first, last};
+	}
 };
 
 /* namespace hana */ } /* namespace boost */ }
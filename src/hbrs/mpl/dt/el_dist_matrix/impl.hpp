@@ -22,6 +22,7 @@
 
 #include <hbrs/mpl/config.hpp>
 #include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/detail/first_touch.hpp>
 #include <hbrs/mpl/dt/matrix_index.hpp>
 #include <hbrs/mpl/dt/matrix_size.hpp>
 #include <hbrs/mpl/dt/storage_order.hpp>
@@ -90,7 +91,7 @@ struct el_dist_matrix {
 	
 	el_dist_matrix(El::Grid const& grid, El::Int m, El::Int n) : data_{grid} {
 		data_.Resize(m, n);
-		El::Zero(data_);
+		detail::first_touch_zero(data_);
 	}
 	
 	template<
@@ -0,0 +1,211 @@
+/* Copyright (c) 2019 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HBRS_MPL_DT_EL_FACTORIZATION_IMPL_HPP
+#define HBRS_MPL_DT_EL_FACTORIZATION_IMPL_HPP
+
+#include "fwd.hpp"
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/core/make.hpp>
+#include <El.hpp>
+#include <type_traits>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+/* Elemental types of the auxiliary data which accompanies the factors, depending on whether the factorized matrix is
+ * local or distributed.
+ */
+template<typename Matrix>
+struct el_factorization_storage;
+
+template<typename Ring>
+struct el_factorization_storage<el_matrix<Ring>> {
+	typedef El::Matrix<Ring> scalars_type;
+	typedef El::Matrix<El::Base<Ring>> signature_type;
+	typedef El::Permutation permutation_type;
+	
+	static scalars_type
+	make_scalars(el_matrix<Ring> const&) { return {}; }
+	
+	static signature_type
+	make_signature(el_matrix<Ring> const&) { return {}; }
+	
+	static permutation_type
+	make_permutation(el_matrix<Ring> const&) { return {}; }
+};
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+struct el_factorization_storage<el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>> {
+	typedef El::DistMatrix<Ring, El::MD, El::STAR> scalars_type;
+	typedef El::DistMatrix<El::Base<Ring>, El::MD, El::STAR> signature_type;
+	typedef El::DistPermutation permutation_type;
+	
+	static scalars_type
+	make_scalars(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a) { return scalars_type{a.data().Grid()}; }
+	
+	static signature_type
+	make_signature(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a) {
+		return signature_type{a.data().Grid()};
+	}
+	
+	static permutation_type
+	make_permutation(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a) {
+		return permutation_type{a.data().Grid()};
+	}
+};
+
+/* namespace detail */ }
+
+/* Factorization of a matrix A as computed by factorize(), which can be passed to mldivide() instead of A to solve many
+ * systems A*X=B with the same A but without factorizing A again. Which members are used depends on type():
+ *
+ *  diagonal               scalars() holds the main diagonal of A.
+ *  lower_triangular,      factors() holds A itself.
+ *  upper_triangular
+ *  banded                 factors() holds L and U of a LU decomposition with partial pivoting which has been restricted
+ *                         to the band, pivots() holds the row interchanges and lower_bandwidth()/upper_bandwidth() the
+ *                         bandwidths of A.
+ *  cholesky               factors() holds the lower Cholesky factor.
+ *  ldl                    factors(), scalars() and permutation() hold the output of El::LDL().
+ *  lu                     factors() and permutation() hold the output of El::LU().
+ *  qr, lq                 factors(), scalars() and signature() hold the output of El::QR() and El::LQ().
+ */
+template<typename Matrix>
+struct el_factorization {
+	typedef detail::el_factorization_storage<Matrix> storage;
+	typedef typename storage::scalars_type scalars_type;
+	typedef typename storage::signature_type signature_type;
+	typedef typename storage::permutation_type permutation_type;
+	
+	el_factorization(el_factorization_type type, Matrix factors)
+	: type_{type},
+	  scalars_{storage::make_scalars(factors)},
+	  signature_{storage::make_signature(factors)},
+	  permutation_{storage::make_permutation(factors)},
+	  pivots_{},
+	  lower_bandwidth_{0},
+	  upper_bandwidth_{0},
+	  factors_{std::move(factors)} {}
+	
+	el_factorization(el_factorization const&) = default;
+	el_factorization(el_factorization &&) = default;
+	
+	el_factorization&
+	operator=(el_factorization const&) = default;
+	el_factorization&
+	operator=(el_factorization &&) = default;
+	
+	el_factorization_type
+	type() const { return type_; };
+	
+	decltype(auto)
+	factors() & { return (factors_); };
+	
+	decltype(auto)
+	factors() const& { return (factors_); };
+	
+	decltype(auto)
+	factors() && { return HBRS_MPL_FWD(factors_); };
+	
+	decltype(auto)
+	scalars() & { return (scalars_); };
+	
+	decltype(auto)
+	scalars() const& { return (scalars_); };
+	
+	decltype(auto)
+	scalars() && { return HBRS_MPL_FWD(scalars_); };
+	
+	decltype(auto)
+	signature() & { return (signature_); };
+	
+	decltype(auto)
+	signature() const& { return (signature_); };
+	
+	decltype(auto)
+	signature() && { return HBRS_MPL_FWD(signature_); };
+	
+	decltype(auto)
+	permutation() & { return (permutation_); };
+	
+	decltype(auto)
+	permutation() const& { return (permutation_); };
+	
+	decltype(auto)
+	permutation() && { return HBRS_MPL_FWD(permutation_); };
+	
+	decltype(auto)
+	pivots() & { return (pivots_); };
+	
+	decltype(auto)
+	pivots() const& { return (pivots_); };
+	
+	decltype(auto)
+	pivots() && { return HBRS_MPL_FWD(pivots_); };
+	
+	El::Int &
+	lower_bandwidth() & { return lower_bandwidth_; };
+	
+	El::Int
+	lower_bandwidth() const& { return lower_bandwidth_; };
+	
+	El::Int &
+	upper_bandwidth() & { return upper_bandwidth_; };
+	
+	El::Int
+	upper_bandwidth() const& { return upper_bandwidth_; };
+	
+private:
+	el_factorization_type type_;
+	scalars_type scalars_;
+	signature_type signature_;
+	permutation_type permutation_;
+	std::vector<El::Int> pivots_;
+	El::Int lower_bandwidth_;
+	El::Int upper_bandwidth_;
+	Matrix factors_;
+};
+
+HBRS_MPL_NAMESPACE_END
+
+namespace boost { namespace hana {
+
+template <typename Matrix>
+struct tag_of< hbrs::mpl::el_factorization<Matrix> > {
+	using type = hbrs::mpl::el_factorization_tag;
+};
+
+template <>
+struct make_impl<hbrs::mpl::el_factorization_tag> {
+	template <typename Matrix>
+	static hbrs::mpl::el_factorization< std::decay_t<Matrix> >
+	apply(hbrs::mpl::el_factorization_type type, Matrix && factors) {
+		return {type, HBRS_MPL_FWD(factors)};
+	}
+};
+
+/* namespace hana */ } /* namespace boost */ }
+
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+#endif // !HBRS_MPL_DT_EL_FACTORIZATION_IMPL_HPP
@@ -27,6 +27,7 @@
 #include <hbrs/mpl/core/preprocessor.hpp>
 #include <hbrs/mpl/detail/translate_index.hpp>
 #include <hbrs/mpl/detail/copy_matrix.hpp>
+#include <hbrs/mpl/detail/first_touch.hpp>
 #include <hbrs/mpl/dt/sm.hpp>
 #include <hbrs/mpl/dt/ctsam.hpp>
 #include <hbrs/mpl/dt/rtsam.hpp>
@@ -59,7 +60,7 @@ struct el_matrix {
 	}
 	
 	el_matrix(El::Int m, El::Int n) : data_{m,n} {
-		El::Zero(data_);
+		detail::first_touch_zero(data_);
 	}
 	
 	el_matrix(el_matrix const&) = default;
@@ -20,6 +20,7 @@
 #include <hbrs/mpl/config.hpp>
 #include <hbrs/mpl/dt/matrix_size/fwd.hpp>
 #include <hbrs/mpl/dt/decompose_mode/fwd.hpp>
+#include <hbrs/mpl/dt/svd_algorithm/fwd.hpp>
 #include <boost/exception/error_info.hpp>
 #include <boost/system/error_code.hpp>
 #include <tuple>
@@ -41,6 +42,7 @@ struct HBRS_MPL_API incompatible_matrices_exception;
 struct HBRS_MPL_API mpi_exception;
 struct HBRS_MPL_API io_exception;
 struct HBRS_MPL_API not_supported_exception;
+struct HBRS_MPL_API non_finite_value_exception;
 
 typedef boost::error_info<struct errinfo_sequence_size_, std::size_t > errinfo_sequence_size;
 typedef boost::error_info<
@@ -93,6 +95,7 @@ typedef boost::error_info<struct errinfo_ml_matrix_size_, matrix_size<int, int>
 #endif
 	
 typedef boost::error_info<struct errinfo_decompose_mode_, decompose_mode> errinfo_decompose_mode;
+typedef boost::error_info<struct errinfo_svd_algorithm_, svd_algorithm> errinfo_svd_algorithm;
 
 HBRS_MPL_NAMESPACE_END
 
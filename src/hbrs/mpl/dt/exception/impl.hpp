@@ -38,6 +38,7 @@ struct HBRS_MPL_API incompatible_matrices_exception : virtual exception {};
 struct HBRS_MPL_API mpi_exception : virtual exception {};
 struct HBRS_MPL_API io_exception : virtual exception {};
 struct HBRS_MPL_API not_supported_exception : virtual exception {};
+struct HBRS_MPL_API non_finite_value_exception : virtual exception {};
 
 struct mpi_error_info {
 	mpi_error_info(int code);
@@ -0,0 +1,36 @@
+/* Copyright (c) 2019 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HBRS_MPL_DT_HANKEL_MATRIX_FWD_HPP
+#define HBRS_MPL_DT_HANKEL_MATRIX_FWD_HPP
+
+#include <hbrs/mpl/config.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/core/to.hpp>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+
+/* block-Hankel (delay-embedded) view of a snapshot matrix */
+template<typename Matrix, typename Delays>
+struct hankel_matrix;
+struct hankel_matrix_tag{};
+constexpr auto make_hankel_matrix = hana::make<hankel_matrix_tag>;
+constexpr auto to_hankel_matrix = hana::to<hankel_matrix_tag>;
+
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DT_HANKEL_MATRIX_FWD_HPP
@@ -0,0 +1,124 @@
+/* Copyright (c) 2019 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HBRS_MPL_DT_HANKEL_MATRIX_IMPL_HPP
+#define HBRS_MPL_DT_HANKEL_MATRIX_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <hbrs/mpl/dt/matrix_size.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/detail/is_braces_constructible.hpp>
+#include <hbrs/mpl/fn/m.hpp>
+#include <hbrs/mpl/fn/n.hpp>
+#include <hbrs/mpl/fn/size.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/to.hpp>
+#include <type_traits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+
+/* Let X = [x_0, x_1, ..., x_{n-1}] be a m-by-n snapshot matrix and d the number of delays. Then the block-Hankel matrix
+ * is the (d*m)-by-(n-d+1) matrix
+ *
+ *     [ x_0      x_1  ...  x_{n-d}   ]
+ *     [ x_1      x_2  ...  x_{n-d+1} ]
+ *     [ ...                          ]
+ *     [ x_{d-1}  x_d  ...  x_{n-1}   ]
+ *
+ * i.e. block row i is the column window X(:, i:i+n-d). hankel_matrix holds only X, operations such as multiply() work
+ * on these windows, hence memory stays O(m*n) instead of O(d*m*n).
+ */
+template<
+	typename Matrix,
+	typename Delays
+>
+struct hankel_matrix {
+	template<
+		typename Matrix_ = Matrix,
+		typename Delays_ = Delays,
+		typename std::enable_if_t<
+			detail::is_braces_constructible_v<Matrix, Matrix_> &&
+			detail::is_braces_constructible_v<Delays, Delays_>
+		>* = nullptr
+	>
+	constexpr
+	hankel_matrix(Matrix_ && snapshots, Delays_ && delays)
+	: snapshots_{HBRS_MPL_FWD(snapshots)}, delays_{HBRS_MPL_FWD(delays)} {}
+	
+	constexpr
+	hankel_matrix(hankel_matrix const&) = default;
+	constexpr
+	hankel_matrix(hankel_matrix &&) = default;
+	
+	constexpr hankel_matrix&
+	operator=(hankel_matrix const&) = default;
+	constexpr hankel_matrix&
+	operator=(hankel_matrix &&) = default;
+	
+	constexpr decltype(auto)
+	snapshots() & { return (snapshots_); };
+	
+	constexpr decltype(auto)
+	snapshots() const& { return (snapshots_); };
+	
+	constexpr decltype(auto)
+	snapshots() && { return HBRS_MPL_FWD(snapshots_); };
+	
+	constexpr decltype(auto)
+	delays() & { return (delays_); };
+	
+	constexpr decltype(auto)
+	delays() const& { return (delays_); };
+	
+	constexpr decltype(auto)
+	delays() && { return HBRS_MPL_FWD(delays_); };
+	
+	constexpr auto
+	size() const {
+		using hbrs::mpl::size;
+		using hbrs::mpl::m;
+		using hbrs::mpl::n;
+		auto sz = (*size)(snapshots_);
+		return make_matrix_size((*m)(sz) * delays_, (*n)(sz) - delays_ + 1);
+	}
+	
+private:
+	Matrix snapshots_;
+	Delays delays_;
+};
+
+HBRS_MPL_NAMESPACE_END
+
+namespace boost { namespace hana {
+
+template <typename Matrix, typename Delays>
+struct tag_of< hbrs::mpl::hankel_matrix<Matrix, Delays> > {
+	using type = hbrs::mpl::hankel_matrix_tag;
+};
+
+template <>
+struct make_impl<hbrs::mpl::hankel_matrix_tag> {
+	template<typename Matrix, typename Delays>
+	static constexpr hbrs::mpl::hankel_matrix< std::decay_t<Matrix>, std::decay_t<Delays> >
+	apply(Matrix && snapshots, Delays && delays) {
+		return {HBRS_MPL_FWD(snapshots), HBRS_MPL_FWD(delays)};
+	}
+};
+
+/* namespace hana */ } /* namespace boost */ }
+
+#endif // !HBRS_MPL_DT_HANKEL_MATRIX_IMPL_HPP
@@ -0,0 +1,134 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DT_PCA_TRANSFORM_CONTROL_IMPL_HPP
+#define HBRS_MPL_DT_PCA_TRANSFORM_CONTROL_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/to.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/detail/is_braces_constructible.hpp>
+#include <type_traits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+
+/*
+ * pca_control is the control which the pca_result has been computed with, components is the number of leading
+ * principal components to project onto and batch_size is the number of rows which are projected at once (0 means all).
+ */
+template<typename PCAControl, typename Components, typename BatchSize>
+struct pca_transform_control {
+	template<
+		typename PCAControl_ = PCAControl,
+		typename Components_ = Components,
+		typename BatchSize_ = BatchSize,
+		typename std::enable_if_t<
+			std::is_default_constructible_v<PCAControl_> &&
+			std::is_default_constructible_v<Components_> &&
+			std::is_default_constructible_v<BatchSize_>
+		>* = nullptr
+	>
+	constexpr
+	pca_transform_control() {}
+	
+	template<
+		typename PCAControl_ = PCAControl,
+		typename Components_ = Components,
+		typename BatchSize_ = BatchSize,
+		typename std::enable_if_t<
+			detail::is_braces_constructible_v<PCAControl, PCAControl_> &&
+			detail::is_braces_constructible_v<Components, Components_> &&
+			detail::is_braces_constructible_v<BatchSize, BatchSize_>
+		>* = nullptr
+	>
+	constexpr 
+	pca_transform_control(PCAControl_ && pca_control, Components_ && components, BatchSize_ && batch_size)
+	: pca_control_{HBRS_MPL_FWD(pca_control)},
+	  components_{HBRS_MPL_FWD(components)},
+	  batch_size_{HBRS_MPL_FWD(batch_size)}
+	{}
+	
+	constexpr 
+	pca_transform_control(pca_transform_control const&) = default;
+	constexpr 
+	pca_transform_control(pca_transform_control &&) = default;
+	
+	constexpr pca_transform_control&
+	operator=(pca_transform_control const&) = default;
+	constexpr pca_transform_control&
+	operator=(pca_transform_control &&) = default;
+	
+	constexpr decltype(auto)
+	pca_control() & { return (pca_control_); };
+	
+	constexpr decltype(auto)
+	pca_control() const& { return (pca_control_); };
+	
+	constexpr decltype(auto)
+	pca_control() && { return HBRS_MPL_FWD(pca_control_); };
+	
+	constexpr decltype(auto)
+	components() & { return (components_); };
+	
+	constexpr decltype(auto)
+	components() const& { return (components_); };
+	
+	constexpr decltype(auto)
+	components() && { return HBRS_MPL_FWD(components_); };
+	
+	constexpr decltype(auto)
+	batch_size() & { return (batch_size_); };
+	
+	constexpr decltype(auto)
+	batch_size() const& { return (batch_size_); };
+	
+	constexpr decltype(auto)
+	batch_size() && { return HBRS_MPL_FWD(batch_size_); };
+	
+private:
+	PCAControl pca_control_;
+	Components components_;
+	BatchSize batch_size_;
+};
+
+HBRS_MPL_NAMESPACE_END
+
+namespace boost { namespace hana {
+
+template <typename PCAControl, typename Components, typename BatchSize>
+struct tag_of< hbrs::mpl::pca_transform_control<PCAControl, Components, BatchSize> > {
+	using type = hbrs::mpl::pca_transform_control_tag;
+};
+
+template <>
+struct make_impl<hbrs::mpl::pca_transform_control_tag> {
+	template <typename PCAControl, typename Components, typename BatchSize>
+	static constexpr hbrs::mpl::pca_transform_control<
+		std::decay_t<PCAControl>,
+		std::decay_t<Components>,
+		std::decay_t<BatchSize>
+	>
+	apply(PCAControl && pca_control, Components && components, BatchSize && batch_size) {
+		return { HBRS_MPL_FWD(pca_control), HBRS_MPL_FWD(components), HBRS_MPL_FWD(batch_size) };
+	}
+};
+
+/* namespace hana */ } /* namespace boost */ }
+
+#endif // !HBRS_MPL_DT_PCA_TRANSFORM_CONTROL_IMPL_HPP
@@ -0,0 +1,117 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DT_QR_CONTROL_IMPL_HPP
+#define HBRS_MPL_DT_QR_CONTROL_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/to.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/detail/is_braces_constructible.hpp>
+#include <type_traits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+
+/*
+ * decompose_mode is either complete (Q is m-by-m and R is m-by-n) or economy (Q is m-by-k and R is k-by-n with
+ * k=min(m,n)). If implicit_q is true, Q is not formed but returned as compact Householder reflectors, see qr_result.
+ */
+template<typename DecomposeMode, typename ImplicitQ>
+struct qr_control {
+	template<
+		typename DecomposeMode_ = DecomposeMode,
+		typename ImplicitQ_ = ImplicitQ,
+		typename std::enable_if_t<
+			std::is_default_constructible<DecomposeMode_>::value &&
+			std::is_default_constructible<ImplicitQ_>::value
+		>* = nullptr
+	>
+	constexpr
+	qr_control() {}
+	
+	template<
+		typename DecomposeMode_ = DecomposeMode,
+		typename ImplicitQ_ = ImplicitQ,
+		typename std::enable_if_t<
+			detail::is_braces_constructible_v<DecomposeMode, DecomposeMode_> &&
+			detail::is_braces_constructible_v<ImplicitQ, ImplicitQ_>
+		>* = nullptr
+	>
+	constexpr 
+	qr_control(DecomposeMode_ && dm, ImplicitQ_ && implicit_q)
+	: decompose_mode_{HBRS_MPL_FWD(dm)}, implicit_q_{HBRS_MPL_FWD(implicit_q)}
+	{}
+	
+	constexpr 
+	qr_control(qr_control const&) = default;
+	constexpr 
+	qr_control(qr_control &&) = default;
+	
+	constexpr qr_control&
+	operator=(qr_control const&) = default;
+	constexpr qr_control&
+	operator=(qr_control &&) = default;
+	
+	constexpr decltype(auto)
+	decompose_mode() & { return (decompose_mode_); };
+	
+	constexpr decltype(auto)
+	decompose_mode() const& { return (decompose_mode_); };
+	
+	constexpr decltype(auto)
+	decompose_mode() && { return HBRS_MPL_FWD(decompose_mode_); };
+	
+	constexpr decltype(auto)
+	implicit_q() & { return (implicit_q_); };
+	
+	constexpr decltype(auto)
+	implicit_q() const& { return (implicit_q_); };
+	
+	constexpr decltype(auto)
+	implicit_q() && { return HBRS_MPL_FWD(implicit_q_); };
+	
+private:
+	DecomposeMode decompose_mode_;
+	ImplicitQ implicit_q_;
+};
+
+HBRS_MPL_NAMESPACE_END
+
+namespace boost { namespace hana {
+
+template <typename DecomposeMode, typename ImplicitQ>
+struct tag_of< hbrs::mpl::qr_control<DecomposeMode, ImplicitQ> > {
+	using type = hbrs::mpl::qr_control_tag;
+};
+
+template <>
+struct make_impl<hbrs::mpl::qr_control_tag> {
+	template <typename DecomposeMode, typename ImplicitQ>
+	static constexpr hbrs::mpl::qr_control<
+		std::decay_t<DecomposeMode>,
+		std::decay_t<ImplicitQ>
+	>
+	apply(DecomposeMode && dm, ImplicitQ && implicit_q) {
+		return { HBRS_MPL_FWD(dm), HBRS_MPL_FWD(implicit_q) };
+	}
+};
+
+/* namespace hana */ } /* namespace boost */ }
+
+#endif // !HBRS_MPL_DT_QR_CONTROL_IMPL_HPP
@@ -0,0 +1,124 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DT_QR_RESULT_IMPL_HPP
+#define HBRS_MPL_DT_QR_RESULT_IMPL_HPP
+
+#include "fwd.hpp"
+
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/to.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/detail/is_braces_constructible.hpp>
+#include <type_traits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+
+/*
+ * Result of qr(). Unless the implicit-Q mode of qr_control is used, q() holds the orthogonal factor Q explicitly.
+ * Otherwise q() holds the compact Householder reflectors v_1,...,v_k as columns of a m-by-k matrix, i.e. zero above the
+ * diagonal and scaled such that Q = H_1*H_2*...*H_k with H_j = I - v_j*v_j'.
+ */
+template<typename Q, typename R>
+struct qr_result {
+	template<
+		typename Q_ = Q,
+		typename R_ = R,
+		typename std::enable_if_t<
+			std::is_default_constructible<Q_>::value &&
+			std::is_default_constructible<R_>::value
+		>* = nullptr
+	>
+	constexpr
+	qr_result() {}
+	
+	template<
+		typename Q_ = Q,
+		typename R_ = R,
+		typename std::enable_if_t<
+			detail::is_braces_constructible_v<Q, Q_> &&
+			detail::is_braces_constructible_v<R, R_>
+		>* = nullptr
+	>
+	constexpr 
+	qr_result(Q_ && q, R_ && r)
+	: q_{HBRS_MPL_FWD(q)}, r_{HBRS_MPL_FWD(r)}
+	{}
+	
+	constexpr 
+	qr_result(qr_result const&) = default;
+	constexpr 
+	qr_result(qr_result &&) = default;
+	
+	constexpr qr_result&
+	operator=(qr_result const&) = default;
+	constexpr qr_result&
+	operator=(qr_result &&) = default;
+	
+	constexpr decltype(auto)
+	q() & { return (q_); };
+	
+	constexpr decltype(auto)
+	q() const& { return (q_); };
+	
+	constexpr decltype(auto)
+	q() && { return HBRS_MPL_FWD(q_); };
+	
+	constexpr decltype(auto)
+	r() & { return (r_); };
+	
+	constexpr decltype(auto)
+	r() const& { return (r_); };
+	
+	constexpr decltype(auto)
+	r() && { return HBRS_MPL_FWD(r_); };
+	
+private:
+	Q q_;
+	R r_;
+};
+
+struct qr_q{};
+struct qr_r{};
+
+HBRS_MPL_NAMESPACE_END
+
+namespace boost { namespace hana {
+
+template <typename Q, typename R>
+struct tag_of< hbrs::mpl::qr_result<Q, R> > {
+	using type = hbrs::mpl::qr_result_tag;
+};
+
+template <>
+struct make_impl<hbrs::mpl::qr_result_tag> {
+	template <typename Q, typename R>
+	static constexpr hbrs::mpl::qr_result<
+		std::decay_t<Q>,
+		std::decay_t<R>
+	>
+	apply(Q && q, R && r) {
+		return {
+			HBRS_MPL_FWD(q),
+			HBRS_MPL_FWD(r)
+		};
+	}
+};
+
+/* namespace hana */ } /* namespace boost */ }
+
+#endif // !HBRS_MPL_DT_QR_RESULT_IMPL_HPP
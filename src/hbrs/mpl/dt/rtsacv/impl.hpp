@@ -21,7 +21,9 @@
 #include "fwd.hpp"
 
 #include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/detail/workspace.hpp>
 #include <vector>
+#include <utility>
 #include <type_traits>
 
 #include <boost/hana/core/make.hpp>
@@ -36,16 +38,16 @@ struct rtsacv {
     /* Creating a new instance with std::vector<Ring> data is by design: It shows that this class always holds a copy
      * of std::vector internally. Moving data into std::vector is still possible, but it has to be done explicitly.
      */
-    //TODO: Do we have to change data_{data} to data_{std::move(data)} to move data into data_ and prevent creating an
-    //      unnecessary copy? One would have to look throught the C++ standard and/or verify that GCC and Clang are able
-    //      to generate optimal code.
-	rtsacv(std::vector<Ring> data) : data_{data} {}
+	rtsacv(std::vector<Ring> data) : data_{std::move(data)} {}
 	
-	explicit rtsacv(std::size_t size) : data_(size, Ring{0}) {}
+	/* Buffers are taken from and returned to the thread's active detail::workspace, see detail/workspace/impl.hpp */
+	explicit rtsacv(std::size_t size) : data_{detail::acquire_buffer(size, Ring{0})} {}
 
-	rtsacv(rtsacv const&) = default;
+	rtsacv(rtsacv const& other) : data_{detail::acquire_buffer(other.data_)} {}
 	rtsacv(rtsacv &&) = default;
 	
+	~rtsacv() { detail::recycle_buffer(data_); }
+	
 	rtsacv&
 	operator=(rtsacv const&) = default;
 	rtsacv&
@@ -37,6 +37,8 @@
 #include <hbrs/mpl/fn/not_equal.hpp>
 #include <hbrs/mpl/detail/translate_index.hpp>
 #include <hbrs/mpl/detail/copy_matrix.hpp>
+#include <hbrs/mpl/detail/blocked_transpose.hpp>
+#include <hbrs/mpl/detail/workspace.hpp>
 #include <hbrs/mpl/dt/exception.hpp>
 
 #include <boost/hana/core/make.hpp>
@@ -55,21 +57,24 @@ template<
 struct rtsam {
 	rtsam(matrix_size<std::size_t, std::size_t> sz) : rtsam(sz.m(), sz.n()) {}
 	
-	rtsam(std::vector<Ring> data, matrix_size<std::size_t, std::size_t> sz) : data_{data}, size_{sz} {
-		if (sz.m() * sz.n() != data.size()) {
+	rtsam(std::vector<Ring> data, matrix_size<std::size_t, std::size_t> sz) : data_{std::move(data)}, size_{sz} {
+		if (sz.m() * sz.n() != data_.size()) {
 			BOOST_THROW_EXCEPTION(
 				incompatible_matrix_sequence_exception{}
 				<< errinfo_matrix_size{sz}
-				<< errinfo_sequence_size{data.size()}
+				<< errinfo_sequence_size{data_.size()}
 			);
 		}
 	}
 	
-	rtsam(std::size_t m, std::size_t n) : data_(m * n, Ring{0}), size_{m,n} {}
+	/* Buffers are taken from and returned to the thread's active detail::workspace, see detail/workspace/impl.hpp */
+	rtsam(std::size_t m, std::size_t n) : data_{detail::acquire_buffer(m * n, Ring{0})}, size_{m,n} {}
 	
-	rtsam(rtsam const&) = default;
+	rtsam(rtsam const& other) : data_{detail::acquire_buffer(other.data_)}, size_{other.size_} {}
 	rtsam(rtsam &&) = default;
 	
+	~rtsam() { detail::recycle_buffer(data_); }
+	
 	rtsam&
 	operator=(rtsam const&) = default;
 	rtsam&
@@ -91,11 +96,12 @@ struct rtsam {
 			));
 		}
 		
-		for (std::size_t i = 0; i < (*m)(size_); ++i) {
-			for (std::size_t j = 0; j < (*n)(size_); ++j) {
-				at(make_matrix_index(i,j)) = m_.at(make_matrix_index(i,j));
-			}
-		}
+		/* A row-major m-by-n matrix has the same memory layout as a column-major n-by-m matrix, so changing the storage
+		 * order is equivalent to transposing the underlying buffer.
+		 */
+		std::size_t const rows = Order_ == storage_order::row_major ? (*m)(size_) : (*n)(size_);
+		std::size_t const cols = Order_ == storage_order::row_major ? (*n)(size_) : (*m)(size_);
+		detail::blocked_transpose(m_.data().data(), cols, data_.data(), rows, rows, cols);
 		
 		return *this;
 	}
@@ -216,6 +222,15 @@ struct rtsam {
 		);
 	}
 	
+	decltype(auto)
+	data() & { return (data_); };
+	
+	decltype(auto)
+	data() const& { return (data_); };
+	
+	decltype(auto)
+	data() && { return HBRS_MPL_FWD(data_); };
+	
 	auto
 	operator[](std::size_t i) & { return smr<rtsam &, std::size_t>{*this, i}; }
 	
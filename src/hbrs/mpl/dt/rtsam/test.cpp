@@ -24,6 +24,8 @@
 #include <hbrs/mpl/fn/m.hpp>
 #include <hbrs/mpl/fn/n.hpp>
 #include <hbrs/mpl/fn/at.hpp>
+#include <hbrs/mpl/fn/transpose.hpp>
+#include <hbrs/mpl/detail/copy_matrix.hpp>
 
 #include <hbrs/mpl/detail/test.hpp>
 
@@ -108,4 +110,45 @@ BOOST_AUTO_TEST_CASE(m_n_size_assignment) {
 	}
 }
 
+BOOST_AUTO_TEST_CASE(storage_order_conversion) {
+	using namespace hbrs::mpl;
+	
+	/* large enough to exercise the recursion of the blocked transpose kernel */
+	std::size_t const m_ = 97, n_ = 45;
+	
+	rtsam<double, storage_order::row_major> a{m_, n_};
+	for(std::size_t i = 0; i < m_; ++i) {
+		for(std::size_t j = 0; j < n_; ++j) {
+			a.at(make_matrix_index(i,j)) = i * n_ + j;
+		}
+	}
+	
+	rtsam<double, storage_order::column_major> b{m_, n_};
+	b = a;
+	
+	rtsam<double, storage_order::row_major> c{m_, n_};
+	detail::copy_matrix(b, c);
+	
+	auto at_ = (*transpose)(a);
+	static_assert(std::is_same_v<decltype(at_), rtsam<double, storage_order::column_major>>, "");
+	BOOST_TEST((*size)(at_) == make_matrix_size(n_, m_));
+	
+	auto bt = (*transpose)(rtsam<double, storage_order::column_major>{b});
+	static_assert(std::is_same_v<decltype(bt), rtsam<double, storage_order::row_major>>, "");
+	BOOST_TEST((*size)(bt) == make_matrix_size(n_, m_));
+	
+	for(std::size_t i = 0; i < m_; ++i) {
+		for(std::size_t j = 0; j < n_; ++j) {
+			double x = i * n_ + j;
+			BOOST_TEST(b.at(make_matrix_index(i,j)) == x);
+			BOOST_TEST(c.at(make_matrix_index(i,j)) == x);
+			BOOST_TEST(at_.at(make_matrix_index(j,i)) == x);
+			BOOST_TEST(bt.at(make_matrix_index(j,i)) == x);
+		}
+	}
+	
+	rtsam<double, storage_order::row_major> d{n_, m_};
+	BOOST_CHECK_THROW(detail::copy_matrix(b, d), incompatible_matrices_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
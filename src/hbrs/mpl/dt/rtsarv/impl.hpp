@@ -21,7 +21,9 @@
 #include "fwd.hpp"
 
 #include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/detail/workspace.hpp>
 #include <vector>
+#include <utility>
 #include <type_traits>
 
 #include <boost/hana/core/make.hpp>
@@ -33,13 +35,16 @@ HBRS_MPL_NAMESPACE_BEGIN
 template<typename /* type of vector entries */ Ring>
 //TODO: Merge with rtsacv
 struct rtsarv {
-	rtsarv(std::vector<Ring> data) : data_{data} {}
+	rtsarv(std::vector<Ring> data) : data_{std::move(data)} {}
 	
-	explicit rtsarv(std::size_t size) : data_(size, Ring{0}) {}
+	/* Buffers are taken from and returned to the thread's active detail::workspace, see detail/workspace/impl.hpp */
+	explicit rtsarv(std::size_t size) : data_{detail::acquire_buffer(size, Ring{0})} {}
 
-	rtsarv(rtsarv const&) = default;
+	rtsarv(rtsarv const& other) : data_{detail::acquire_buffer(other.data_)} {}
 	rtsarv(rtsarv &&) = default;
 	
+	~rtsarv() { detail::recycle_buffer(data_); }
+	
 	rtsarv&
 	operator=(rtsarv const&) = default;
 	rtsarv&
@@ -0,0 +1,45 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_DT_SVD_ALGORITHM_FWD_HPP
+#define HBRS_MPL_DT_SVD_ALGORITHM_FWD_HPP
+
+#include <hbrs/mpl/config.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+
+/*
+ * Algorithm which computes the SVD in the native backend:
+ *  - qr_iteration: Golub-Kahan implicit-shift QR sweeps (Algorithm 8.6.2) on the bidiagonal matrix,
+ *  - divide_and_conquer: Gu-Eisenstat divide-and-conquer on the bidiagonal matrix, independent subproblems are solved
+ *    in parallel,
+ *  - dqds: differential qd with shifts on the bidiagonal matrix, which computes singular values only, i.e. u() and v()
+ *    are left empty,
+ *  - jacobi: one-sided Jacobi on A itself, disjoint column pairs are rotated in parallel,
+ *  - preconditioned_jacobi: one-sided Jacobi on the triangular factor R of a QR decomposition of A.
+ */
+enum class svd_algorithm { qr_iteration, divide_and_conquer, dqds, jacobi, preconditioned_jacobi };
+template <svd_algorithm alg>
+using svd_algorithm_ = hana::integral_constant<svd_algorithm, alg>;
+template <svd_algorithm alg>
+constexpr svd_algorithm_<alg> svd_algorithm_c{};
+
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_DT_SVD_ALGORITHM_FWD_HPP
@@ -18,13 +18,14 @@
 #define HBRS_MPL_DT_SVD_CONTROL_FWD_HPP
 
 #include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/dt/svd_algorithm/fwd.hpp>
 #include <boost/hana/fwd/core/make.hpp>
 #include <boost/hana/fwd/core/to.hpp>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
 
-template<typename DecomposeMode>
+template<typename DecomposeMode, typename Algorithm = svd_algorithm>
 struct svd_control;
 struct svd_control_tag {};
 constexpr auto make_svd_control = hana::make<svd_control_tag>;
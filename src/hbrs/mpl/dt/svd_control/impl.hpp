@@ -27,7 +27,10 @@
 
 HBRS_MPL_NAMESPACE_BEGIN
 
-template<typename DecomposeMode>
+/*
+ * algorithm selects the bidiagonal SVD of the native backend, see svd_algorithm. Other backends ignore it.
+ */
+template<typename DecomposeMode, typename Algorithm>
 struct svd_control {
 	template<
 		typename DecomposeMode_ = DecomposeMode,
@@ -47,7 +50,20 @@ struct svd_control {
 	>
 	constexpr 
 	svd_control(DecomposeMode_ && dm)
-	: decompose_mode_{HBRS_MPL_FWD(dm)}
+	: decompose_mode_{HBRS_MPL_FWD(dm)}, algorithm_{}
+	{}
+	
+	template<
+		typename DecomposeMode_ = DecomposeMode,
+		typename Algorithm_ = Algorithm,
+		typename std::enable_if_t<
+			detail::is_braces_constructible_v<DecomposeMode, DecomposeMode_> &&
+			detail::is_braces_constructible_v<Algorithm, Algorithm_>
+		>* = nullptr
+	>
+	constexpr 
+	svd_control(DecomposeMode_ && dm, Algorithm_ && alg)
+	: decompose_mode_{HBRS_MPL_FWD(dm)}, algorithm_{HBRS_MPL_FWD(alg)}
 	{}
 	
 	constexpr 
@@ -69,16 +85,26 @@ struct svd_control {
 	constexpr decltype(auto)
 	decompose_mode() && { return HBRS_MPL_FWD(decompose_mode_); };
 	
+	constexpr decltype(auto)
+	algorithm() & { return (algorithm_); };
+	
+	constexpr decltype(auto)
+	algorithm() const& { return (algorithm_); };
+	
+	constexpr decltype(auto)
+	algorithm() && { return HBRS_MPL_FWD(algorithm_); };
+	
 private:
 	DecomposeMode decompose_mode_;
+	Algorithm algorithm_;
 };
 
 HBRS_MPL_NAMESPACE_END
 
 namespace boost { namespace hana {
 
-template <typename DecomposeMode>
-struct tag_of< hbrs::mpl::svd_control<DecomposeMode> > {
+template <typename DecomposeMode, typename Algorithm>
+struct tag_of< hbrs::mpl::svd_control<DecomposeMode, Algorithm> > {
 	using type = hbrs::mpl::svd_control_tag;
 };
 
@@ -91,6 +117,15 @@ struct make_impl<hbrs::mpl::svd_control_tag> {
 	apply(DecomposeMode && dm) {
 		return { HBRS_MPL_FWD(dm) };
 	}
+	
+	template <typename DecomposeMode, typename Algorithm>
+	static constexpr hbrs::mpl::svd_control<
+		std::decay_t<DecomposeMode>,
+		std::decay_t<Algorithm>
+	>
+	apply(DecomposeMode && dm, Algorithm && alg) {
+		return { HBRS_MPL_FWD(dm), HBRS_MPL_FWD(alg) };
+	}
 };
 
 /* namespace hana */ } /* namespace boost */ }
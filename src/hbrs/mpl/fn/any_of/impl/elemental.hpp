@@ -25,9 +25,8 @@
 #include <hbrs/mpl/dt/el_vector.hpp>
 #include <hbrs/mpl/dt/el_dist_matrix.hpp>
 #include <hbrs/mpl/dt/el_dist_vector.hpp>
+#include <hbrs/mpl/detail/hierarchical.hpp>
 #include <hbrs/mpl/detail/mpi.hpp>
-#include <vector>
-#include <algorithm>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace detail {
@@ -62,11 +61,10 @@ any_of_el_dist_matrix_impl(
 	El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
 	UnaryPredicate && pred
 ) {
-	// Converting bool to int because std::vector<bool> does not provide pointer-access.
-	int lcl = any_of_el_matrix_impl(a.LockedMatrix(), pred);
-	std::vector<int> gbl(boost::numeric_cast<std::size_t>(mpi::comm_size(a.Grid().Comm().comm)), false);
-	mpi::allgather(&lcl, 1, gbl.data(), 1, a.Grid().Comm().comm);
-	return std::any_of(gbl.begin(), gbl.end(), [](int x) { return x == true; });
+	// Converting bool to int because MPI_LOR is not defined for MPI_CXX_BOOL by all MPI implementations.
+	int any = any_of_el_matrix_impl(a.LockedMatrix(), pred);
+	mpi::hierarchical_allreduce(MPI_IN_PLACE, &any, 1, MPI_INT, MPI_LOR, a.Grid().Comm().comm);
+	return any != 0;
 }
 	
 template <
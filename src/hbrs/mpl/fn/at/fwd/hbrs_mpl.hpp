@@ -39,6 +39,7 @@
 #include <hbrs/mpl/dt/zas/fwd.hpp>
 #include <hbrs/mpl/dt/bidiag_result/fwd.hpp>
 #include <hbrs/mpl/dt/svd_result/fwd.hpp>
+#include <hbrs/mpl/dt/qr_result/fwd.hpp>
 #include <hbrs/mpl/dt/pca_result/fwd.hpp>
 #include <hbrs/mpl/dt/pca_filter_result/fwd.hpp>
 #include <hbrs/mpl/dt/dmd_result/fwd.hpp>
@@ -84,6 +85,8 @@ _HBRS_MPL_DEC_FO_NAMED_AT(at_impl_bidiag_v, bidiag_result_tag, bidiag_v, v)
 _HBRS_MPL_DEC_FO_NAMED_AT(at_impl_svd_u, svd_result_tag, svd_u, u)
 _HBRS_MPL_DEC_FO_NAMED_AT(at_impl_svd_s, svd_result_tag, svd_s, s)
 _HBRS_MPL_DEC_FO_NAMED_AT(at_impl_svd_v, svd_result_tag, svd_v, v)
+_HBRS_MPL_DEC_FO_NAMED_AT(at_impl_qr_q, qr_result_tag, qr_q, q)
+_HBRS_MPL_DEC_FO_NAMED_AT(at_impl_qr_r, qr_result_tag, qr_r, r)
 _HBRS_MPL_DEC_FO_NAMED_AT(at_impl_pca_coeff,  pca_result_tag, pca_coeff,  coeff)
 _HBRS_MPL_DEC_FO_NAMED_AT(at_impl_pca_score,  pca_result_tag, pca_score,  score)
 _HBRS_MPL_DEC_FO_NAMED_AT(at_impl_pca_latent, pca_result_tag, pca_latent, latent)
@@ -124,6 +127,8 @@ HBRS_MPL_NAMESPACE_END
 		hbrs::mpl::detail::at_impl_svd_u{},                                                                            \
 		hbrs::mpl::detail::at_impl_svd_s{},                                                                            \
 		hbrs::mpl::detail::at_impl_svd_v{},                                                                            \
+		hbrs::mpl::detail::at_impl_qr_q{},                                                                             \
+		hbrs::mpl::detail::at_impl_qr_r{},                                                                             \
 		hbrs::mpl::detail::at_impl_pca_coeff{},                                                                        \
 		hbrs::mpl::detail::at_impl_pca_score{},                                                                        \
 		hbrs::mpl::detail::at_impl_pca_latent{},                                                                       \
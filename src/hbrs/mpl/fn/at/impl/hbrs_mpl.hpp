@@ -40,6 +40,7 @@
 #include <hbrs/mpl/dt/zas.hpp>
 #include <hbrs/mpl/dt/bidiag_result.hpp>
 #include <hbrs/mpl/dt/svd_result.hpp>
+#include <hbrs/mpl/dt/qr_result.hpp>
 #include <hbrs/mpl/dt/pca_result.hpp>
 #include <hbrs/mpl/dt/pca_filter_result.hpp>
 #include <hbrs/mpl/dt/dmd_result.hpp>
@@ -83,6 +84,8 @@ _HBRS_MPL_DEF_FO_NAMED_AT(at_impl_bidiag_v, bidiag_result_tag, bidiag_v, v)
 _HBRS_MPL_DEF_FO_NAMED_AT(at_impl_svd_u, svd_result_tag, svd_u, u)
 _HBRS_MPL_DEF_FO_NAMED_AT(at_impl_svd_s, svd_result_tag, svd_s, s)
 _HBRS_MPL_DEF_FO_NAMED_AT(at_impl_svd_v, svd_result_tag, svd_v, v)
+_HBRS_MPL_DEF_FO_NAMED_AT(at_impl_qr_q, qr_result_tag, qr_q, q)
+_HBRS_MPL_DEF_FO_NAMED_AT(at_impl_qr_r, qr_result_tag, qr_r, r)
 _HBRS_MPL_DEF_FO_NAMED_AT(at_impl_pca_coeff,  pca_result_tag, pca_coeff,  coeff)
 _HBRS_MPL_DEF_FO_NAMED_AT(at_impl_pca_score,  pca_result_tag, pca_score,  score)
 _HBRS_MPL_DEF_FO_NAMED_AT(at_impl_pca_latent, pca_result_tag, pca_latent, latent)
@@ -34,6 +34,13 @@ struct bidiag_impl_rtsam {
 	>
 	auto
 	operator()(rtsam<Ring,Order> const& x, bidiag_control<decompose_mode> const& ctrl) const;
+	
+	template<
+		typename Ring,
+		storage_order Order
+	>
+	auto
+	operator()(rtsam<Ring,Order> && x, bidiag_control<decompose_mode> const& ctrl) const;
 };
 
 /* namespace detail */ }
@@ -23,6 +23,10 @@ template auto bidiag_impl_rtsam::operator()(rtsam<float,  storage_order::row_maj
 template auto bidiag_impl_rtsam::operator()(rtsam<float,  storage_order::column_major> const&, bidiag_control<decompose_mode> const&) const;
 template auto bidiag_impl_rtsam::operator()(rtsam<double, storage_order::row_major   > const&, bidiag_control<decompose_mode> const&) const;
 template auto bidiag_impl_rtsam::operator()(rtsam<double, storage_order::column_major> const&, bidiag_control<decompose_mode> const&) const;
+template auto bidiag_impl_rtsam::operator()(rtsam<float,  storage_order::row_major   > &&,      bidiag_control<decompose_mode> const&) const;
+template auto bidiag_impl_rtsam::operator()(rtsam<float,  storage_order::column_major> &&,      bidiag_control<decompose_mode> const&) const;
+template auto bidiag_impl_rtsam::operator()(rtsam<double, storage_order::row_major   > &&,      bidiag_control<decompose_mode> const&) const;
+template auto bidiag_impl_rtsam::operator()(rtsam<double, storage_order::column_major> &&,      bidiag_control<decompose_mode> const&) const;
 
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
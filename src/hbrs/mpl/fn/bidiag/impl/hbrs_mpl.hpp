@@ -36,9 +36,8 @@
 #include <hbrs/mpl/fn/m.hpp>
 #include <hbrs/mpl/fn/n.hpp>
 #include <hbrs/mpl/fn/greater_equal.hpp>
-#include <hbrs/mpl/fn/any_of.hpp>
-#include <hbrs/mpl/detail/is_nan.hpp>
-#include <hbrs/mpl/detail/is_inf.hpp>
+#include <hbrs/mpl/detail/validation.hpp>
+#include <hbrs/mpl/detail/workspace.hpp>
 #include <cmath>
 
 HBRS_MPL_NAMESPACE_BEGIN
@@ -51,17 +50,17 @@ namespace detail {
  *
  * In comparison with the book:
  *      In the book the Algorithm directly overwrites A. Instead we
- *      make a copy of A, and call it B, and we overwrite B. We don't
- *      overwrite A. And instead of storing U' and V together with B
- *      inside A, we return a type that contains U', B and V called
- *      BidiagResult.
+ *      take A by value, and call it B, and we overwrite B. Callers
+ *      passing an lvalue keep their A untouched, rvalues are consumed.
+ *      And instead of storing U' and V together with B inside A, we
+ *      return a type that contains U', B and V called BidiagResult.
  */
 template<
 	typename Ring,
 	storage_order Order
 >
 auto
-bidiag_impl_rtsam::operator()(rtsam<Ring,Order> const& x, bidiag_control<decompose_mode> const& ctrl) const {
+bidiag_rtsam(rtsam<Ring,Order> A, bidiag_control<decompose_mode> const& ctrl) {
 	//TODO: Implement other decomposition modes!
 	if (ctrl.decompose_mode() != decompose_mode::complete) {
 		BOOST_THROW_EXCEPTION(not_supported_exception{} << errinfo_decompose_mode{ctrl.decompose_mode()});
@@ -75,7 +74,7 @@ bidiag_impl_rtsam::operator()(rtsam<Ring,Order> const& x, bidiag_control<decompo
 		matrix_size<std::size_t, std::size_t>
 	>;
 	
-	auto x_sz = (*size)(x);
+	auto x_sz = (*size)(A);
 	auto x_m = (*m)(x_sz);
 	auto x_n = (*n)(x_sz);
 	
@@ -84,9 +83,6 @@ bidiag_impl_rtsam::operator()(rtsam<Ring,Order> const& x, bidiag_control<decompo
 	}
 	BOOST_ASSERT((*greater_equal)(x_m, x_n));
 	
-	BOOST_ASSERT(any_of(x, is_inf) == false);
-	BOOST_ASSERT(any_of(x, is_nan) == false);
-
 	// returns a square Identity Matrix with size amount of rows and columns
 	auto make_identity = [](std::size_t size) {
 		typedef std::decay_t<Ring> _Ring_;
@@ -97,21 +93,19 @@ bidiag_impl_rtsam::operator()(rtsam<Ring,Order> const& x, bidiag_control<decompo
 		return id_;
 	};
 	
+	// householder vectors and matrices of each iteration below reuse the buffers of the previous iteration
+	scoped_workspace<std::decay_t<Ring>> workspace;
+	
 	auto U = make_identity(x_m);
-	auto A = x;
 	auto V = make_identity(x_n);
 	static_assert(std::is_same_v<decltype(U), matrix>, "");
 	static_assert(std::is_same_v<decltype(A), matrix>, "");
 	static_assert(std::is_same_v<decltype(V), matrix>, "");
 	
-	BOOST_ASSERT(any_of(U, is_inf) == false);
-	BOOST_ASSERT(any_of(U, is_nan) == false);
-	BOOST_ASSERT(any_of(A, is_inf) == false);
-	BOOST_ASSERT(any_of(A, is_nan) == false);
-	BOOST_ASSERT(any_of(V, is_inf) == false);
-	BOOST_ASSERT(any_of(V, is_nan) == false);
+	validate_finite(validation_level::input, A);
 
-	for (std::size_t j = 0; j < (x_n-1); ++j) {
+	/* If x_m > x_n, then the last column has to be reduced as well, see Algorithm 5.4.2 */
+	for (std::size_t j = 0; j < (x_m > x_n ? x_n : x_n-1); ++j) {
 		range<std::size_t,std::size_t> jm  {j    , x_m-1};
 		range<std::size_t,std::size_t> jn  {j    , x_n-1};
 		range<std::size_t,std::size_t> j1n {j + 1, x_n-1};
@@ -147,7 +141,7 @@ bidiag_impl_rtsam::operator()(rtsam<Ring,Order> const& x, bidiag_control<decompo
 		static_assert(std::is_same_v<decltype(Uijmjm), matrix_view>, "");
 		U = (*multiply)(Ui, U);
 
-		if ((j + 1) <= (x_n - 2)) {
+		if (j + 2 < x_n) {
 			auto Ajj1n = (*select)(A, std::make_pair(j, j1n));
 			static_assert(std::is_same_v<decltype(Ajj1n), rtsarv<Ring>>, "");
 			auto h = (*house)(transpose(Ajj1n));
@@ -164,20 +158,39 @@ bidiag_impl_rtsam::operator()(rtsam<Ring,Order> const& x, bidiag_control<decompo
 			 * do that.
 			 */
 			
-			auto Vjmj1n = (*select)(V, std::make_pair(jn, j1n));
-			static_assert(std::is_same_v<decltype(Vjmj1n), matrix_view>, "");
-			Vjmj1n = (*minus)(Vjmj1n, multiply(multiply(Vjmj1n,ni), transpose(multiply(beta,ni))));
+			/*
+			 * V is accumulated as V*H_0*H_1*... so rows 1 to x_n-1 of
+			 * V(:,j+1:x_n) are filled in already, only row 0 is zero.
+			 */
+			auto V1nj1n = (*select)(V, std::make_pair(range<std::size_t,std::size_t>{1u, x_n-1}, j1n));
+			static_assert(std::is_same_v<decltype(V1nj1n), matrix_view>, "");
+			V1nj1n = (*minus)(V1nj1n, multiply(multiply(V1nj1n,ni), transpose(multiply(beta,ni))));
 		}
 		
-		BOOST_ASSERT(any_of(U, is_inf) == false);
-		BOOST_ASSERT(any_of(U, is_nan) == false);
-		BOOST_ASSERT(any_of(A, is_inf) == false);
-		BOOST_ASSERT(any_of(A, is_nan) == false);
-		BOOST_ASSERT(any_of(V, is_inf) == false);
-		BOOST_ASSERT(any_of(V, is_nan) == false);
+		validate_finite(validation_level::all, U);
+		validate_finite(validation_level::all, A);
+		validate_finite(validation_level::all, V);
 	}
 	
-	return make_bidiag_result((*transpose)(U), A, V);
+	return make_bidiag_result((*transpose)(std::move(U)), std::move(A), std::move(V));
+}
+
+template<
+	typename Ring,
+	storage_order Order
+>
+auto
+bidiag_impl_rtsam::operator()(rtsam<Ring,Order> const& x, bidiag_control<decompose_mode> const& ctrl) const {
+	return bidiag_rtsam(x, ctrl);
+}
+
+template<
+	typename Ring,
+	storage_order Order
+>
+auto
+bidiag_impl_rtsam::operator()(rtsam<Ring,Order> && x, bidiag_control<decompose_mode> const& ctrl) const {
+	return bidiag_rtsam(std::move(x), ctrl);
 }
 
 /* namespace detail */ }
@@ -371,4 +371,47 @@ BOOST_AUTO_TEST_CASE(bidiag_comparison, * utf::tolerance(_TOL)) {
 	});
 }
 
+BOOST_AUTO_TEST_CASE(bidiag_rvalue, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	auto const dataset = make_sm(
+		make_ctsav(detail::mat_g), make_matrix_size(hana::size_c<detail::mat_g_m>, hana::size_c<detail::mat_g_n>), row_major_c
+	);
+	auto const ctrl = bidiag_control<decompose_mode>{decompose_mode::complete};
+	
+	auto const a = make_rtsam(dataset);
+	auto const lvalue_result = (*bidiag)(a, ctrl);
+	auto const rvalue_result = (*bidiag)(make_rtsam(dataset), ctrl);
+	
+	HBRS_MPL_TEST_MMEQ(a, dataset, false);
+	HBRS_MPL_TEST_MMEQ((*at)(lvalue_result, bidiag_u{}), (*at)(rvalue_result, bidiag_u{}), false);
+	HBRS_MPL_TEST_MMEQ((*at)(lvalue_result, bidiag_b{}), (*at)(rvalue_result, bidiag_b{}), false);
+	HBRS_MPL_TEST_MMEQ((*at)(lvalue_result, bidiag_v{}), (*at)(rvalue_result, bidiag_v{}), false);
+}
+
+BOOST_AUTO_TEST_CASE(bidiag_single_column, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	// matrices with a single column have no upper Householder step, see bidiag()
+	for (std::size_t m_ : { 1u, 3u }) {
+		BOOST_TEST_MESSAGE("m=" << m_ << ", n=1");
+		rtsam<double, storage_order::row_major> a{m_, 1u};
+		for (std::size_t i = 0; i < m_; ++i) {
+			a.at(make_matrix_index(i, 0u)) = 1. + 2. * i;
+		}
+		
+		auto const usv = (*bidiag)(a, bidiag_control<decompose_mode>{decompose_mode::complete});
+		auto const& u = (*at)(usv, bidiag_u{});
+		auto const& b = (*at)(usv, bidiag_b{});
+		auto const& v = (*at)(usv, bidiag_v{});
+		
+		HBRS_MPL_TEST_MMEQ((*multiply)((*multiply)(u, b), transpose(v)), a, false);
+		HBRS_MPL_TEST_IS_IDENTITY((*multiply)(u, transpose(u)));
+		HBRS_MPL_TEST_IS_IDENTITY((*multiply)(v, transpose(v)));
+		for (std::size_t i = 1; i < m_; ++i) {
+			BOOST_TEST(b.at(make_matrix_index(i, 0u)) == 0.);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,7 @@
 	#include <hbrs/mpl/dt/dmd_control/fwd.hpp>
 	#include <hbrs/mpl/dt/el_matrix/fwd.hpp>
 	#include <hbrs/mpl/dt/el_dist_matrix/fwd.hpp>
+	#include <hbrs/mpl/dt/hankel_matrix/fwd.hpp>
 #endif
 #include <boost/hana/tuple.hpp>
 #include <type_traits>
@@ -67,9 +68,41 @@ struct dmd_impl_el_dist_matrix {
 	) const;
 };
 
+/* Higher-order DMD on block-Hankel (delay-embedded) snapshot matrices, see dt/hankel_matrix */
+struct dmd_impl_el_hankel_matrix {
+	template <
+		typename Ring,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			std::is_arithmetic_v<std::remove_const_t<Ring>>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		hankel_matrix<el_matrix<Ring>, El::Int> const& x1,
+		hankel_matrix<el_matrix<Ring>, El::Int> const& x2,
+		dmd_control<El::Int> const& ctrl
+	) const;
+	
+	template<
+		typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			std::is_arithmetic_v<std::remove_const_t<Ring>>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		hankel_matrix<el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>, El::Int> const& x1,
+		hankel_matrix<el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>, El::Int> const& x2,
+		dmd_control<El::Int> const& ctrl
+	) const;
+};
+
 #else
 struct dmd_impl_el_matrix {};
 struct dmd_impl_el_dist_matrix {};
+struct dmd_impl_el_hankel_matrix {};
 #endif
 
 /* namespace detail */ }
@@ -77,7 +110,8 @@ HBRS_MPL_NAMESPACE_END
 
 #define HBRS_MPL_FN_DMD_IMPLS_ELEMENTAL boost::hana::make_tuple(                                                       \
 		hbrs::mpl::detail::dmd_impl_el_matrix{},                                                                       \
-		hbrs::mpl::detail::dmd_impl_el_dist_matrix{}                                                                   \
+		hbrs::mpl::detail::dmd_impl_el_dist_matrix{},                                                                  \
+		hbrs::mpl::detail::dmd_impl_el_hankel_matrix{}                                                                 \
 	)
 
 #endif // !HBRS_MPL_FN_DMD_FWD_ELEMENTAL_HPP
@@ -28,6 +28,10 @@
 #include <hbrs/mpl/dt/el_vector.hpp>
 #include <hbrs/mpl/dt/el_dist_matrix.hpp>
 #include <hbrs/mpl/dt/el_dist_vector.hpp>
+#include <hbrs/mpl/dt/eig_control.hpp>
+#include <hbrs/mpl/dt/eig_result.hpp>
+#include <hbrs/mpl/dt/svd_result.hpp>
+#include <hbrs/mpl/dt/hankel_matrix.hpp>
 
 #include <hbrs/mpl/detail/log.hpp>
 
@@ -42,6 +46,7 @@
 #include <hbrs/mpl/fn/multiply.hpp>
 #include <hbrs/mpl/fn/inverse.hpp>
 #include <hbrs/mpl/fn/eig.hpp>
+#include <hbrs/mpl/fn/at.hpp>
 #include <hbrs/mpl/fn/mldivide.hpp>
 #include <hbrs/mpl/fn/complex.hpp>
 
@@ -53,6 +58,150 @@ namespace hana = boost::hana;
 namespace detail {
 namespace dmd_impl_el {
 
+/* Reduced-order operands such as A~ are only r-by-r with r <= target rank. Distributed matrices of this size are
+ * replicated ([STAR,STAR]) and processed redundantly on each rank with local LAPACK routines if r does not exceed
+ * ctrl.redundant_threshold(), because distributed routines are dominated by latency for tiny matrices. Results are
+ * redistributed afterwards, which for [STAR,STAR] sources does not require any communication.
+ */
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Control>
+static bool
+is_redundant(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a, Control const& ctrl) {
+	return a.Height() <= ctrl.redundant_threshold() && a.Width() <= ctrl.redundant_threshold();
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static El::Matrix<Ring>
+replicate(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a) {
+	El::DistMatrix<Ring, El::STAR, El::STAR, Wrapping> a_ss = a;
+	return std::move(a_ss.Matrix());
+}
+
+template<El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Ring>
+static El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping>
+distribute(El::Grid const& grid, El::Matrix<Ring> local) {
+	auto a_ss = make_el_dist_matrix(grid, std::move(local));
+	El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> a{grid};
+	a = a_ss.data();
+	return a;
+}
+
+template<typename Ring, typename Control>
+static decltype(auto)
+reduced_eig(el_matrix<Ring> const& a, Control const&) {
+	return (*eig)(a, eig_control<>{});
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Control>
+static auto
+reduced_eig(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a, Control const& ctrl) {
+	typedef El::Complex<El::Base<std::remove_const_t<Ring>>> Complex;
+	
+	if (!is_redundant(a.data(), ctrl)) {
+		return (*eig)(a, eig_control<>{});
+	}
+	
+	auto const& grid = a.data().Grid();
+	auto VD = (*eig)(el_matrix<std::remove_const_t<Ring>>{ replicate(a.data()) }, eig_control<>{});
+	auto && w = (*at)(VD, eig_eigenvalues{});
+	auto && X = (*at)(VD, eig_eigenvectors{});
+	return make_eig_result(
+		el_dist_column_vector<Complex>{ distribute<El::MC, El::MR, El::ELEMENT>(grid, std::move(w).data()) },
+		el_dist_matrix<Complex>{ distribute<El::MC, El::MR, El::ELEMENT>(grid, std::move(X).data()) }
+	);
+}
+
+template<typename Ring, typename Control>
+static decltype(auto)
+reduced_inverse(diagonal_matrix_without_zeros_on_main_diagonal<el_matrix<Ring>> const& a, Control const&) {
+	return (*inverse)(a);
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename Control>
+static auto
+reduced_inverse(
+	diagonal_matrix_without_zeros_on_main_diagonal<el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>> const& a,
+	Control const& ctrl
+) {
+	typedef std::remove_const_t<Ring> _Ring_;
+	typedef el_dist_matrix<_Ring_, Columnwise, Rowwise, Wrapping> Matrix;
+	
+	if (!is_redundant(a.data.data(), ctrl)) {
+		return Matrix{ (*inverse)(a) };
+	}
+	
+	auto inv = (*inverse)(
+		diagonal_matrix_without_zeros_on_main_diagonal<el_matrix<_Ring_>>{ {replicate(a.data.data())} }
+	);
+	return Matrix{ distribute<Columnwise, Rowwise, Wrapping>(a.data.data().Grid(), std::move(inv).data()) };
+}
+
+/* The amplitudes b of the DMD modes Phi are defined by Phi*b = x1, with x1 being the first snapshot. Instead of solving
+ * this m-by-r least-squares problem, both sides are projected onto the POD modes U_r. dmd() computes the exact modes
+ * Phi = X2*V_r*inv(S_r)*W_r and A~ = U_r'*X2*V_r*inv(S_r), hence U_r'*Phi = A~*W_r = W_r*D. This yields the r-by-r
+ * system W_r*D*b = U_r'*x1 [1], which requires only a single real Gemv on the tall matrix U_r.
+ *
+ * NOTE: Projected amplitudes equal the least-squares amplitudes only if x1 lies in the span of the DMD modes.
+ *
+ * References:
+ * [1] Jonathan H. Tu et al., "On dynamic mode decomposition: Theory and applications", J. Comput. Dyn., 2014.
+ */
+template<typename Matrix, typename Vector, typename RealVector, typename Result>
+static Result
+solve_projected(Matrix w_r, Vector const& d, RealVector const& x1_r, Result b) {
+	El::DiagonalScale(El::RIGHT, El::NORMAL, d, w_r);
+	El::Copy(x1_r, b);
+	El::LinearSolve(w_r, b);
+	return b;
+}
+
+template<typename RingU, typename Ring, typename Complex, typename Control>
+static el_column_vector<Complex>
+projected_amplitudes(
+	el_matrix<RingU> const& u_r,
+	el_column_vector<Ring> const& x1,
+	el_matrix<Complex> const& w_r,
+	el_column_vector<Complex> const& d,
+	Control const&
+) {
+	typedef std::remove_const_t<Ring> _Ring_;
+	El::Matrix<_Ring_> x1_r;
+	El::Gemv(El::ADJOINT, _Ring_(1), u_r.data(), x1.data(), x1_r);
+	return { solve_projected(w_r.data(), d.data(), x1_r, El::Matrix<Complex>{}) };
+}
+
+template<
+	typename RingU, El::Dist ColumnwiseU, El::Dist RowwiseU,
+	typename Ring, El::Dist ColumnwiseX, El::Dist RowwiseX,
+	typename Complex, El::Dist ColumnwiseW, El::Dist RowwiseW,
+	/*            */ El::Dist ColumnwiseD, El::Dist RowwiseD,
+	El::DistWrap Wrapping, typename Control
+>
+static el_dist_column_vector<Complex, ColumnwiseX, RowwiseX, Wrapping>
+projected_amplitudes(
+	el_dist_matrix<RingU, ColumnwiseU, RowwiseU, Wrapping> const& u_r,
+	el_dist_column_vector<Ring, ColumnwiseX, RowwiseX, Wrapping> const& x1,
+	el_dist_matrix<Complex, ColumnwiseW, RowwiseW, Wrapping> const& w_r,
+	el_dist_column_vector<Complex, ColumnwiseD, RowwiseD, Wrapping> const& d,
+	Control const& ctrl
+) {
+	typedef std::remove_const_t<Ring> _Ring_;
+	auto const& grid = u_r.data().Grid();
+	
+	El::DistMatrix<_Ring_, El::MC, El::MR, Wrapping> x1_r{grid};
+	El::Gemv(El::ADJOINT, _Ring_(1), u_r.data(), x1.data(), x1_r);
+	
+	if (!is_redundant(w_r.data(), ctrl)) {
+		return { solve_projected(
+			w_r.data(), d.data(), x1_r, El::DistMatrix<Complex, ColumnwiseX, RowwiseX, Wrapping>{grid}
+		) };
+	}
+	
+	return { distribute<ColumnwiseX, RowwiseX, Wrapping>(
+		grid,
+		solve_projected(replicate(w_r.data()), replicate(d.data()), replicate(x1_r), El::Matrix<Complex>{})
+	) };
+}
+
 //TODO: Turn this code into a dedicated, generic dmd() implementation
 /* C++ code is equivalent to MATLAB code in file src/hbrs/mpl/detail/matlab_cxn/impl/dmd_level1.m */
 template <typename X1, typename X2, typename Control>
@@ -107,6 +256,8 @@ dmd(
 	HBRS_MPL_LOG_TRIVIAL(trace) << "S_r:" << loggable{S_r};
 	HBRS_MPL_LOG_TRIVIAL(trace) << "V_r:" << loggable{V_r};
 	
+	auto S_r_inv = reduced_inverse(diagonal_matrix_without_zeros_on_main_diagonal<decltype(S_r)>{S_r}, ctrl);
+	
 	auto Atilde =
 		(*multiply)(
 			multiply(
@@ -116,12 +267,12 @@ dmd(
 				),
 				V_r
 			),
-			inverse(diagonal_matrix_without_zeros_on_main_diagonal<decltype(S_r)>{S_r})
+			S_r_inv
 		);
 	
 	HBRS_MPL_LOG_TRIVIAL(trace) << "A~:" << loggable{Atilde};
 	
-	auto VD = (*eig)(Atilde, eig_control<>{});
+	auto VD = reduced_eig(Atilde, ctrl);
 	auto && D   = (*at)(VD, eig_eigenvalues{});
 	auto && W_r = (*at)(VD, eig_eigenvectors{});
 	
@@ -132,7 +283,7 @@ dmd(
 		(*multiply)(
 			multiply(
 				multiply(x2, V_r),
-				inverse(diagonal_matrix_without_zeros_on_main_diagonal<decltype(S_r)>{S_r})
+				S_r_inv
 			),
 			W_r
 		);
@@ -141,7 +292,9 @@ dmd(
 	
 	auto col1 = (*select)(std::move(x1), std::make_pair(El::ALL, 0));
     // TODO: Handle col1 having only zeros!
-	auto coefficients = (*mldivide)(modes, complex(col1, _Ring_(0)));
+	auto coefficients = ctrl.amplitudes() == dmd_amplitudes::projected
+		? projected_amplitudes(U_r, col1, W_r, D, ctrl)
+		: (*mldivide)(modes, complex(col1, _Ring_(0)));
 	
 	HBRS_MPL_LOG_TRIVIAL(trace) << "col1:" << loggable{col1};
 	
@@ -152,6 +305,194 @@ dmd(
 	return make_dmd_result(eigenvalues, modes, coefficients);
 }
 
+/* Oversampling and number of power iterations of the randomized SVD in hodmd(), see [1] in randomized_svd() */
+constexpr El::Int hodmd_oversampling = 10;
+constexpr El::Int hodmd_power_iterations = 2;
+
+template<typename Ring>
+static el_matrix<std::remove_const_t<Ring>>
+gaussian_like(el_matrix<Ring> const&, El::Int m, El::Int n) {
+	el_matrix<std::remove_const_t<Ring>> a{0, 0};
+	El::Gaussian(a.data(), m, n);
+	return a;
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static el_dist_matrix<std::remove_const_t<Ring>>
+gaussian_like(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& like, El::Int m, El::Int n) {
+	el_dist_matrix<std::remove_const_t<Ring>> a{like.data().Grid(), 0, 0};
+	El::Gaussian(a.data(), m, n);
+	return a;
+}
+
+/* First column of a block-Hankel matrix (see dt/hankel_matrix), i.e. the first d snapshots stacked on top of each other */
+template<typename Ring>
+static el_matrix<std::remove_const_t<Ring>>
+first_hankel_column(el_matrix<Ring> const& x, El::Int delays) {
+	el_matrix<std::remove_const_t<Ring>> c{0, 0};
+	El::Reshape(x.data().Height() * delays, 1, x.data()(El::ALL, El::IR(0, delays)), c.data());
+	return c;
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static el_dist_matrix<std::remove_const_t<Ring>>
+first_hankel_column(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& x, El::Int delays) {
+	el_dist_matrix<std::remove_const_t<Ring>> c{x.data().Grid(), 0, 0};
+	El::Reshape(x.data().Height() * delays, 1, x.data()(El::ALL, El::IR(0, delays)), c.data());
+	return c;
+}
+
+template<typename Ring>
+static el_column_vector<Ring>
+to_column_vector(el_matrix<Ring> a) {
+	BOOST_ASSERT(a.data().Width() == 1);
+	return { std::move(a).data() };
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static el_dist_column_vector<Ring, Columnwise, Rowwise, Wrapping>
+to_column_vector(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> a) {
+	BOOST_ASSERT(a.data().Width() == 1);
+	return { std::move(a).data() };
+}
+
+template<typename Ring>
+static el_matrix<Ring>
+first_rows(el_matrix<Ring> const& a, El::Int m) {
+	el_matrix<Ring> b{0, 0};
+	El::Copy(a.data()(El::IR(0, m), El::ALL), b.data());
+	return b;
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>
+first_rows(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a, El::Int m) {
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> b{a.data().Grid(), 0, 0};
+	El::Copy(a.data()(El::IR(0, m), El::ALL), b.data());
+	return b;
+}
+
+/* Randomized SVD [1] of an operator A which supports multiply(A,B) and multiply(transpose(A),B), e.g. a block-Hankel
+ * matrix. Q is an orthonormal basis of (A*A')^q*A*Omega for Gaussian test vectors Omega and the SVD of the small matrix
+ * B' = (Q'*A)' = A'*Q = U_b*S*V_b' yields A ~= (Q*V_b)*S*U_b'. A is accessed only by products with tall-skinny
+ * matrices, hence it is never formed explicitly.
+ *
+ * References:
+ * [1] N. Halko, P. G. Martinsson and J. A. Tropp, "Finding Structure with Randomness: Probabilistic Algorithms for
+ *     Constructing Approximate Matrix Decompositions", SIAM Review, 53(2), 2011.
+ */
+template<typename Operator, typename Matrix>
+static auto
+randomized_svd(Operator const& a, Matrix const& omega, El::Int power_iterations) {
+	auto q = (*multiply)(a, omega);
+	El::qr::ExplicitUnitary(q.data());
+	
+	for (El::Int i = 0; i < power_iterations; ++i) {
+		auto z = (*multiply)(transpose(a), q);
+		El::qr::ExplicitUnitary(z.data());
+		q = (*multiply)(a, z);
+		El::qr::ExplicitUnitary(q.data());
+	}
+	
+	auto usv = (*svd)((*multiply)(transpose(a), q), decompose_mode::economy);
+	auto && U_b = (*at)(usv, svd_u{});
+	auto && S   = (*at)(usv, svd_s{});
+	auto && V_b = (*at)(usv, svd_v{});
+	
+	return make_svd_result((*multiply)(q, V_b), S, U_b);
+}
+
+/* Higher-order DMD [2] equals DMD on block-Hankel matrices H1 and H2 of time-delayed snapshots. Only products with H1,
+ * H2 and their transposes are required (randomized SVD, projection of A~, DMD modes), which are computed on the
+ * snapshots directly. Modes are truncated to the first block row, i.e. to the non-delayed state, and amplitudes are
+ * projected amplitudes (see projected_amplitudes()) of the first column of H1.
+ *
+ * References:
+ * [2] Soledad Le Clainche and José M. Vega, "Higher Order Dynamic Mode Decomposition", SIAM J. Appl. Dyn. Syst., 16(2),
+ *     2017.
+ */
+template <typename H1, typename H2, typename Control>
+static auto
+hodmd(
+	H1 const& h1,
+	H2 const& h2,
+	Control const& ctrl
+) {
+	HBRS_MPL_LOG_TRIVIAL(debug) << "hodmd:elemental:begin";
+	
+	auto const& snapshots = h1.snapshots();
+	auto const x_m = snapshots.data().Height();
+	
+	auto const h1_sz = (*size)(h1);
+	auto const h1_m = (*m)(h1_sz);
+	auto const h1_n = (*n)(h1_sz);
+	
+	BOOST_ASSERT((*equal)(h1_sz, (*size)(h2)));
+	
+	auto r = (*minimum)(ctrl.target_rank(), minimum(h1_m, h1_n));
+	auto l = (*minimum)(r + hodmd_oversampling, minimum(h1_m, h1_n));
+	
+	auto usv = randomized_svd(h1, gaussian_like(snapshots, h1_n, l), hodmd_power_iterations);
+	auto && U = (*at)(usv, svd_u{});
+	auto && S = (*at)(usv, svd_s{});
+	auto && V = (*at)(usv, svd_v{});
+	
+	auto U_r = (*select)(
+		std::move(U),
+		std::make_pair(El::ALL, El::IR(0, r))
+	);
+	
+	auto S_r = (*select)(
+		std::move(S),
+		std::make_pair(El::IR(0, r), El::IR(0, r))
+	);
+	
+	auto V_r = (*select)(
+		std::move(V),
+		std::make_pair(El::ALL, El::IR(0, r))
+	);
+	
+	auto S_r_inv = reduced_inverse(diagonal_matrix_without_zeros_on_main_diagonal<decltype(S_r)>{S_r}, ctrl);
+	
+	/* A~ = U_r'*H2*V_r*inv(S_r) = (H2'*U_r)'*V_r*inv(S_r) */
+	auto Atilde =
+		(*multiply)(
+			multiply(
+				transpose(multiply(transpose(h2), U_r)),
+				V_r
+			),
+			S_r_inv
+		);
+	
+	HBRS_MPL_LOG_TRIVIAL(trace) << "A~:" << loggable{Atilde};
+	
+	auto VD = reduced_eig(Atilde, ctrl);
+	auto && D   = (*at)(VD, eig_eigenvalues{});
+	auto && W_r = (*at)(VD, eig_eigenvectors{});
+	
+	auto modes_h =
+		(*multiply)(
+			multiply(
+				multiply(h2, V_r),
+				S_r_inv
+			),
+			W_r
+		);
+	
+	auto modes = first_rows(modes_h, x_m);
+	
+	auto col1 = to_column_vector(first_hankel_column(snapshots, h1.delays()));
+	auto coefficients = projected_amplitudes(U_r, col1, W_r, D, ctrl);
+	
+	auto eigenvalues = D;
+	
+	HBRS_MPL_LOG_TRIVIAL(trace) << "eigenvalues:" << loggable{eigenvalues};
+	HBRS_MPL_LOG_TRIVIAL(trace) << "modes:" << loggable{modes};
+	HBRS_MPL_LOG_TRIVIAL(trace) << "coefficients:" << loggable{coefficients};
+	HBRS_MPL_LOG_TRIVIAL(debug) << "hodmd:elemental:end";
+	return make_dmd_result(eigenvalues, modes, coefficients);
+}
+
 /* namespace dmd_impl_el */ }
 
 template <
@@ -188,6 +529,38 @@ dmd_impl_el_dist_matrix::operator()(
 	return dmd_impl_el::dmd(x1, x2, ctrl);
 }
 
+template <
+	typename Ring,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		std::is_arithmetic_v<std::remove_const_t<Ring>>
+	>*
+>
+decltype(auto)
+dmd_impl_el_hankel_matrix::operator()(
+	hankel_matrix<el_matrix<Ring>, El::Int> const& x1,
+	hankel_matrix<el_matrix<Ring>, El::Int> const& x2,
+	dmd_control<El::Int> const& ctrl
+) const {
+	return dmd_impl_el::hodmd(x1, x2, ctrl);
+}
+
+template<
+	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		std::is_arithmetic_v<std::remove_const_t<Ring>>
+	>*
+>
+decltype(auto)
+dmd_impl_el_hankel_matrix::operator()(
+	hankel_matrix<el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>, El::Int> const& x1,
+	hankel_matrix<el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>, El::Int> const& x2,
+	dmd_control<El::Int> const& ctrl
+) const {
+	return dmd_impl_el::hodmd(x1, x2, ctrl);
+}
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
@@ -37,12 +37,17 @@
 #include <hbrs/mpl/dt/sm.hpp>
 #include <hbrs/mpl/dt/matrix_size.hpp>
 #include <hbrs/mpl/dt/dmd_control.hpp>
+#include <hbrs/mpl/dt/dmd_amplitudes.hpp>
+#include <hbrs/mpl/dt/dmd_result.hpp>
+#include <hbrs/mpl/dt/hankel_matrix.hpp>
 
 #include <hbrs/mpl/fn/dmd.hpp>
 #include <hbrs/mpl/fn/size.hpp>
 #include <hbrs/mpl/fn/m.hpp>
 #include <hbrs/mpl/fn/n.hpp>
 #include <hbrs/mpl/fn/minimum.hpp>
+#include <hbrs/mpl/fn/multiply.hpp>
+#include <hbrs/mpl/fn/transpose.hpp>
 #include <hbrs/mpl/fn/select.hpp>
 
 #include <boost/hana/filter.hpp>
@@ -65,6 +70,10 @@
 #include <boost/hana/range.hpp>
 #include <boost/hana/length.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace utf = boost::unit_test;
 namespace tt = boost::test_tools;
 
@@ -147,6 +156,24 @@ BOOST_AUTO_TEST_CASE(dmd_comparison,  * utf::tolerance(_TOL)) {
 				dmd_control<El::Int>{(El::Int)target_rank}
 			);
 		},
+		[](auto && dataset, auto && target_rank) {
+			static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+			auto x_ = make_el_dist_matrix(grid, make_el_matrix(HBRS_MPL_FWD(dataset)));
+			auto sz_ = (*size)(x_);
+			auto m_ = (*m)(sz_);
+			auto n_ = (*n)(sz_);
+		
+			auto x1_ = (*select)(x_, std::make_pair(matrix_index<El::Int,El::Int>{0,0}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+			auto x2_ = (*select)(x_, std::make_pair(matrix_index<El::Int,El::Int>{0,1}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+
+			// redundant threshold of zero enforces distributed computations of the reduced-order operands
+			return hana::make_tuple(
+				detail::dmd_impl_el_dist_matrix{},
+				std::move(x1_),
+				std::move(x2_),
+				dmd_control<El::Int>{(El::Int)target_rank, (El::Int)0}
+			);
+		},
 		#endif
 		"SEQUENCE_TERMINATOR___REMOVED_BY_DROP_BACK"
 	));
@@ -251,4 +278,176 @@ BOOST_AUTO_TEST_CASE(dmd_comparison,  * utf::tolerance(_TOL)) {
 	
 }
 
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+BOOST_AUTO_TEST_CASE(dmd_amplitudes_comparison, * utf::tolerance(0.000001)) {
+	using namespace hbrs::mpl;
+	using hbrs::mpl::select;
+	
+	/* Snapshots of a linear system with four real, distinct eigenvalues, i.e. the first snapshot lies in the span of
+	 * the DMD modes and projected amplitudes must be equal to least-squares amplitudes. */
+	static constexpr El::Int m_ = 32;
+	static constexpr El::Int n_ = 12;
+	static constexpr El::Int rank = 4;
+	double const lambdas[rank] = { 0.95, 0.8, 0.6, 0.3 };
+	
+	el_matrix<double> x_{m_, n_};
+	for (El::Int i = 0; i < m_; ++i) {
+		for (El::Int k = 0; k < n_; ++k) {
+			double x_ik = 0;
+			for (El::Int j = 0; j < rank; ++j) {
+				x_ik += (j+1) * std::pow(lambdas[j], k) * std::sin((i+1) * (j+1) * 0.1);
+			}
+			x_.data().Set(i, k, x_ik);
+		}
+	}
+	
+	auto x1_ = (*select)(x_, std::make_pair(matrix_index<El::Int,El::Int>{0,0}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+	auto x2_ = (*select)(x_, std::make_pair(matrix_index<El::Int,El::Int>{0,1}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+	
+	{
+		auto exact = detail::dmd_impl_el_matrix{}(x1_, x2_,
+			dmd_control<El::Int>{rank, dmd_default_redundant_threshold, dmd_amplitudes::least_squares});
+		auto projected = detail::dmd_impl_el_matrix{}(x1_, x2_,
+			dmd_control<El::Int>{rank, dmd_default_redundant_threshold, dmd_amplitudes::projected});
+		
+		HBRS_MPL_TEST_VVEQ((*at)(exact, dmd_eigenvalues{}), (*at)(projected, dmd_eigenvalues{}), false);
+		HBRS_MPL_TEST_VVEQ((*at)(exact, dmd_coefficients{}), (*at)(projected, dmd_coefficients{}), false);
+	}
+	
+	{
+		static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+		auto x_d = make_el_dist_matrix(grid, x_);
+		auto x1_d = (*select)(x_d, std::make_pair(matrix_index<El::Int,El::Int>{0,0}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+		auto x2_d = (*select)(x_d, std::make_pair(matrix_index<El::Int,El::Int>{0,1}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+		
+		for (El::Int threshold : { (El::Int)0, (El::Int)dmd_default_redundant_threshold }) {
+			BOOST_TEST_MESSAGE("redundant_threshold=" << threshold);
+			auto exact = detail::dmd_impl_el_dist_matrix{}(x1_d, x2_d,
+				dmd_control<El::Int>{rank, threshold, dmd_amplitudes::least_squares});
+			auto projected = detail::dmd_impl_el_dist_matrix{}(x1_d, x2_d,
+				dmd_control<El::Int>{rank, threshold, dmd_amplitudes::projected});
+			
+			HBRS_MPL_TEST_VVEQ((*at)(exact, dmd_coefficients{}), (*at)(projected, dmd_coefficients{}), false);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(hankel_matrix_multiply, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static constexpr El::Int m_ = 3;
+	static constexpr El::Int n_ = 9;
+	static constexpr El::Int delays = 4;
+	static constexpr El::Int h_m = m_ * delays;
+	static constexpr El::Int h_n = n_ - delays + 1;
+	static constexpr El::Int k_ = 2;
+	
+	el_matrix<double> x_{m_, n_};
+	for (El::Int i = 0; i < m_; ++i) {
+		for (El::Int j = 0; j < n_; ++j) {
+			x_.data().Set(i, j, std::sin(i + 0.3 * j) + 0.1 * j);
+		}
+	}
+	
+	/* block row i of H is X(:, i:i+n-d), see dt/hankel_matrix */
+	el_matrix<double> h_{h_m, h_n};
+	for (El::Int i = 0; i < delays; ++i) {
+		for (El::Int r = 0; r < m_; ++r) {
+			for (El::Int j = 0; j < h_n; ++j) {
+				h_.data().Set(i*m_ + r, j, x_.data().Get(r, i+j));
+			}
+		}
+	}
+	
+	el_matrix<double> b_{h_n, k_};
+	el_matrix<double> bt_{h_m, k_};
+	for (El::Int j = 0; j < k_; ++j) {
+		for (El::Int i = 0; i < h_n; ++i) {
+			b_.data().Set(i, j, std::cos(i - 0.5 * j));
+		}
+		for (El::Int i = 0; i < h_m; ++i) {
+			bt_.data().Set(i, j, std::cos(0.2 * i + j));
+		}
+	}
+	
+	el_matrix<double> hb_{0, 0};
+	El::Gemm(El::NORMAL, El::NORMAL, 1., h_.data(), b_.data(), hb_.data());
+	el_matrix<double> htb_{0, 0};
+	El::Gemm(El::TRANSPOSE, El::NORMAL, 1., h_.data(), bt_.data(), htb_.data());
+	
+	auto h = make_hankel_matrix(x_, delays);
+	HBRS_MPL_TEST_MMEQ((*multiply)(h, b_), hb_, false);
+	HBRS_MPL_TEST_MMEQ((*multiply)(transpose(h), bt_), htb_, false);
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	auto h_d = make_hankel_matrix(make_el_dist_matrix(grid, x_), delays);
+	HBRS_MPL_TEST_MMEQ((*multiply)(h_d, make_el_dist_matrix(grid, b_)), hb_, false);
+	HBRS_MPL_TEST_MMEQ((*multiply)(transpose(h_d), make_el_dist_matrix(grid, bt_)), htb_, false);
+}
+
+BOOST_AUTO_TEST_CASE(dmd_hankel_matrix) {
+	using namespace hbrs::mpl;
+	using hbrs::mpl::select;
+	using hbrs::mpl::detail::gather;
+	namespace mpi = hbrs::mpl::detail::mpi;
+	
+	/* Snapshots of a linear system with four real, distinct eigenvalues but only two spatial dimensions. Plain DMD can
+	 * recover at most two eigenvalues, while DMD on time-delayed snapshots recovers all of them. */
+	static constexpr El::Int m_ = 2;
+	static constexpr El::Int n_ = 40;
+	static constexpr El::Int rank = 4;
+	static constexpr El::Int delays = 4;
+	double const lambdas[rank] = { 0.95, 0.8, 0.6, 0.3 };
+	
+	el_matrix<double> x_{m_, n_};
+	for (El::Int i = 0; i < m_; ++i) {
+		for (El::Int k = 0; k < n_; ++k) {
+			double x_ik = 0;
+			for (El::Int j = 0; j < rank; ++j) {
+				x_ik += (j+1) * std::pow(lambdas[j], k) * std::cos((i+1) * (j+1) * 0.7);
+			}
+			x_.data().Set(i, k, x_ik);
+		}
+	}
+	
+	auto check_eigenvalues = [&](auto const& result) {
+		auto eigenvalues = gather((*at)(result, dmd_eigenvalues{}));
+		if (!mpi::initialized() || (mpi::comm_rank() == 0)) {
+			BOOST_TEST(eigenvalues.length() == rank);
+			for (El::Int j = 0; j < rank; ++j) {
+				double min_dist = std::numeric_limits<double>::max();
+				for (El::Int i = 0; i < eigenvalues.length(); ++i) {
+					min_dist = std::min(min_dist, (double)El::Abs(eigenvalues.at(i) - El::Complex<double>{lambdas[j]}));
+				}
+				BOOST_TEST(min_dist < 0.000001, "lambda=" << lambdas[j] << " min_dist=" << min_dist);
+			}
+		}
+	};
+	
+	auto x1_ = (*select)(x_, std::make_pair(matrix_index<El::Int,El::Int>{0,0}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+	auto x2_ = (*select)(x_, std::make_pair(matrix_index<El::Int,El::Int>{0,1}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+	
+	check_eigenvalues(
+		detail::dmd_impl_el_hankel_matrix{}(
+			make_hankel_matrix(x1_, delays),
+			make_hankel_matrix(x2_, delays),
+			dmd_control<El::Int>{rank}
+		)
+	);
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	auto x_d = make_el_dist_matrix(grid, x_);
+	auto x1_d = (*select)(x_d, std::make_pair(matrix_index<El::Int,El::Int>{0,0}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+	auto x2_d = (*select)(x_d, std::make_pair(matrix_index<El::Int,El::Int>{0,1}, matrix_size<El::Int,El::Int>{m_, n_-1}));
+	
+	check_eigenvalues(
+		detail::dmd_impl_el_hankel_matrix{}(
+			make_hankel_matrix(x1_d, delays),
+			make_hankel_matrix(x2_d, delays),
+			dmd_control<El::Int>{rank}
+		)
+	);
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
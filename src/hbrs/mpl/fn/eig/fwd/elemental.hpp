@@ -47,6 +47,48 @@ struct eig_impl_el_matrix {
 		el_matrix<Ring> const& a,
 		eig_control<> const& ctrl
 	) const;
+	
+	template <
+		typename Ring,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_matrix<Ring> && a,
+		eig_control<> const& ctrl
+	) const;
+	
+	template <
+		typename Ring,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_matrix<Ring> const& a,
+		eig_control<eig_symmetry::hermitian> const& ctrl
+	) const;
+	
+	template <
+		typename Ring,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_matrix<Ring> && a,
+		eig_control<eig_symmetry::hermitian> const& ctrl
+	) const;
 };
 
 struct eig_impl_el_dist_matrix {
@@ -63,6 +105,48 @@ struct eig_impl_el_dist_matrix {
 		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
 		eig_control<> const& ctrl
 	) const;
+	
+	template<
+		typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+		eig_control<> const& ctrl
+	) const;
+	
+	template<
+		typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+		eig_control<eig_symmetry::hermitian> const& ctrl
+	) const;
+	
+	template<
+		typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+		eig_control<eig_symmetry::hermitian> const& ctrl
+	) const;
 };
 
 #else
@@ -26,6 +26,10 @@ template decltype(auto) eig_impl_el_matrix::operator()(
 	el_matrix<float> const&,
 	eig_control<> const&) const;
 
+template decltype(auto) eig_impl_el_matrix::operator()(
+	el_matrix<float> &&,
+	eig_control<> const&) const;
+
 // template decltype(auto) eig_impl_el_matrix::operator()(
 // 	el_matrix<El::Complex<float>> const&,
 // 	eig_control<> const&) const;
@@ -34,6 +38,10 @@ template decltype(auto) eig_impl_el_matrix::operator()(
 	el_matrix<double> const&,
 	eig_control<> const&) const;
 
+template decltype(auto) eig_impl_el_matrix::operator()(
+	el_matrix<double> &&,
+	eig_control<> const&) const;
+
 // template decltype(auto) eig_impl_el_matrix::operator()(
 // 	el_matrix<El::Complex<double>> const&,
 // 	eig_control<> const&) const;
@@ -42,6 +50,10 @@ template decltype(auto) eig_impl_el_dist_matrix::operator()(
 	el_dist_matrix<float> const&,
 	eig_control<> const&) const;
 
+template decltype(auto) eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<float> &&,
+	eig_control<> const&) const;
+
 // template decltype(auto) eig_impl_el_dist_matrix::operator()(
 // 	el_dist_matrix<El::Complex<float>> const&,
 // 	eig_control<> const&) const;
@@ -50,10 +62,46 @@ template decltype(auto) eig_impl_el_dist_matrix::operator()(
 	el_dist_matrix<double> const&,
 	eig_control<> const&) const;
 
+template decltype(auto) eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<double> &&,
+	eig_control<> const&) const;
+
 // template decltype(auto) eig_impl_el_dist_matrix::operator()(
 // 	el_dist_matrix<El::Complex<double>> const&,
 // 	eig_control<> const&) const;
 
+template decltype(auto) eig_impl_el_matrix::operator()(
+	el_matrix<float> const&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
+template decltype(auto) eig_impl_el_matrix::operator()(
+	el_matrix<float> &&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
+template decltype(auto) eig_impl_el_matrix::operator()(
+	el_matrix<double> const&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
+template decltype(auto) eig_impl_el_matrix::operator()(
+	el_matrix<double> &&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
+template decltype(auto) eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<float> const&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
+template decltype(auto) eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<float> &&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
+template decltype(auto) eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<double> const&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
+template decltype(auto) eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<double> &&,
+	eig_control<eig_symmetry::hermitian> const&) const;
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
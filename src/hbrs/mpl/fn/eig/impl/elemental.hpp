@@ -34,10 +34,54 @@
 #include <hbrs/mpl/fn/n.hpp>
 #include <hbrs/mpl/fn/not_equal.hpp>
 
+#include <boost/numeric/conversion/cast.hpp>
+#include <El.hpp>
+#include <cstddef>
+
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
 namespace detail {
 
+namespace eig_el {
+
+/* Hermitian eigenproblems are solved by reduction to tridiagonal form and MRRR [1], which computes a subset of k
+ * eigenpairs in O(n*k) after the O(n^3) reduction, instead of Schur decomposition and complex eigenvectors as El::Eig()
+ * does. Elemental's subset indices refer to ascending eigenvalues, eig_control's to descending eigenvalues.
+ *
+ * Ref.:
+ * [1] Elemental/src/lapack_like/spectral/HermitianEig.cpp
+ */
+template<typename Ring>
+static El::HermitianEigCtrl<Ring>
+hermitian_eig_ctrl(eig_control<eig_symmetry::hermitian> const& ctrl, El::Int n) {
+	El::HermitianEigCtrl<Ring> el_ctrl;
+	el_ctrl.tridiagEigCtrl.alg = El::HERMITIAN_TRIDIAG_EIG_MRRR;
+	el_ctrl.tridiagEigCtrl.sort = El::DESCENDING;
+	
+	auto & subset = el_ctrl.tridiagEigCtrl.subset;
+	if (ctrl.subset() == eig_subset::index_range) {
+		if (ctrl.first_index() > ctrl.last_index() || ctrl.last_index() >= boost::numeric_cast<std::size_t>(n)) {
+			BOOST_THROW_EXCEPTION(
+				incompatible_matrix_exception{}
+				<< errinfo_el_matrix_size{{n, n}}
+				<< errinfo_sequences_sizes{{ctrl.first_index(), ctrl.last_index()}}
+			);
+		}
+		
+		subset.indexSubset = true;
+		subset.lowerIndex = n - 1 - boost::numeric_cast<El::Int>(ctrl.last_index());
+		subset.upperIndex = n - 1 - boost::numeric_cast<El::Int>(ctrl.first_index());
+	} else if (ctrl.subset() == eig_subset::value_range) {
+		subset.rangeSubset = true;
+		subset.lowerBound = static_cast<El::Base<Ring>>(ctrl.lower_bound());
+		subset.upperBound = static_cast<El::Base<Ring>>(ctrl.upper_bound());
+	}
+	
+	return el_ctrl;
+}
+
+/* namespace eig_el */ }
+
 /* Code of El::Eig() [1] is similar to:
  * ( Matrix<Complex<Real>>& A,
  *   Matrix<Complex<Real>>& w,
@@ -98,6 +142,23 @@ decltype(auto)
 eig_impl_el_matrix::operator()(
 	el_matrix<Ring> const& a,
 	eig_control<> const& ctrl
+) const {
+	auto x = a;
+	return (*this)(std::move(x), ctrl);
+}
+
+template <
+	typename Ring,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+eig_impl_el_matrix::operator()(
+	el_matrix<Ring> && a,
+	eig_control<> const& ctrl
 ) const {
 	auto a_sz = (*size)(a);
 	auto a_m = (*m)(a_sz);
@@ -107,11 +168,10 @@ eig_impl_el_matrix::operator()(
 		BOOST_THROW_EXCEPTION(incompatible_matrix_exception{} << errinfo_el_matrix_size{a_sz});
 	}
 	
-	auto x = a;
 	el_column_vector<El::Complex<El::Base<Ring>>> w{0};
 	el_matrix<El::Complex<El::Base<Ring>>> X{0, 0};
-	El::Eig(x.data(), w.data(), X.data());
-	return make_eig_result(w, X);
+	El::Eig(a.data(), w.data(), X.data());
+	return make_eig_result(std::move(w), std::move(X));
 }
 
 template<
@@ -126,6 +186,23 @@ decltype(auto)
 eig_impl_el_dist_matrix::operator()(
 	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
 	eig_control<> const& ctrl
+) const {
+	auto x = a;
+	return (*this)(std::move(x), ctrl);
+}
+
+template<
+	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+	eig_control<> const& ctrl
 ) const {
 	auto a_sz = (*size)(a);
 	auto a_m = (*m)(a_sz);
@@ -135,12 +212,100 @@ eig_impl_el_dist_matrix::operator()(
 		BOOST_THROW_EXCEPTION(incompatible_matrix_exception{} << errinfo_el_matrix_size{a_sz});
 	}
 	
-	auto x = a;
 	el_dist_column_vector<El::Complex<El::Base<Ring>>> w{a.data().Grid(), 1};
 	el_dist_matrix<El::Complex<El::Base<Ring>>> X{a.data().Grid(), 1, 1};
 	
-	El::Eig(x.data(), w.data(), X.data());
-	return make_eig_result(w, X);
+	El::Eig(a.data(), w.data(), X.data());
+	return make_eig_result(std::move(w), std::move(X));
+}
+
+template <
+	typename Ring,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+eig_impl_el_matrix::operator()(
+	el_matrix<Ring> const& a,
+	eig_control<eig_symmetry::hermitian> const& ctrl
+) const {
+	auto x = a;
+	return (*this)(std::move(x), ctrl);
+}
+
+template <
+	typename Ring,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+eig_impl_el_matrix::operator()(
+	el_matrix<Ring> && a,
+	eig_control<eig_symmetry::hermitian> const& ctrl
+) const {
+	auto a_sz = (*size)(a);
+	auto a_m = (*m)(a_sz);
+	auto a_n = (*n)(a_sz);
+	
+	if ((*not_equal)(a_m, a_n)) {
+		BOOST_THROW_EXCEPTION(incompatible_matrix_exception{} << errinfo_el_matrix_size{a_sz});
+	}
+	
+	el_column_vector<El::Base<Ring>> w{0};
+	el_matrix<Ring> X{0, 0};
+	El::HermitianEig(El::LOWER, a.data(), w.data(), X.data(), eig_el::hermitian_eig_ctrl<Ring>(ctrl, a_n));
+	return make_eig_result(std::move(w), std::move(X));
+}
+
+template<
+	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+	eig_control<eig_symmetry::hermitian> const& ctrl
+) const {
+	auto x = a;
+	return (*this)(std::move(x), ctrl);
+}
+
+template<
+	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+eig_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+	eig_control<eig_symmetry::hermitian> const& ctrl
+) const {
+	auto a_sz = (*size)(a);
+	auto a_m = (*m)(a_sz);
+	auto a_n = (*n)(a_sz);
+	
+	if ((*not_equal)(a_m, a_n)) {
+		BOOST_THROW_EXCEPTION(incompatible_matrix_exception{} << errinfo_el_matrix_size{a_sz});
+	}
+	
+	el_dist_column_vector<El::Base<Ring>> w{a.data().Grid(), 1};
+	el_dist_matrix<Ring> X{a.data().Grid(), 1, 1};
+	
+	El::HermitianEig(El::LOWER, a.data(), w.data(), X.data(), eig_el::hermitian_eig_ctrl<Ring>(ctrl, a_n));
+	return make_eig_result(std::move(w), std::move(X));
 }
 
 /* namespace detail */ }
@@ -71,6 +71,9 @@
 #include <boost/hana/range.hpp>
 #include <boost/hana/length.hpp>
 
+#include <cmath>
+#include <vector>
+
 namespace utf = boost::unit_test;
 namespace tt = boost::test_tools;
 
@@ -274,4 +277,62 @@ BOOST_AUTO_TEST_CASE(eig_comparison,  * utf::tolerance(_TOL)) {
 	
 }
 
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+BOOST_AUTO_TEST_CASE(eig_hermitian_subset, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	/* tridiag(-1, 2, -1) has eigenvalues 2-2*cos(j*pi/(n+1)) for j=1,...,n */
+	static constexpr El::Int n_ = 8;
+	static constexpr El::Int k_ = 3;
+	
+	el_matrix<double> a{n_, n_};
+	std::vector<double> lambdas;
+	for (El::Int i = 0; i < n_; ++i) {
+		a.data().Set(i, i, 2.);
+		if (i > 0) {
+			a.data().Set(i, i-1, -1.);
+			a.data().Set(i-1, i, -1.);
+		}
+		lambdas.push_back(2. - 2. * std::cos((n_-i) * El::Pi<double>() / (n_+1)));
+	}
+	
+	auto check = [&](auto const& a_, auto const& result, El::Int first, El::Int count) {
+		auto const& w = (*at)(result, eig_eigenvalues{}).data();
+		auto const& v = (*at)(result, eig_eigenvectors{}).data();
+		BOOST_TEST(w.Height() == count);
+		BOOST_TEST(v.Width() == count);
+		if (w.Height() != count || v.Width() != count) {
+			return;
+		}
+		
+		for (El::Int i = 0; i < count; ++i) {
+			BOOST_TEST(w.Get(i, 0) == lambdas[first+i]);
+		}
+		
+		// A*V == V*diag(w)
+		auto av = v;
+		auto vd = v;
+		El::Gemm(El::NORMAL, El::NORMAL, 1., a_.data(), v, 0., av);
+		El::DiagonalScale(El::RIGHT, El::NORMAL, w, vd);
+		El::Axpy(-1., vd, av);
+		BOOST_TEST(El::FrobeniusNorm(av) < _TOL * n_);
+	};
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	auto a_d = make_el_dist_matrix(grid, a);
+	
+	double const lower_bound = (lambdas[k_] + lambdas[k_-1]) / 2;
+	double const upper_bound = lambdas[0] + 1.;
+	
+	check(a, detail::eig_impl_el_matrix{}(a, eig_control<eig_symmetry::hermitian>{}), 0, n_);
+	check(a, detail::eig_impl_el_matrix{}(a, eig_control<eig_symmetry::hermitian>{0, k_-1}), 0, k_);
+	check(a, detail::eig_impl_el_matrix{}(a, eig_control<eig_symmetry::hermitian>{1, k_}), 1, k_);
+	check(a, detail::eig_impl_el_matrix{}(a, eig_control<eig_symmetry::hermitian>{lower_bound, upper_bound}), 0, k_);
+	
+	check(a_d, detail::eig_impl_el_dist_matrix{}(a_d, eig_control<eig_symmetry::hermitian>{}), 0, n_);
+	check(a_d, detail::eig_impl_el_dist_matrix{}(a_d, eig_control<eig_symmetry::hermitian>{0, k_-1}), 0, k_);
+	check(a_d, detail::eig_impl_el_dist_matrix{}(a_d, eig_control<eig_symmetry::hermitian>{lower_bound, upper_bound}), 0, k_);
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
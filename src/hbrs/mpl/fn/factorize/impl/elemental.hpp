@@ -0,0 +1,339 @@
+/* Copyright (c) 2019 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HBRS_MPL_FN_FACTORIZE_IMPL_ELEMENTAL_HPP
+#define HBRS_MPL_FN_FACTORIZE_IMPL_ELEMENTAL_HPP
+
+#include "../fwd/elemental.hpp"
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+#include <hbrs/mpl/dt/el_factorization.hpp>
+#include <hbrs/mpl/detail/hierarchical.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <El.hpp>
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+namespace detail {
+namespace factorize_el {
+
+/* Structure of a square matrix A which decides how A is factorized, similar to the decision tree of MATLAB's mldivide
+ * for full matrices [1]. lower_bandwidth and upper_bandwidth are the largest distances of a nonzero to the main diagonal
+ * below and above it. positive_diagonal is true iff all diagonal entries are real and positive.
+ *
+ * References:
+ * [1] https://de.mathworks.com/help/matlab/ref/mldivide.html
+ */
+struct structure {
+	El::Int lower_bandwidth;
+	El::Int upper_bandwidth;
+	bool hermitian;
+	bool positive_diagonal;
+};
+
+template<typename Ring>
+static void
+analyze_entry(Ring const& a_ij, El::Int i, El::Int j, structure & s) {
+	if (i == j) {
+		if (El::ImagPart(a_ij) != 0) {
+			s.hermitian = false;
+			s.positive_diagonal = false;
+		} else if (El::RealPart(a_ij) <= 0) {
+			s.positive_diagonal = false;
+		}
+	} else if (a_ij != Ring(0)) {
+		if (i > j) {
+			s.lower_bandwidth = std::max(s.lower_bandwidth, i-j);
+		} else {
+			s.upper_bandwidth = std::max(s.upper_bandwidth, j-i);
+		}
+	}
+}
+
+template<typename Ring>
+static structure
+analyze(El::Matrix<Ring> const& a) {
+	BOOST_ASSERT(a.Height() == a.Width());
+	El::Int const n = a.Height();
+	El::Int const ldim = a.LDim();
+	Ring const* buf = a.LockedBuffer();
+	
+	structure s{0, 0, true, true};
+	for(El::Int j = 0; j < n; ++j) {
+		for(El::Int i = 0; i < n; ++i) {
+			Ring const& a_ij = buf[i+j*ldim];
+			analyze_entry(a_ij, i, j, s);
+			
+			if (s.hermitian && i > j && a_ij != El::Conj(buf[j+i*ldim])) {
+				s.hermitian = false;
+			}
+		}
+	}
+	return s;
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static structure
+analyze(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a) {
+	BOOST_ASSERT(a.Height() == a.Width());
+	MPI_Comm comm = a.Grid().Comm().comm;
+	El::Matrix<Ring> const& a_lcl = a.LockedMatrix();
+	El::Int const a_lcl_ldim = a_lcl.LDim();
+	Ring const* a_lcl_buf = a_lcl.LockedBuffer();
+	
+	structure s{0, 0, true, true};
+	for(El::Int j = 0; j < a_lcl.Width(); ++j) {
+		for(El::Int i = 0; i < a_lcl.Height(); ++i) {
+			analyze_entry(a_lcl_buf[i+j*a_lcl_ldim], a.GlobalRow(i), a.GlobalCol(j), s);
+		}
+	}
+	
+	// one reduction for all flags, the bandwidths are bounded by the matrix size which is an int in MPI anyway
+	std::array<int, 4> flags{
+		boost::numeric_cast<int>(s.lower_bandwidth),
+		boost::numeric_cast<int>(s.upper_bandwidth),
+		s.hermitian ? 0 : 1,
+		s.positive_diagonal ? 0 : 1
+	};
+	mpi::hierarchical_allreduce(
+		MPI_IN_PLACE, flags.data(), flags.size(), mpi::datatype(hana::type_c<int>), MPI_MAX, comm);
+	
+	s.lower_bandwidth = flags[0];
+	s.upper_bandwidth = flags[1];
+	s.hermitian = flags[2] == 0;
+	s.positive_diagonal = flags[3] == 0;
+	
+	if (!s.hermitian || s.lower_bandwidth == 0 || s.upper_bandwidth == 0) {
+		// triangular matrices are never tested for symmetry
+		return s;
+	}
+	
+	if (s.lower_bandwidth != s.upper_bandwidth) {
+		// the adjoint of a Hermitian matrix has the same band, so equal bandwidths are necessary
+		s.hermitian = false;
+		return s;
+	}
+	
+	// Fetch the adjoint counterparts of local entries below the diagonal from their owners instead of redistributing
+	// the whole matrix. Entries outside of the band are zero and so are their counterparts.
+	El::Int const bw = s.lower_bandwidth;
+	std::vector<std::pair<El::Int, El::Int>> lower;
+	for(El::Int j = 0; j < a_lcl.Width(); ++j) {
+		for(El::Int i = 0; i < a_lcl.Height(); ++i) {
+			El::Int const diff = a.GlobalRow(i) - a.GlobalCol(j);
+			if (diff > 0 && diff <= bw) {
+				lower.emplace_back(i, j);
+			}
+		}
+	}
+	
+	a.ReservePulls(boost::numeric_cast<El::Int>(lower.size()));
+	for(auto const& [i, j] : lower) {
+		a.QueuePull(a.GlobalCol(j), a.GlobalRow(i));
+	}
+	std::vector<Ring> upper;
+	a.ProcessPullQueue(upper);
+	BOOST_ASSERT(upper.size() == lower.size());
+	
+	int not_hermitian = 0;
+	for(std::size_t k = 0; k < lower.size(); ++k) {
+		auto const& [i, j] = lower[k];
+		if (a_lcl_buf[i+j*a_lcl_ldim] != El::Conj(upper[k])) {
+			not_hermitian = 1;
+			break;
+		}
+	}
+	mpi::hierarchical_allreduce(MPI_IN_PLACE, &not_hermitian, 1, mpi::datatype(hana::type_c<int>), MPI_MAX, comm);
+	s.hermitian = not_hermitian == 0;
+	return s;
+}
+
+/* LU decomposition with partial pivoting of a matrix with lower bandwidth kl and upper bandwidth ku, similar to
+ * LAPACK's xGBTRF but on full storage. Row interchanges are restricted to the kl rows below the diagonal, hence U has
+ * upper bandwidth kl+ku and the work is O(n*kl*(kl+ku)) instead of O(n^3).
+ */
+template<typename Ring>
+static void
+banded_lu(El::Matrix<Ring> & a, El::Int kl, El::Int ku, std::vector<El::Int> & pivots) {
+	El::Int const n = a.Height();
+	El::Int const ldim = a.LDim();
+	Ring * buf = a.Buffer();
+	
+	pivots.resize(boost::numeric_cast<std::size_t>(n));
+	for(El::Int k = 0; k < n; ++k) {
+		El::Int const i_end = std::min(n, k+kl+1);
+		El::Int const j_end = std::min(n, k+kl+ku+1);
+		
+		El::Int p = k;
+		for(El::Int i = k+1; i < i_end; ++i) {
+			if (El::Abs(buf[i+k*ldim]) > El::Abs(buf[p+k*ldim])) {
+				p = i;
+			}
+		}
+		pivots[k] = p;
+		
+		if (buf[p+k*ldim] == Ring(0)) {
+			throw El::SingularMatrixException{};
+		}
+		
+		if (p != k) {
+			for(El::Int j = k; j < j_end; ++j) {
+				std::swap(buf[k+j*ldim], buf[p+j*ldim]);
+			}
+		}
+		
+		Ring const pivot = buf[k+k*ldim];
+		for(El::Int i = k+1; i < i_end; ++i) {
+			Ring const l_ik = buf[i+k*ldim] / pivot;
+			buf[i+k*ldim] = l_ik;
+			for(El::Int j = k+1; j < j_end; ++j) {
+				buf[i+j*ldim] -= l_ik * buf[k+j*ldim];
+			}
+		}
+	}
+}
+
+/* Banded LU pays off only if the band is narrow compared to the matrix */
+static constexpr bool
+is_narrow_band(structure const& s, El::Int n) {
+	return (s.lower_bandwidth + s.upper_bandwidth) * 4 <= n;
+}
+
+template<typename Matrix>
+struct is_el_matrix : std::false_type {};
+
+template<typename Ring>
+struct is_el_matrix<el_matrix<Ring>> : std::true_type {};
+
+template<typename Matrix>
+static el_factorization<Matrix>
+factorize(Matrix a) {
+	El::Int const a_m = a.data().Height();
+	El::Int const a_n = a.data().Width();
+	
+	if (a_m != a_n) {
+		// if a_m < a_n then a is underdetermined and LQ() yields the minimum norm solution
+		// if a_m > a_n then a is overdetermined and QR() yields the least squares solution
+		// this is what El::LeastSquares() does, too
+		if (a_m > a_n) {
+			el_factorization<Matrix> f{el_factorization_type::qr, std::move(a)};
+			El::QR(f.factors().data(), f.scalars(), f.signature());
+			return f;
+		} else {
+			el_factorization<Matrix> f{el_factorization_type::lq, std::move(a)};
+			El::LQ(f.factors().data(), f.scalars(), f.signature());
+			return f;
+		}
+	}
+	
+	structure const s = analyze(a.data());
+	
+	if (s.lower_bandwidth == 0 && s.upper_bandwidth == 0) {
+		el_factorization<Matrix> f{el_factorization_type::diagonal, std::move(a)};
+		El::GetDiagonal(f.factors().data(), f.scalars());
+		return f;
+	}
+	
+	if (s.lower_bandwidth == 0) {
+		return {el_factorization_type::upper_triangular, std::move(a)};
+	}
+	
+	if (s.upper_bandwidth == 0) {
+		return {el_factorization_type::lower_triangular, std::move(a)};
+	}
+	
+	// TODO: Implement a distributed banded solver, until then banded distributed matrices are factorized with El::LU()
+	if constexpr (is_el_matrix<Matrix>::value) {
+		if (is_narrow_band(s, a_n)) {
+			el_factorization<Matrix> f{el_factorization_type::banded, std::move(a)};
+			banded_lu(f.factors().data(), s.lower_bandwidth, s.upper_bandwidth, f.pivots());
+			f.lower_bandwidth() = s.lower_bandwidth;
+			f.upper_bandwidth() = s.upper_bandwidth;
+			return f;
+		}
+	}
+	
+	if (s.hermitian && s.positive_diagonal) {
+		// a Hermitian matrix with positive diagonal is likely but not necessarily positive definite
+		// El::Cholesky() overwrites the lower triangle only, so a is restored from its diagonal and upper triangle if
+		// it fails instead of factorizing a copy of a
+		auto d = el_factorization<Matrix>::storage::make_scalars(a);
+		El::GetDiagonal(a.data(), d);
+		try {
+			El::Cholesky(El::LOWER, a.data());
+			return {el_factorization_type::cholesky, std::move(a)};
+		} catch (El::NonHPDMatrixException const&) {
+			// fall through to LDL
+			El::MakeHermitian(El::UPPER, a.data());
+			El::SetDiagonal(a.data(), d);
+		}
+	}
+	
+	if (s.hermitian) {
+		el_factorization<Matrix> f{el_factorization_type::ldl, std::move(a)};
+		El::LDL(f.factors().data(), f.scalars(), f.permutation(), true);
+		return f;
+	}
+	
+	el_factorization<Matrix> f{el_factorization_type::lu, std::move(a)};
+	El::LU(f.factors().data(), f.permutation());
+	return f;
+}
+
+/* namespace factorize_el */ }
+
+template <typename Ring>
+auto
+factorize_impl_el_matrix::operator()(el_matrix<Ring> const& a) const {
+	return factorize_el::factorize(a);
+}
+
+template <typename Ring>
+auto
+factorize_impl_el_matrix::operator()(el_matrix<Ring> && a) const {
+	return factorize_el::factorize(std::move(a));
+}
+
+template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+auto
+factorize_impl_el_dist_matrix::operator()(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a) const {
+	return factorize_el::factorize(a);
+}
+
+template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+auto
+factorize_impl_el_dist_matrix::operator()(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a) const {
+	return factorize_el::factorize(std::move(a));
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+#endif // !HBRS_MPL_FN_FACTORIZE_IMPL_ELEMENTAL_HPP
@@ -0,0 +1,162 @@
+/* Copyright (c) 2019 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE fn_factorize_elemental_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <hbrs/mpl/config.hpp>
+
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+#include <hbrs/mpl/dt/el_factorization.hpp>
+
+#include <hbrs/mpl/detail/test.hpp>
+
+#include <hbrs/mpl/dt/ctsam.hpp>
+#include <hbrs/mpl/dt/storage_order.hpp>
+#include <hbrs/mpl/dt/matrix_size.hpp>
+
+#include <hbrs/mpl/fn/factorize.hpp>
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/at.hpp>
+
+#include <array>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_SUITE(fn_factorize_elemental_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+BOOST_AUTO_TEST_CASE(factorize_structure_detection) {
+	using namespace hbrs::mpl;
+	
+	// tuple of pairs of a matrix and the factorization expected for it
+	static constexpr auto datasets = hana::make_tuple(
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 3*3>{
+					2., 0., 0.,
+					0., 3., 0.,
+					0., 0., 4.
+				},
+				make_matrix_size(hana::size_c<3>, hana::size_c<3>),
+				row_major_c
+			),
+			el_factorization_type::diagonal
+		),
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 3*3>{
+					2., 0., 0.,
+					1., 3., 0.,
+					5., 6., 4.
+				},
+				make_matrix_size(hana::size_c<3>, hana::size_c<3>),
+				row_major_c
+			),
+			el_factorization_type::lower_triangular
+		),
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 3*3>{
+					2., 1., 5.,
+					0., 3., 6.,
+					0., 0., 4.
+				},
+				make_matrix_size(hana::size_c<3>, hana::size_c<3>),
+				row_major_c
+			),
+			el_factorization_type::upper_triangular
+		),
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 3*3>{
+					4., 1., 2.,
+					1., 5., 3.,
+					2., 3., 6.
+				},
+				make_matrix_size(hana::size_c<3>, hana::size_c<3>),
+				row_major_c
+			),
+			el_factorization_type::cholesky
+		),
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 3*3>{
+					0., 1., 2.,
+					1., 0., 3.,
+					2., 3., 0.
+				},
+				make_matrix_size(hana::size_c<3>, hana::size_c<3>),
+				row_major_c
+			),
+			el_factorization_type::ldl
+		),
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 3*3>{
+					4., 1., 2.,
+					7., 5., 3.,
+					2., 8., 6.
+				},
+				make_matrix_size(hana::size_c<3>, hana::size_c<3>),
+				row_major_c
+			),
+			el_factorization_type::lu
+		),
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 3*2>{
+					4., 1.,
+					7., 5.,
+					2., 8.
+				},
+				make_matrix_size(hana::size_c<3>, hana::size_c<2>),
+				row_major_c
+			),
+			el_factorization_type::qr
+		),
+		hana::make_tuple(
+			make_ctsam(
+				std::array<double, 2*3>{
+					4., 1., 2.,
+					7., 5., 3.
+				},
+				make_matrix_size(hana::size_c<2>, hana::size_c<3>),
+				row_major_c
+			),
+			el_factorization_type::lq
+		)
+	);
+	
+	hana::for_each(datasets, [](auto const& dataset) {
+		static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+		auto a = make_el_matrix(hana::at_c<0>(dataset));
+		el_factorization_type const type = hana::at_c<1>(dataset);
+		
+		BOOST_TEST((detail::factorize_impl_el_matrix{}(a).type() == type));
+		BOOST_TEST((detail::factorize_impl_el_dist_matrix{}(make_el_dist_matrix(grid, a)).type() == type));
+	});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -49,10 +49,11 @@ auto
 house_impl_rtsacv::operator()(rtsacv<Ring> const& x) {
 	typedef std::decay_t<Ring> _Ring_;
 	
-	/* x2m is a temporary which is written x(2:m) in the book and is equivalent to x(range(1,m-1)) in this code */
-	auto x2m = (*select)(x, range<std::size_t,std::size_t>{1u, (*size)(x)-1});
-	BOOST_ASSERT((*size)(x2m) == ((*size)(x)-1));
-	auto sigma = (*multiply)(transpose(x2m), x2m);
+	/* sigma is written x(2:m)'*x(2:m) in the book, the dot product is computed in place to avoid copies of x(2:m) */
+	_Ring_ sigma = 0;
+	for (std::size_t i = 1; i < (*size)(x); ++i) {
+		sigma += x.at(i) * x.at(i);
+	}
 
 	/* The vector ni is the vector x with the value 1 in its first row */
 	rtsacv<_Ring_> ni = x;
@@ -25,6 +25,7 @@
 	#include <hbrs/mpl/dt/el_vector/fwd.hpp>
 	#include <hbrs/mpl/dt/el_dist_matrix/fwd.hpp>
 	#include <hbrs/mpl/dt/el_dist_vector/fwd.hpp>
+	#include <hbrs/mpl/dt/el_factorization/fwd.hpp>
 #endif
 
 #include <boost/hana/tuple.hpp>
@@ -43,6 +44,13 @@ struct mldivide_impl_el_matrix_el_vector {
 		el_matrix<Ring> const& a,
 		el_column_vector<Ring> const& b
 	) const;
+	
+	template <typename Ring>
+	auto
+	operator()(
+		el_matrix<Ring> && a,
+		el_column_vector<Ring> const& b
+	) const;
 };
 
 struct mldivide_impl_el_dist_matrix_el_dist_vector {
@@ -55,10 +63,100 @@ struct mldivide_impl_el_dist_matrix_el_dist_vector {
 		el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> const& a,
 		el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
 	) const;
+	
+	template <
+		typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+		/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+	>
+	auto
+	operator()(
+		el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> && a,
+		el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+	) const;
+};
+
+struct mldivide_impl_el_matrix_el_matrix {
+	template <typename Ring>
+	auto
+	operator()(
+		el_matrix<Ring> const& a,
+		el_matrix<Ring> const& b
+	) const;
+	
+	template <typename Ring>
+	auto
+	operator()(
+		el_matrix<Ring> && a,
+		el_matrix<Ring> const& b
+	) const;
+};
+
+struct mldivide_impl_el_dist_matrix_el_dist_matrix {
+	template <
+		typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+		/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+	>
+	auto
+	operator()(
+		el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> const& a,
+		el_dist_matrix<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+	) const;
+	
+	template <
+		typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+		/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+	>
+	auto
+	operator()(
+		el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> && a,
+		el_dist_matrix<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+	) const;
+};
+
+struct mldivide_impl_el_factorization_el_matrix {
+	template <typename Ring>
+	auto
+	operator()(
+		el_factorization<el_matrix<Ring>> const& a,
+		el_column_vector<Ring> const& b
+	) const;
+	
+	template <typename Ring>
+	auto
+	operator()(
+		el_factorization<el_matrix<Ring>> const& a,
+		el_matrix<Ring> const& b
+	) const;
+};
+
+struct mldivide_impl_el_factorization_el_dist_matrix {
+	template <
+		typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+		/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+	>
+	auto
+	operator()(
+		el_factorization<el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping>> const& a,
+		el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+	) const;
+	
+	template <
+		typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+		/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+	>
+	auto
+	operator()(
+		el_factorization<el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping>> const& a,
+		el_dist_matrix<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+	) const;
 };
 #else
 struct mldivide_impl_el_matrix_el_vector {};
 struct mldivide_impl_el_dist_matrix_el_dist_vector {};
+struct mldivide_impl_el_matrix_el_matrix {};
+struct mldivide_impl_el_dist_matrix_el_dist_matrix {};
+struct mldivide_impl_el_factorization_el_matrix {};
+struct mldivide_impl_el_factorization_el_dist_matrix {};
 #endif
 
 /* namespace detail */ }
@@ -66,7 +164,11 @@ HBRS_MPL_NAMESPACE_END
 
 #define HBRS_MPL_FN_MLDIVIDE_IMPLS_ELEMENTAL boost::hana::make_tuple(                                                  \
 		hbrs::mpl::detail::mldivide_impl_el_matrix_el_vector{},                                                        \
-		hbrs::mpl::detail::mldivide_impl_el_dist_matrix_el_dist_vector{}                                               \
+		hbrs::mpl::detail::mldivide_impl_el_dist_matrix_el_dist_vector{},                                              \
+		hbrs::mpl::detail::mldivide_impl_el_matrix_el_matrix{},                                                        \
+		hbrs::mpl::detail::mldivide_impl_el_dist_matrix_el_dist_matrix{},                                              \
+		hbrs::mpl::detail::mldivide_impl_el_factorization_el_matrix{},                                                 \
+		hbrs::mpl::detail::mldivide_impl_el_factorization_el_dist_matrix{}                                             \
 	)
 
 #endif // !HBRS_MPL_FN_MLDIVIDE_FWD_ELEMENTAL_HPP
@@ -27,6 +27,13 @@ mldivide_impl_el_matrix_el_vector::operator()(
 	el_column_vector<El::Complex<float>> const&
 ) const;
 
+template
+auto
+mldivide_impl_el_matrix_el_vector::operator()(
+	el_matrix<El::Complex<float>> &&,
+	el_column_vector<El::Complex<float>> const&
+) const;
+
 template
 auto
 mldivide_impl_el_matrix_el_vector::operator()(
@@ -34,6 +41,13 @@ mldivide_impl_el_matrix_el_vector::operator()(
 	el_column_vector<El::Complex<double>> const&
 ) const;
 
+template
+auto
+mldivide_impl_el_matrix_el_vector::operator()(
+	el_matrix<El::Complex<double>> &&,
+	el_column_vector<El::Complex<double>> const&
+) const;
+
 template
 auto
 mldivide_impl_el_dist_matrix_el_dist_vector::operator()(
@@ -44,10 +58,136 @@ mldivide_impl_el_dist_matrix_el_dist_vector::operator()(
 template
 auto
 mldivide_impl_el_dist_matrix_el_dist_vector::operator()(
+	el_dist_matrix<El::Complex<float>> &&,
+	el_dist_column_vector<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_dist_matrix_el_dist_vector::operator()(
+	el_dist_matrix<El::Complex<double>> const&,
+	el_dist_column_vector<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_dist_matrix_el_dist_vector::operator()(
+	el_dist_matrix<El::Complex<double>> &&,
+	el_dist_column_vector<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_matrix_el_matrix::operator()(
+	el_matrix<El::Complex<float>> const&,
+	el_matrix<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_matrix_el_matrix::operator()(
+	el_matrix<El::Complex<float>> &&,
+	el_matrix<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_matrix_el_matrix::operator()(
+	el_matrix<El::Complex<double>> const&,
+	el_matrix<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_matrix_el_matrix::operator()(
+	el_matrix<El::Complex<double>> &&,
+	el_matrix<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_dist_matrix_el_dist_matrix::operator()(
+	el_dist_matrix<El::Complex<float>> const&,
+	el_dist_matrix<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_dist_matrix_el_dist_matrix::operator()(
+	el_dist_matrix<El::Complex<float>> &&,
+	el_dist_matrix<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_dist_matrix_el_dist_matrix::operator()(
 	el_dist_matrix<El::Complex<double>> const&,
+	el_dist_matrix<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_dist_matrix_el_dist_matrix::operator()(
+	el_dist_matrix<El::Complex<double>> &&,
+	el_dist_matrix<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_factorization_el_matrix::operator()(
+	el_factorization<el_matrix<El::Complex<float>>> const&,
+	el_column_vector<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_factorization_el_matrix::operator()(
+	el_factorization<el_matrix<El::Complex<float>>> const&,
+	el_matrix<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_factorization_el_matrix::operator()(
+	el_factorization<el_matrix<El::Complex<double>>> const&,
+	el_column_vector<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_factorization_el_matrix::operator()(
+	el_factorization<el_matrix<El::Complex<double>>> const&,
+	el_matrix<El::Complex<double>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_factorization_el_dist_matrix::operator()(
+	el_factorization<el_dist_matrix<El::Complex<float>>> const&,
+	el_dist_column_vector<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_factorization_el_dist_matrix::operator()(
+	el_factorization<el_dist_matrix<El::Complex<float>>> const&,
+	el_dist_matrix<El::Complex<float>> const&
+) const;
+
+template
+auto
+mldivide_impl_el_factorization_el_dist_matrix::operator()(
+	el_factorization<el_dist_matrix<El::Complex<double>>> const&,
 	el_dist_column_vector<El::Complex<double>> const&
 ) const;
 
+template
+auto
+mldivide_impl_el_factorization_el_dist_matrix::operator()(
+	el_factorization<el_dist_matrix<El::Complex<double>>> const&,
+	el_dist_matrix<El::Complex<double>> const&
+) const;
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
@@ -27,66 +27,157 @@
 #include <hbrs/mpl/dt/el_dist_matrix.hpp>
 #include <hbrs/mpl/dt/el_vector.hpp>
 #include <hbrs/mpl/dt/el_dist_vector.hpp>
-#include <hbrs/mpl/fn/size.hpp>
-#include <hbrs/mpl/fn/m.hpp>
-#include <hbrs/mpl/fn/n.hpp>
-#include <hbrs/mpl/fn/equal.hpp>
-#include <hbrs/mpl/fn/less.hpp>
+#include <hbrs/mpl/dt/el_factorization.hpp>
+#include <hbrs/mpl/dt/exception.hpp>
+#include <hbrs/mpl/fn/factorize.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <El.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
 namespace detail {
 
-template <typename A, typename X, typename B>
+namespace mldivide_el {
+
+/* Solves L*U*X=B in-place for the output of factorize_el::banded_lu() */
+template<typename Ring>
 static void
-mldivide_el_matrix_el_vector_impl(A const& a, X & x, B const& b) {
-	auto a_sz = (*size)(a);
-	auto a_m = (*m)(a_sz);
-	auto a_n = (*n)(a_sz);
+banded_solve_after(
+	El::Matrix<Ring> const& lu, El::Int kl, El::Int ku, std::vector<El::Int> const& pivots, El::Matrix<Ring> & b
+) {
+	El::Int const n = lu.Height();
+	El::Int const lu_ldim = lu.LDim();
+	Ring const* lu_buf = lu.LockedBuffer();
 	
-	// TODO: Choose appropriate solver as e.g. MATLAB does in https://de.mathworks.com/help/matlab/ref/mldivide.html
-	/* NOTE:
-	 * Let A be m*n and B be m.
-	 *
-	 * If m==n, then mldivide(A,B) from MATLAB Coder [1] uses lusolve(A,B) else qrsolve(A,B).
-	 * If A's rank is less than the number of columns in A (a.k.a. A is under underdetermined; a.k.a. infinite solutions
-	 * exist to Ax=b), then x = mldivide(A,B) is not necessarily the minimum norm solution. [4]
-	 * mldivide(A,B) computes one solution that minimizes ||Ax-b||, but this solution typically does not minimize ||x||.
-	 * The solution computed by lsqminnorm minimizes not only norm(A*x-b), but also norm(x). [5]
-	 * 
-	 * LeastSquares() from Elemental [2] uses QR() and qr::SolveAfter if m>=n, else LQ() and lq::SolveAfter() [3].
-	 *
-	 * References:
-	 * [1] ./toolbox/eml/lib/matlab/ops/mldivide.m
-	 * [2] src/lapack_like/euclidean_min/LeastSquares.cpp
-	 * [3] https://www.netlib.org/lapack/lug/node41.html
-	 * [4] https://de.mathworks.com/help/matlab/ref/mldivide.html
-	 * [5] https://de.mathworks.com/help/matlab/ref/lsqminnorm.html
-	 */
-	// TODO: Either change MATLAB code or Elemental code to get equal results.
+	for(El::Int c = 0; c < b.Width(); ++c) {
+		Ring * b_c = b.Buffer(0, c);
+		
+		// apply row interchanges and L^-1
+		for(El::Int k = 0; k < n; ++k) {
+			std::swap(b_c[k], b_c[pivots[k]]);
+			for(El::Int i = k+1; i < std::min(n, k+kl+1); ++i) {
+				b_c[i] -= lu_buf[i+k*lu_ldim] * b_c[k];
+			}
+		}
+		
+		// apply U^-1, where U has upper bandwidth kl+ku due to row interchanges
+		for(El::Int k = n-1; k >= 0; --k) {
+			b_c[k] /= lu_buf[k+k*lu_ldim];
+			for(El::Int i = std::max(El::Int{0}, k-kl-ku); i < k; ++i) {
+				b_c[i] -= lu_buf[i+k*lu_ldim] * b_c[k];
+			}
+		}
+	}
+}
+
+template<typename Ring>
+static void
+banded_solve_after(el_factorization<el_matrix<Ring>> const& f, El::Matrix<Ring> & b) {
+	banded_solve_after(f.factors().data(), f.lower_bandwidth(), f.upper_bandwidth(), f.pivots(), b);
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping, typename B>
+static void
+banded_solve_after(el_factorization<el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping>> const&, B &) {
+	// factorize() does not compute banded factorizations of distributed matrices
+	BOOST_THROW_EXCEPTION(not_supported_exception{});
+}
+
+/* NOTE:
+ * Let A be m*n and B be m*k.
+ *
+ * If m==n, then mldivide(A,B) from MATLAB Coder [1] uses lusolve(A,B) else qrsolve(A,B).
+ * If A's rank is less than the number of columns in A (a.k.a. A is under underdetermined; a.k.a. infinite solutions
+ * exist to Ax=b), then x = mldivide(A,B) is not necessarily the minimum norm solution. [4]
+ * mldivide(A,B) computes one solution that minimizes ||Ax-b||, but this solution typically does not minimize ||x||.
+ * The solution computed by lsqminnorm minimizes not only norm(A*x-b), but also norm(x). [5]
+ *
+ * For non-square A, factorize() uses QR() and qr::SolveAfter if m>=n, else LQ() and lq::SolveAfter() [3], just like
+ * LeastSquares() from Elemental [2]. For square A, factorize() picks a solver from A's structure like MATLAB [4] does,
+ * i.e. substitution for triangular A, Cholesky or LDL for Hermitian A and LU otherwise.
+ *
+ * References:
+ * [1] ./toolbox/eml/lib/matlab/ops/mldivide.m
+ * [2] src/lapack_like/euclidean_min/LeastSquares.cpp
+ * [3] https://www.netlib.org/lapack/lug/node41.html
+ * [4] https://de.mathworks.com/help/matlab/ref/mldivide.html
+ * [5] https://de.mathworks.com/help/matlab/ref/lsqminnorm.html
+ */
+// TODO: Either change MATLAB code or Elemental code to get equal results.
+template <typename Factorization, typename B, typename X>
+static void
+solve(Factorization const& f, B const& b, X & x) {
+	auto const& a = f.factors().data();
+	typedef std::decay_t<decltype(a.Get(0,0))> Ring;
 	
-	if ((*equal)(a_m, a_n)) {
-		// a is square matrix
-		x = b;
-		El::LinearSolve(a.data(), x.data());
-		BOOST_ASSERT(x.data().Width() == 1);
-	} else {
-		// if a_m < a_n then a is underdetermined
-		// if a_m > a_n then a is overdetermined
-		El::LeastSquares(El::NORMAL, a.data(), b.data(), x.data());
-		BOOST_ASSERT(x.data().Width() == 1);
+	if (f.type() == el_factorization_type::qr) {
+		El::qr::SolveAfter(El::NORMAL, a, f.scalars(), f.signature(), b.data(), x.data());
+		return;
+	} else if (f.type() == el_factorization_type::lq) {
+		El::lq::SolveAfter(El::NORMAL, a, f.scalars(), f.signature(), b.data(), x.data());
+		return;
+	}
+	
+	if (a.Height() != b.data().Height()) {
+		BOOST_THROW_EXCEPTION((
+			incompatible_matrices_exception{}
+			<< errinfo_el_matrix_sizes{{ {a.Height(), a.Width()}, {b.data().Height(), b.data().Width()} }}
+		));
+	}
+	
+	x = b;
+	auto & x_ = x.data();
+	switch (f.type()) {
+		case el_factorization_type::diagonal:
+			El::DiagonalSolve(El::LEFT, El::NORMAL, f.scalars(), x_);
+			break;
+		case el_factorization_type::lower_triangular:
+			El::Trsm(El::LEFT, El::LOWER, El::NORMAL, El::NON_UNIT, Ring(1), a, x_);
+			break;
+		case el_factorization_type::upper_triangular:
+			El::Trsm(El::LEFT, El::UPPER, El::NORMAL, El::NON_UNIT, Ring(1), a, x_);
+			break;
+		case el_factorization_type::banded:
+			banded_solve_after(f, x_);
+			break;
+		case el_factorization_type::cholesky:
+			El::cholesky::SolveAfter(El::LOWER, El::NORMAL, a, x_);
+			break;
+		case el_factorization_type::ldl:
+			El::ldl::SolveAfter(a, f.scalars(), f.permutation(), x_, true);
+			break;
+		case el_factorization_type::lu:
+			El::lu::SolveAfter(El::NORMAL, a, f.permutation(), x_);
+			break;
+		default:
+			BOOST_THROW_EXCEPTION(not_supported_exception{});
 	}
 }
 
+/* namespace mldivide_el */ }
+
 template <typename Ring>
 auto
 mldivide_impl_el_matrix_el_vector::operator()(
 	el_matrix<Ring> const& a,
 	el_column_vector<Ring> const& b
 ) const {
-	el_column_vector<Ring> x{0};
-	mldivide_el_matrix_el_vector_impl(a, x, b);
-	return x;
+	return mldivide_impl_el_factorization_el_matrix{}((*factorize)(a), b);
+}
+
+template <typename Ring>
+auto
+mldivide_impl_el_matrix_el_vector::operator()(
+	el_matrix<Ring> && a,
+	el_column_vector<Ring> const& b
+) const {
+	return mldivide_impl_el_factorization_el_matrix{}((*factorize)(std::move(a)), b);
 }
 
 template <
@@ -98,8 +189,112 @@ mldivide_impl_el_dist_matrix_el_dist_vector::operator()(
 	el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> const& a,
 	el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
 ) const {
-	el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> x{a.data().Grid(), 0};
-	mldivide_el_matrix_el_vector_impl(a, x, b);
+	return mldivide_impl_el_factorization_el_dist_matrix{}((*factorize)(a), b);
+}
+
+template <
+	typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+	/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+>
+auto
+mldivide_impl_el_dist_matrix_el_dist_vector::operator()(
+	el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> && a,
+	el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+) const {
+	return mldivide_impl_el_factorization_el_dist_matrix{}((*factorize)(std::move(a)), b);
+}
+
+template <typename Ring>
+auto
+mldivide_impl_el_matrix_el_matrix::operator()(
+	el_matrix<Ring> const& a,
+	el_matrix<Ring> const& b
+) const {
+	return mldivide_impl_el_factorization_el_matrix{}((*factorize)(a), b);
+}
+
+template <typename Ring>
+auto
+mldivide_impl_el_matrix_el_matrix::operator()(
+	el_matrix<Ring> && a,
+	el_matrix<Ring> const& b
+) const {
+	return mldivide_impl_el_factorization_el_matrix{}((*factorize)(std::move(a)), b);
+}
+
+template <
+	typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+	/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+>
+auto
+mldivide_impl_el_dist_matrix_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> const& a,
+	el_dist_matrix<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+) const {
+	return mldivide_impl_el_factorization_el_dist_matrix{}((*factorize)(a), b);
+}
+
+template <
+	typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+	/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+>
+auto
+mldivide_impl_el_dist_matrix_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping> && a,
+	el_dist_matrix<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+) const {
+	return mldivide_impl_el_factorization_el_dist_matrix{}((*factorize)(std::move(a)), b);
+}
+
+template <typename Ring>
+auto
+mldivide_impl_el_factorization_el_matrix::operator()(
+	el_factorization<el_matrix<Ring>> const& a,
+	el_column_vector<Ring> const& b
+) const {
+	el_column_vector<Ring> x{0};
+	mldivide_el::solve(a, b, x);
+	BOOST_ASSERT(x.data().Width() == 1);
+	return x;
+}
+
+template <typename Ring>
+auto
+mldivide_impl_el_factorization_el_matrix::operator()(
+	el_factorization<el_matrix<Ring>> const& a,
+	el_matrix<Ring> const& b
+) const {
+	el_matrix<Ring> x{0, 0};
+	mldivide_el::solve(a, b, x);
+	return x;
+}
+
+template <
+	typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+	/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+>
+auto
+mldivide_impl_el_factorization_el_dist_matrix::operator()(
+	el_factorization<el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping>> const& a,
+	el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+) const {
+	el_dist_column_vector<Ring, ColumnwiseR, RowwiseR, Wrapping> x{a.factors().data().Grid(), 0};
+	mldivide_el::solve(a, b, x);
+	BOOST_ASSERT(x.data().Width() == 1);
+	return x;
+}
+
+template <
+	typename Ring, El::Dist ColumnwiseL, El::Dist RowwiseL, El::DistWrap Wrapping,
+	/*          */ El::Dist ColumnwiseR, El::Dist RowwiseR
+>
+auto
+mldivide_impl_el_factorization_el_dist_matrix::operator()(
+	el_factorization<el_dist_matrix<Ring, ColumnwiseL, RowwiseL, Wrapping>> const& a,
+	el_dist_matrix<Ring, ColumnwiseR, RowwiseR, Wrapping> const& b
+) const {
+	el_dist_matrix<Ring, ColumnwiseR, RowwiseR, Wrapping> x{a.factors().data().Grid(), 0, 0};
+	mldivide_el::solve(a, b, x);
 	return x;
 }
 
@@ -26,6 +26,8 @@
 	#include <hbrs/mpl/dt/el_dist_matrix.hpp>
 	#include <hbrs/mpl/dt/el_vector.hpp>
 	#include <hbrs/mpl/dt/el_dist_vector.hpp>
+	#include <hbrs/mpl/dt/el_factorization.hpp>
+	#include <hbrs/mpl/fn/factorize.hpp>
 #endif
 #ifdef HBRS_MPL_ENABLE_MATLAB
 	#include <hbrs/mpl/dt/ml_matrix.hpp>
@@ -74,6 +76,8 @@
 #include <boost/hana/remove_at.hpp>
 
 #include <array>
+#include <utility>
+#include <vector>
 
 namespace utf = boost::unit_test;
 namespace tt = boost::test_tools;
@@ -393,4 +397,82 @@ BOOST_AUTO_TEST_CASE(mldivide_comparison_Ax_b,  * utf::tolerance(_TOL)) {
 	
 }
 
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+BOOST_AUTO_TEST_CASE(mldivide_structured_multiple_rhs, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static constexpr El::Int n_ = 8;
+	static constexpr El::Int k_ = 3;
+	
+	auto make = [](auto && a_ij) {
+		el_matrix<double> a{n_, n_};
+		for (El::Int j = 0; j < n_; ++j) {
+			for (El::Int i = 0; i < n_; ++i) {
+				a.data().Set(i, j, a_ij(i, j));
+			}
+		}
+		return a;
+	};
+	
+	std::vector<std::pair<el_factorization_type, el_matrix<double>>> datasets;
+	datasets.emplace_back(el_factorization_type::diagonal,
+		make([](El::Int i, El::Int j) { return i == j ? i+1. : 0.; }));
+	datasets.emplace_back(el_factorization_type::lower_triangular,
+		make([](El::Int i, El::Int j) { return i >= j ? 1.+i+2*j : 0.; }));
+	datasets.emplace_back(el_factorization_type::upper_triangular,
+		make([](El::Int i, El::Int j) { return i <= j ? 1.+2*i+j : 0.; }));
+	datasets.emplace_back(el_factorization_type::banded,
+		make([](El::Int i, El::Int j) { return i == j ? 1. : (i == j+1 ? -4. : (i+1 == j ? 2. : 0.)); }));
+	datasets.emplace_back(el_factorization_type::cholesky,
+		make([](El::Int i, El::Int j) { return i == j ? n_+1. : 1./(1+i+j); }));
+	/* positive diagonal but indefinite, hence Cholesky fails and LDL is used instead */
+	datasets.emplace_back(el_factorization_type::ldl,
+		make([](El::Int i, El::Int j) { return i == j ? 1. : 2.; }));
+	datasets.emplace_back(el_factorization_type::lu,
+		make([](El::Int i, El::Int j) { return i == j ? 20. : ((3*i+7*j) % 5) - 2.; }));
+	
+	el_matrix<double> x{n_, k_};
+	for (El::Int j = 0; j < k_; ++j) {
+		for (El::Int i = 0; i < n_; ++i) {
+			x.data().Set(i, j, 1. + i + 0.25*j);
+		}
+	}
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	auto x_d = make_el_dist_matrix(grid, x);
+	
+	for (auto const& dataset : datasets) {
+		el_factorization_type const type = dataset.first;
+		el_matrix<double> const& a = dataset.second;
+		BOOST_TEST_MESSAGE("factorization type=" << static_cast<int>(type));
+		
+		auto b = (*multiply)(a, x);
+		el_column_vector<double> b_1{n_};
+		El::Copy(b.data()(El::ALL, El::IR(0)), b_1.data());
+		
+		{
+			auto f = (*factorize)(a);
+			BOOST_TEST((f.type() == type));
+			
+			// the factorization is reused for several right hand sides
+			HBRS_MPL_TEST_MMEQ((*mldivide)(f, b), x, false);
+			HBRS_MPL_TEST_VVEQ((*mldivide)(f, b_1), (*mldivide)(a, b_1), false);
+			HBRS_MPL_TEST_MMEQ((*mldivide)(a, b), x, false);
+		}
+		
+		{
+			auto a_d = make_el_dist_matrix(grid, a);
+			auto b_d = make_el_dist_matrix(grid, b);
+			
+			auto f = (*factorize)(a_d);
+			// banded distributed matrices are factorized with LU
+			BOOST_TEST((f.type() == (type == el_factorization_type::banded ? el_factorization_type::lu : type)));
+			
+			HBRS_MPL_TEST_MMEQ((*mldivide)(f, b_d), x_d, false);
+			HBRS_MPL_TEST_MMEQ((*mldivide)(a_d, b_d), x_d, false);
+		}
+	}
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,9 @@
 	#include <hbrs/mpl/dt/el_vector/fwd.hpp>
 	#include <hbrs/mpl/dt/el_dist_vector/fwd.hpp>
 	#include <hbrs/mpl/dt/scv/fwd.hpp>
+	#include <hbrs/mpl/dt/hankel_matrix/fwd.hpp>
+	#include <hbrs/mpl/dt/expression/fwd.hpp>
+	#include <hbrs/mpl/fn/transpose/fwd.hpp>
 	#include <boost/mpl/if.hpp>
 	#include <boost/mpl/void.hpp>
 	#include <boost/hana/ext/std/vector.hpp>
@@ -113,6 +116,65 @@ struct multiply_impl_el_matrix_scalar {
 	operator()(el_matrix<Ring> a, Ring const& b) const;
 };
 
+struct multiply_impl_hankel_matrix_el_matrix {
+	template <
+		typename RingH,
+		typename RingB,
+		typename std::enable_if_t<
+			std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+		>* = nullptr
+	>
+	auto
+	operator()(hankel_matrix<el_matrix<RingH>, El::Int> const& a, el_matrix<RingB> const& b) const;
+	
+	template <
+		typename RingH,
+		typename RingB,
+		typename std::enable_if_t<
+			std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+		>* = nullptr
+	>
+	auto
+	operator()(
+		expression<
+			transpose_t,
+			hana::tuple<hankel_matrix<el_matrix<RingH>, El::Int> const&>
+		> const& a,
+		el_matrix<RingB> const& b
+	) const;
+};
+
+struct multiply_impl_hankel_matrix_el_dist_matrix {
+	template <
+		typename RingH, El::Dist ColumnwiseH, El::Dist RowwiseH, El::DistWrap Wrapping,
+		typename RingB, El::Dist ColumnwiseB, El::Dist RowwiseB,
+		typename std::enable_if_t<
+			std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+		>* = nullptr
+	>
+	auto
+	operator()(
+		hankel_matrix<el_dist_matrix<RingH, ColumnwiseH, RowwiseH, Wrapping>, El::Int> const& a,
+		el_dist_matrix<RingB, ColumnwiseB, RowwiseB, Wrapping> const& b
+	) const;
+	
+	template <
+		typename RingH, El::Dist ColumnwiseH, El::Dist RowwiseH, El::DistWrap Wrapping,
+		typename RingB, El::Dist ColumnwiseB, El::Dist RowwiseB,
+		typename std::enable_if_t<
+			std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+		>* = nullptr
+	>
+	auto
+	operator()(
+		expression<
+			transpose_t,
+			hana::tuple<hankel_matrix<el_dist_matrix<RingH, ColumnwiseH, RowwiseH, Wrapping>, El::Int> const&>
+		> const& a,
+		el_dist_matrix<RingB, ColumnwiseB, RowwiseB, Wrapping> const& b
+	) const;
+};
+
 #else
 struct multiply_impl_el_matrix_el_matrix {};
 struct multiply_impl_el_matrix_el_vector {};
@@ -120,6 +182,8 @@ struct multiply_impl_el_dist_matrix_el_dist_matrix {};
 struct multiply_impl_el_dist_matrix_el_dist_vector {};
 struct multiply_impl_el_matrix_scv_vector {};
 struct multiply_impl_el_matrix_scalar {};
+struct multiply_impl_hankel_matrix_el_matrix {};
+struct multiply_impl_hankel_matrix_el_dist_matrix {};
 #endif
 
 /* namespace detail */ }
@@ -131,7 +195,9 @@ HBRS_MPL_NAMESPACE_END
 		hbrs::mpl::detail::multiply_impl_el_matrix_scv_vector{},                                                       \
 		hbrs::mpl::detail::multiply_impl_el_matrix_scalar{},                                                           \
 		hbrs::mpl::detail::multiply_impl_el_dist_matrix_el_dist_matrix{},                                              \
-		hbrs::mpl::detail::multiply_impl_el_dist_matrix_el_dist_vector{}                                               \
+		hbrs::mpl::detail::multiply_impl_el_dist_matrix_el_dist_vector{},                                              \
+		hbrs::mpl::detail::multiply_impl_hankel_matrix_el_matrix{},                                                    \
+		hbrs::mpl::detail::multiply_impl_hankel_matrix_el_dist_matrix{}                                                \
 	)
 
 #endif // !HBRS_MPL_FN_MULTIPLY_FWD_ELEMENTAL_HPP
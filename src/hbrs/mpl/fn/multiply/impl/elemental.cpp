@@ -39,6 +39,16 @@ template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(
 template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<double>              const&, el_dist_matrix<El::Complex<double>> const&) const;
 template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>> const&, el_dist_matrix<double>              const&) const;
 
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<float, El::VC, El::STAR> const&, el_dist_matrix<float, El::STAR, El::STAR> const&) const;
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>, El::VC, El::STAR> const&, el_dist_matrix<El::Complex<float>, El::STAR, El::STAR> const&) const;
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<double, El::VC, El::STAR> const&, el_dist_matrix<double, El::STAR, El::STAR> const&) const;
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>, El::VC, El::STAR> const&, el_dist_matrix<El::Complex<double>, El::STAR, El::STAR> const&) const;
+
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<float, El::STAR, El::VC> const&, el_dist_matrix<float, El::VC, El::STAR> const&) const;
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>, El::STAR, El::VC> const&, el_dist_matrix<El::Complex<float>, El::VC, El::STAR> const&) const;
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<double, El::STAR, El::VC> const&, el_dist_matrix<double, El::VC, El::STAR> const&) const;
+template decltype(auto) multiply_impl_el_dist_matrix_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>, El::STAR, El::VC> const&, el_dist_matrix<El::Complex<double>, El::VC, El::STAR> const&) const;
+
 template auto multiply_impl_el_matrix_scv_vector::operator()(el_matrix<float>              const&, scv<std::vector<int>> const&) const;
 //TODO: Solve "error: call to 'operator*' is ambiguous" for El::Complex<...> types
 // template auto multiply_impl_el_matrix_scv_vector::operator()(el_matrix<El::Complex<float>> const&, scv<std::vector<int>> const&) const;
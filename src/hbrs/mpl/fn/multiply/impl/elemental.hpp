@@ -27,14 +27,25 @@
 
 #include <hbrs/mpl/core/preprocessor.hpp>
 #include <hbrs/mpl/dt/scv.hpp>
+#include <hbrs/mpl/dt/hankel_matrix.hpp>
+#include <hbrs/mpl/dt/expression.hpp>
 #include <hbrs/mpl/dt/matrix_index.hpp>
 #include <hbrs/mpl/dt/exception.hpp>
+#include <hbrs/mpl/detail/async.hpp>
+#include <hbrs/mpl/detail/mpi.hpp>
+#include <hbrs/mpl/detail/tall_skinny.hpp>
 #include <hbrs/mpl/fn/size.hpp>
 #include <hbrs/mpl/fn/at.hpp>
 #include <hbrs/mpl/fn/multiply.hpp>
 #include <hbrs/mpl/fn/not_equal.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <algorithm>
 
 HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
 namespace detail {
 
 template <typename A, typename B, typename C>
@@ -92,6 +103,102 @@ multiply_el_matrix_el_vector_impl(A const& a, B const& b, C c) {
 	return c;
 }
 
+/* Each process owns complete rows of a, e.g. with [VC,STAR], and all of b, hence no communication is required */
+template <typename Ring, El::Dist Columnwise, El::DistWrap Wrapping>
+static auto
+multiply_row_distributed_replicated(
+	El::DistMatrix<Ring, Columnwise, El::STAR, Wrapping> const& a,
+	El::DistMatrix<Ring, El::STAR, El::STAR, Wrapping> const& b
+) {
+	if (a.Width() != b.Height()) {
+		BOOST_THROW_EXCEPTION((
+			incompatible_matrices_exception{}
+			<< errinfo_el_matrix_sizes{{ {a.Height(), a.Width()}, {b.Height(), b.Width()} }}
+		));
+	}
+	
+	El::DistMatrix<Ring, Columnwise, El::STAR, Wrapping> c{a.Grid()};
+	c.AlignWith(a.DistData());
+	c.Resize(a.Height(), b.Width());
+	
+	El::Gemm(
+		El::Orientation::NORMAL,
+		El::Orientation::NORMAL,
+		Ring(1),
+		a.LockedMatrix(),
+		b.LockedMatrix(),
+		Ring(0),
+		c.Matrix()
+	);
+	
+	return c;
+}
+
+/* Inner dimension is distributed, e.g. [STAR,VC] times [VC,STAR] like in a Gram matrix A'*A of a tall-skinny A, hence
+ * the small product is computed from local columns of a and local rows of b and then reduced once to all processes.
+ */
+template <typename Ring, El::Dist Inner, El::DistWrap Wrapping>
+static auto
+multiply_inner_distributed(
+	El::DistMatrix<Ring, El::STAR, Inner, Wrapping> const& a,
+	El::DistMatrix<Ring, Inner, El::STAR, Wrapping> const& b
+) {
+	if (a.Width() != b.Height()) {
+		BOOST_THROW_EXCEPTION((
+			incompatible_matrices_exception{}
+			<< errinfo_el_matrix_sizes{{ {a.Height(), a.Width()}, {b.Height(), b.Width()} }}
+		));
+	}
+	
+	// local columns of a and local rows of b must refer to the same global indices
+	El::DistMatrix<Ring, Inner, El::STAR, Wrapping> b_aligned{b.Grid()};
+	bool const realign = a.RowAlign() != b.ColAlign();
+	if (realign) {
+		b_aligned.AlignCols(a.RowAlign());
+		El::Copy(b, b_aligned);
+	}
+	El::Matrix<Ring> const& b_lcl = realign ? b_aligned.LockedMatrix() : b.LockedMatrix();
+	
+	El::DistMatrix<Ring, El::STAR, El::STAR, Wrapping> c{a.Grid()};
+	El::Zeros(c, a.Height(), b.Width());
+	
+	if constexpr (El::IsComplex<Ring>::value) {
+		El::Gemm(
+			El::Orientation::NORMAL,
+			El::Orientation::NORMAL,
+			Ring(1),
+			a.LockedMatrix(),
+			b_lcl,
+			Ring(0),
+			c.Matrix()
+		);
+		El::AllReduce(c.Matrix(), a.RowComm());
+	} else {
+		// projections in iterative methods, e.g. power iterations, reduce products of the same shape again and again,
+		// hence buffer and plan of the reduction are kept for the next call
+		static thread_local mpi::allreduce_buffer<Ring> reduction;
+		Ring * buf = reduction.bind(
+			boost::numeric_cast<std::size_t>(a.Height() * b.Width()),
+			mpi::datatype(hana::type_c<Ring>), MPI_SUM, a.RowComm().comm);
+		
+		El::Matrix<Ring> c_lcl;
+		c_lcl.Attach(a.Height(), b.Width(), buf, std::max<El::Int>(a.Height(), 1));
+		El::Gemm(
+			El::Orientation::NORMAL,
+			El::Orientation::NORMAL,
+			Ring(1),
+			a.LockedMatrix(),
+			b_lcl,
+			Ring(0),
+			c_lcl
+		);
+		reduction.plan().execute();
+		El::Copy(c_lcl, c.Matrix());
+	}
+	
+	return c;
+}
+
 template <
 	typename RingL,
 	typename RingR,
@@ -139,19 +246,35 @@ multiply_impl_el_dist_matrix_el_dist_matrix::operator()(
 ) const {
 	BOOST_ASSERT(a.data().Grid() == b.data().Grid());
 	
-	typedef std::common_type_t<RingL, RingR> Ring;
-	
-	El::DistMatrixReadProxy<RingL, Ring, ColumnwiseL, RowwiseL, Wrapping> a_pxy = {a.data()};
-	El::DistMatrixReadProxy<RingR, Ring, ColumnwiseR, RowwiseR, Wrapping> b_pxy = {b.data()};
-	
-	return make_el_dist_matrix(
-		multiply_el_matrix_el_matrix_impl(
-			a_pxy.GetLocked(),
-			b_pxy.GetLocked(),
-			// "El::MC, El::MR" as used by proxy in Elemental/src/blas_like/level3/Gemm/NN.hpp
-			El::DistMatrix<Ring, El::MC, El::MR, Wrapping>{a.data().Grid()}
-		)
-	);
+	if constexpr (
+		std::is_same_v<RingL, RingR> &&
+		ColumnwiseL != El::STAR && is_row_distributed_v<ColumnwiseL, RowwiseL> &&
+		ColumnwiseR == El::STAR && RowwiseR == El::STAR
+	) {
+		// e.g. [VC,STAR] times [STAR,STAR]: each process owns complete rows of a and all of b
+		return make_el_dist_matrix(multiply_row_distributed_replicated(a.data(), b.data()));
+	} else if constexpr (
+		std::is_same_v<RingL, RingR> &&
+		ColumnwiseL == El::STAR && RowwiseL == ColumnwiseR &&
+		ColumnwiseR != El::STAR && is_row_distributed_v<ColumnwiseR, RowwiseR>
+	) {
+		// e.g. [STAR,VC] times [VC,STAR] as in transpose(A)*A: local products are reduced once
+		return make_el_dist_matrix(multiply_inner_distributed(a.data(), b.data()));
+	} else {
+		typedef std::common_type_t<RingL, RingR> Ring;
+		
+		El::DistMatrixReadProxy<RingL, Ring, ColumnwiseL, RowwiseL, Wrapping> a_pxy = {a.data()};
+		El::DistMatrixReadProxy<RingR, Ring, ColumnwiseR, RowwiseR, Wrapping> b_pxy = {b.data()};
+		
+		return make_el_dist_matrix(
+			multiply_el_matrix_el_matrix_impl(
+				a_pxy.GetLocked(),
+				b_pxy.GetLocked(),
+				// "El::MC, El::MR" as used by proxy in Elemental/src/blas_like/level3/Gemm/NN.hpp
+				El::DistMatrix<Ring, El::MC, El::MR, Wrapping>{a.data().Grid()}
+			)
+		);
+	}
 }
 
 
@@ -220,6 +343,131 @@ multiply_impl_el_matrix_scalar::operator()(el_matrix<Ring> a, Ring const& b) con
 	return a;
 }
 
+/* Block row i of a block-Hankel matrix H (see dt/hankel_matrix) is the column window X(:, i:i+n-d) of the snapshot
+ * matrix X. Hence H*B and H'*B are computed with d Gemms on views of X without materialising H.
+ */
+template <typename X, typename B, typename C>
+static void
+multiply_hankel_el_matrix_impl(El::Orientation orientation, X const& x, El::Int delays, B const& b, C & c) {
+	typedef decltype(c.Get(0,0)) Ring;
+	typedef std::decay_t<Ring> _Ring_;
+	
+	El::Int const x_m = x.Height();
+	El::Int const h_m = delays * x_m;
+	El::Int const h_n = x.Width() - delays + 1;
+	
+	if (orientation == El::NORMAL) {
+		if (h_n != b.Height()) {
+			BOOST_THROW_EXCEPTION((
+				incompatible_matrices_exception{}
+				<< errinfo_el_matrix_sizes{{ {h_m, h_n}, {b.Height(), b.Width()} }}
+			));
+		}
+		
+		El::Zeros(c, h_m, b.Width());
+		for (El::Int i = 0; i < delays; ++i) {
+			auto c_i = El::View(c, El::IR(i*x_m, (i+1)*x_m), El::ALL);
+			El::Gemm(El::NORMAL, El::NORMAL, _Ring_(1), x(El::ALL, El::IR(i, i+h_n)), b, _Ring_(0), c_i);
+		}
+	} else {
+		if (h_m != b.Height()) {
+			BOOST_THROW_EXCEPTION((
+				incompatible_matrices_exception{}
+				<< errinfo_el_matrix_sizes{{ {h_n, h_m}, {b.Height(), b.Width()} }}
+			));
+		}
+		
+		El::Zeros(c, h_n, b.Width());
+		for (El::Int i = 0; i < delays; ++i) {
+			El::Gemm(
+				orientation, El::NORMAL, _Ring_(1),
+				x(El::ALL, El::IR(i, i+h_n)), b(El::IR(i*x_m, (i+1)*x_m), El::ALL),
+				_Ring_(1), c
+			);
+		}
+	}
+}
+
+template <
+	typename RingH,
+	typename RingB,
+	typename std::enable_if_t<
+		std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+	>*
+>
+auto
+multiply_impl_hankel_matrix_el_matrix::operator()(
+	hankel_matrix<el_matrix<RingH>, El::Int> const& a,
+	el_matrix<RingB> const& b
+) const {
+	El::Matrix<std::remove_const_t<RingB>> c;
+	multiply_hankel_el_matrix_impl(El::NORMAL, a.snapshots().data(), a.delays(), b.data(), c);
+	return make_el_matrix(std::move(c));
+}
+
+template <
+	typename RingH,
+	typename RingB,
+	typename std::enable_if_t<
+		std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+	>*
+>
+auto
+multiply_impl_hankel_matrix_el_matrix::operator()(
+	expression<
+		transpose_t,
+		hana::tuple<hankel_matrix<el_matrix<RingH>, El::Int> const&>
+	> const& a,
+	el_matrix<RingB> const& b
+) const {
+	auto const& h = hana::at_c<0>(a.operands());
+	El::Matrix<std::remove_const_t<RingB>> c;
+	multiply_hankel_el_matrix_impl(El::TRANSPOSE, h.snapshots().data(), h.delays(), b.data(), c);
+	return make_el_matrix(std::move(c));
+}
+
+template <
+	typename RingH, El::Dist ColumnwiseH, El::Dist RowwiseH, El::DistWrap Wrapping,
+	typename RingB, El::Dist ColumnwiseB, El::Dist RowwiseB,
+	typename std::enable_if_t<
+		std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+	>*
+>
+auto
+multiply_impl_hankel_matrix_el_dist_matrix::operator()(
+	hankel_matrix<el_dist_matrix<RingH, ColumnwiseH, RowwiseH, Wrapping>, El::Int> const& a,
+	el_dist_matrix<RingB, ColumnwiseB, RowwiseB, Wrapping> const& b
+) const {
+	BOOST_ASSERT(a.snapshots().data().Grid() == b.data().Grid());
+	
+	El::DistMatrix<std::remove_const_t<RingB>, El::MC, El::MR, Wrapping> c{b.data().Grid()};
+	multiply_hankel_el_matrix_impl(El::NORMAL, a.snapshots().data(), a.delays(), b.data(), c);
+	return make_el_dist_matrix(std::move(c));
+}
+
+template <
+	typename RingH, El::Dist ColumnwiseH, El::Dist RowwiseH, El::DistWrap Wrapping,
+	typename RingB, El::Dist ColumnwiseB, El::Dist RowwiseB,
+	typename std::enable_if_t<
+		std::is_same_v<std::remove_const_t<RingH>, std::remove_const_t<RingB>>
+	>*
+>
+auto
+multiply_impl_hankel_matrix_el_dist_matrix::operator()(
+	expression<
+		transpose_t,
+		hana::tuple<hankel_matrix<el_dist_matrix<RingH, ColumnwiseH, RowwiseH, Wrapping>, El::Int> const&>
+	> const& a,
+	el_dist_matrix<RingB, ColumnwiseB, RowwiseB, Wrapping> const& b
+) const {
+	auto const& h = hana::at_c<0>(a.operands());
+	BOOST_ASSERT(h.snapshots().data().Grid() == b.data().Grid());
+	
+	El::DistMatrix<std::remove_const_t<RingB>, El::MC, El::MR, Wrapping> c{b.data().Grid()};
+	multiply_hankel_el_matrix_impl(El::TRANSPOSE, h.snapshots().data(), h.delays(), b.data(), c);
+	return make_el_dist_matrix(std::move(c));
+}
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
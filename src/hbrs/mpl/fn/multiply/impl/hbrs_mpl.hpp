@@ -32,6 +32,8 @@
 #include <hbrs/mpl/fn/select.hpp>
 #include <hbrs/mpl/fn/multiply.hpp>
 #include <hbrs/mpl/fn/at.hpp>
+#include <hbrs/mpl/detail/simd.hpp>
+#include <hbrs/mpl/detail/thread_pool.hpp>
 #include <cmath>
 
 HBRS_MPL_NAMESPACE_BEGIN
@@ -99,27 +101,57 @@ multiply_rtsam_rtsam_impl(Matrix1 const& m1, Matrix2 const& m2, hana::basic_type
 	//TODO: Choose optimal storage order
 	rtsam<_Ring_, storage_order::row_major> result {m1_m, m2_n};
 	
-	for (std::size_t i = 0; i < m1_m; ++i) {
-		for (std::size_t j = 0; j < m2_n; ++j) {
-			(*at)(result, make_matrix_index(i, j)) =
-				(*multiply)(
-					select(
-						m1,
-						std::make_pair(
-							i,
-							range<std::size_t,std::size_t>(0u, m1_n - 1u)
+	// rows of the result are computed in parallel
+	parallel_for(0, m1_m, grain_size(m1_m, m1_n * m2_n), [&](std::size_t first, std::size_t last) {
+		for (std::size_t i = first; i < last; ++i) {
+			for (std::size_t j = 0; j < m2_n; ++j) {
+				(*at)(result, make_matrix_index(i, j)) =
+					(*multiply)(
+						select(
+							m1,
+							std::make_pair(
+								i,
+								range<std::size_t,std::size_t>(0u, m1_n - 1u)
+							)
+						),
+						select(
+							m2,
+							std::make_pair(
+								range<std::size_t,std::size_t>(0u, m2_m - 1u),
+								j
+							)
 						)
-					),
-					select(
-						m2,
-						std::make_pair(
-							range<std::size_t,std::size_t>(0u, m2_m - 1u),
-							j
-						)
-					)
-				);
+					);
+			}
 		}
-	}
+	});
+	return result;
+}
+
+/* Row-major operands are multiplied with the small-GEMM kernel for the cpu's instruction set, see detail/simd */
+template<typename Ring>
+static auto
+multiply_rtsam_rtsam_row_major_impl(
+	rtsam<Ring, storage_order::row_major> const& m1,
+	rtsam<Ring, storage_order::row_major> const& m2
+) {
+	auto m1_m = (*m)((*size)(m1));
+	auto m1_n = (*n)((*size)(m1));
+	auto m2_n = (*n)((*size)(m2));
+	
+	BOOST_ASSERT(m1_n == (*m)((*size)(m2)));
+	
+	rtsam<Ring, storage_order::row_major> result {m1_m, m2_n};
+	Ring const* m1_buf = m1.data().data();
+	Ring const* m2_buf = m2.data().data();
+	Ring * result_buf = result.data().data();
+	
+	// rows of the result are computed in parallel
+	parallel_for(0, m1_m, grain_size(m1_m, m1_n * m2_n), [&](std::size_t first, std::size_t last) {
+		simd::gemm(
+			last - first, m2_n, m1_n,
+			m1_buf + first*m1_n, m1_n, m2_buf, m2_n, result_buf + first*m2_n, m2_n);
+	});
 	return result;
 }
 
@@ -130,7 +162,14 @@ template<
 >
 decltype(auto)
 multiply_impl_rtsam_rtsam::operator()(rtsam<Ring,Order1> const& M1, rtsam<Ring,Order2> const& M2) const {
-	return multiply_rtsam_rtsam_impl(M1,M2, hana::type_c<Ring>);
+	if constexpr (
+		Order1 == storage_order::row_major && Order2 == storage_order::row_major &&
+		simd::has_kernels_v<std::decay_t<Ring>>
+	) {
+		return multiply_rtsam_rtsam_row_major_impl(M1,M2);
+	} else {
+		return multiply_rtsam_rtsam_impl(M1,M2, hana::type_c<Ring>);
+	}
 }
 
 template<
@@ -182,12 +221,14 @@ multiply_rtsarv_rtsam_impl(RowVector const& lhs, Matrix const& rhs, hana::basic_
 	BOOST_ASSERT(lhs_sz == rhs_m);
 	
 	rtsarv<Ring> result{rhs_n};
-	for (std::size_t i = 0; i < rhs_n; ++i) {
-		(*at)(result, i) = (*multiply)(
-			lhs,
-			select(rhs, std::make_pair(range<std::size_t,std::size_t>(0u, rhs_m - 1u), i))
-		);
-	}
+	parallel_for(0, rhs_n, grain_size(rhs_n, rhs_m), [&](std::size_t first, std::size_t last) {
+		for (std::size_t i = first; i < last; ++i) {
+			(*at)(result, i) = (*multiply)(
+				lhs,
+				select(rhs, std::make_pair(range<std::size_t,std::size_t>(0u, rhs_m - 1u), i))
+			);
+		}
+	});
 	return result;
 }
 
@@ -226,12 +267,14 @@ multiply_rtsam_rtsacv_impl(Matrix const& lhs, ColumnVector const& rhs, hana::bas
 	BOOST_ASSERT(lhs_n == rhs_sz);
 	
 	rtsacv<Ring> result{lhs_m};
-	for (std::size_t i = 0; i < lhs_m; ++i) {
-		(*at)(result, i) = (*multiply)(
-			select(lhs, std::make_pair(i, range<std::size_t,std::size_t>(0u, lhs_n - 1u))), 
-			rhs
-		);
-	}
+	parallel_for(0, lhs_m, grain_size(lhs_m, lhs_n), [&](std::size_t first, std::size_t last) {
+		for (std::size_t i = first; i < last; ++i) {
+			(*at)(result, i) = (*multiply)(
+				select(lhs, std::make_pair(i, range<std::size_t,std::size_t>(0u, lhs_n - 1u))), 
+				rhs
+			);
+		}
+	});
 	return result;
 }
 
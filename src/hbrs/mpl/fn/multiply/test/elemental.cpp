@@ -0,0 +1,140 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE fn_multiply_elemental_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <hbrs/mpl/config.hpp>
+
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+
+#include <hbrs/mpl/detail/test.hpp>
+
+#include <hbrs/mpl/fn/multiply.hpp>
+
+#include <cmath>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+#define _TOL 0.000000001
+
+BOOST_AUTO_TEST_SUITE(fn_multiply_elemental_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+template<typename Ring>
+static El::Matrix<Ring>
+sample(El::Int m, El::Int n, double shift) {
+	El::Matrix<Ring> a{m, n};
+	for (El::Int j = 0; j < n; ++j) {
+		for (El::Int i = 0; i < m; ++i) {
+			a.Set(i, j, Ring(std::sin(shift + i * n + j)));
+		}
+	}
+	return a;
+}
+
+template<El::Dist Columnwise, El::Dist Rowwise, typename Ring>
+static auto
+distribute(El::Grid const& grid, El::Matrix<Ring> const& a_) {
+	using namespace hbrs::mpl;
+	El::DistMatrix<Ring, Columnwise, Rowwise> a{grid};
+	El::Copy(make_el_dist_matrix(grid, a_).data(), a);
+	return make_el_dist_matrix(std::move(a));
+}
+
+BOOST_AUTO_TEST_CASE(row_distributed_times_replicated, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	
+	// tall-skinny a whose rows are distributed times small b which is replicated on all processes
+	auto a_ = sample<double>(50, 4, 1.);
+	auto b_ = sample<double>(4, 3, 2.);
+	el_matrix<double> c_{0, 0};
+	El::Gemm(El::NORMAL, El::NORMAL, 1., a_, b_, c_.data());
+	
+	auto b = make_el_dist_matrix(grid, b_);
+	HBRS_MPL_TEST_MMEQ((*multiply)(distribute<El::VC, El::STAR>(grid, a_), b), c_, false);
+	HBRS_MPL_TEST_MMEQ((*multiply)(distribute<El::MC, El::STAR>(grid, a_), b), c_, false);
+}
+
+BOOST_AUTO_TEST_CASE(inner_distributed, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	
+	auto a_ = sample<double>(50, 4, 1.);
+	auto b_ = sample<double>(50, 3, 2.);
+	
+	// Gram matrix A'*A of a tall-skinny A
+	el_matrix<double> gram_{0, 0};
+	El::Gemm(El::TRANSPOSE, El::NORMAL, 1., a_, a_, gram_.data());
+	El::Matrix<double> at_;
+	El::Transpose(a_, at_);
+	
+	HBRS_MPL_TEST_MMEQ(
+		(*multiply)(distribute<El::STAR, El::VC>(grid, at_), distribute<El::VC, El::STAR>(grid, a_)), gram_, false);
+	HBRS_MPL_TEST_MMEQ(
+		(*multiply)(distribute<El::STAR, El::MC>(grid, at_), distribute<El::MC, El::STAR>(grid, a_)), gram_, false);
+	
+	// repeated products of the same shape reuse the cached reduction, products of another shape replace it
+	el_matrix<double> c_{0, 0};
+	El::Gemm(El::TRANSPOSE, El::NORMAL, 1., a_, b_, c_.data());
+	HBRS_MPL_TEST_MMEQ(
+		(*multiply)(distribute<El::STAR, El::VC>(grid, at_), distribute<El::VC, El::STAR>(grid, b_)), c_, false);
+	
+	// local rows of b do not match local columns of a unless b is realigned
+	El::DistMatrix<double, El::VC, El::STAR> b_misaligned{grid};
+	b_misaligned.AlignCols(grid.Size() > 1 ? 1 : 0);
+	El::Copy(make_el_dist_matrix(grid, b_).data(), b_misaligned);
+	HBRS_MPL_TEST_MMEQ(
+		(*multiply)(distribute<El::STAR, El::VC>(grid, at_), make_el_dist_matrix(std::move(b_misaligned))), c_, false);
+}
+
+BOOST_AUTO_TEST_CASE(inner_distributed_complex, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	
+	auto a_ = sample<El::Complex<double>>(50, 4, 1.);
+	auto b_ = sample<El::Complex<double>>(50, 3, 2.);
+	for (El::Int j = 0; j < a_.Width(); ++j) {
+		for (El::Int i = 0; i < a_.Height(); ++i) {
+			a_.Set(i, j, a_.Get(i, j) * El::Complex<double>{1., std::cos(1. + i + j)});
+		}
+	}
+	
+	el_matrix<El::Complex<double>> c_{0, 0};
+	El::Gemm(El::ADJOINT, El::NORMAL, El::Complex<double>(1), a_, b_, c_.data());
+	El::Matrix<El::Complex<double>> ah_;
+	El::Adjoint(a_, ah_);
+	
+	auto c = (*multiply)(distribute<El::STAR, El::VC>(grid, ah_), distribute<El::VC, El::STAR>(grid, b_));
+	El::DistMatrix<El::Complex<double>, El::STAR, El::STAR> c_star{c.data()};
+	BOOST_TEST(c_star.Height() == c_.data().Height());
+	BOOST_TEST(c_star.Width() == c_.data().Width());
+	El::Axpy(El::Complex<double>(-1), c_.data(), c_star.Matrix());
+	BOOST_TEST(El::FrobeniusNorm(c_star.Matrix()) < _TOL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
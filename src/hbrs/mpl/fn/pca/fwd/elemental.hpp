@@ -47,6 +47,20 @@ struct pca_impl_el_matrix {
 		el_matrix<Ring> const& a,
 		pca_control<bool,bool,bool> const& ctrl
 	) const;
+	
+	template <
+		typename Ring,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_matrix<Ring> && a,
+		pca_control<bool,bool,bool> const& ctrl
+	) const;
 };
 
 struct pca_impl_el_dist_matrix {
@@ -63,6 +77,20 @@ struct pca_impl_el_dist_matrix {
 		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
 		pca_control<bool,bool,bool> const& ctrl
 	) const;
+	
+	template<
+		typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+		typename std::enable_if_t<
+			!std::is_reference_v<Ring> &&
+			!std::is_const_v<Ring> &&
+			std::is_arithmetic_v<Ring>
+		>* = nullptr
+	>
+	decltype(auto)
+	operator()(
+		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+		pca_control<bool,bool,bool> const& ctrl
+	) const;
 };
 
 #else
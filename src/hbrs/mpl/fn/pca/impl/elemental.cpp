@@ -27,11 +27,21 @@ template decltype(auto) pca_impl_el_matrix::operator()(el_matrix<float> const&,
 template decltype(auto) pca_impl_el_matrix::operator()(el_matrix<double> const&, pca_control<bool,bool,bool> const&) const;
 // template decltype(auto) pca_impl_el_matrix::operator()(el_matrix<El::Complex<double>> const&, pca_control<bool,bool,bool> const&) const;
 
+template decltype(auto) pca_impl_el_matrix::operator()(el_matrix<float> &&, pca_control<bool,bool,bool> const&) const;
+// template decltype(auto) pca_impl_el_matrix::operator()(el_matrix<El::Complex<float>> &&, pca_control<bool,bool,bool> const&) const;
+template decltype(auto) pca_impl_el_matrix::operator()(el_matrix<double> &&, pca_control<bool,bool,bool> const&) const;
+// template decltype(auto) pca_impl_el_matrix::operator()(el_matrix<El::Complex<double>> &&, pca_control<bool,bool,bool> const&) const;
+
 template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<float> const&, pca_control<bool,bool,bool> const&) const;
 // template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>> const&, pca_control<bool,bool,bool> const&) const;
 template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<double> const&, pca_control<bool,bool,bool> const&) const;
 // template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>> const&, pca_control<bool,bool,bool> const&) const;
 
+template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<float> &&, pca_control<bool,bool,bool> const&) const;
+// template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>> &&, pca_control<bool,bool,bool> const&) const;
+template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<double> &&, pca_control<bool,bool,bool> const&) const;
+// template decltype(auto) pca_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>> &&, pca_control<bool,bool,bool> const&) const;
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
@@ -33,9 +33,13 @@
 #include <hbrs/mpl/dt/el_dist_vector.hpp>
 
 #include <hbrs/mpl/detail/mpi.hpp>
-#include <hbrs/mpl/detail/is_nan.hpp>
+#include <hbrs/mpl/detail/async.hpp>
 #include <hbrs/mpl/detail/is_inf.hpp>
 #include <hbrs/mpl/detail/log.hpp>
+#include <hbrs/mpl/detail/reduction.hpp>
+#include <hbrs/mpl/detail/shared_matrix.hpp>
+#include <hbrs/mpl/detail/simd.hpp>
+#include <hbrs/mpl/detail/validation.hpp>
 
 #include <hbrs/mpl/fn/size.hpp>
 #include <hbrs/mpl/fn/m.hpp>
@@ -63,10 +67,12 @@
 #include <hbrs/mpl/fn/select.hpp>
 #include <hbrs/mpl/fn/diag.hpp>
 #include <hbrs/mpl/fn/variance.hpp>
-#include <hbrs/mpl/fn/any_of.hpp>
 
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/hana/functional/id.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <algorithm>
+#include <limits>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
@@ -139,11 +145,29 @@ signum_of_largest_element_in_column(el_matrix<Ring> const& coeff) {
 	return colsign;
 }
 
+template <typename Ring>
+static auto
+start_signum_of_largest_element_in_column(el_matrix<Ring> const& coeff) {
+	// Returns a future of a row vector that contains signs of largest element in each column
+	return mpi::make_ready_future(signum_of_largest_element_in_column(coeff));
+}
+
+/* Absolute value, row and sign of the largest element in a column, reduced with arg_max */
+template<typename Ring>
+struct column_maximum {
+	BOOST_HANA_DEFINE_STRUCT(column_maximum,
+		(Ring, value),
+		(long long, index),
+		(Ring, sign)
+	);
+};
+
 //TODO: Replace datatype-specific code with calls to generic API functions
 template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
 static auto
-signum_of_largest_element_in_column(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& coeff) {
-	// Returns a row vector that contains signs of largest element in each column
+start_signum_of_largest_element_in_column(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& coeff) {
+	// Returns a future of a row vector that contains signs of largest element in each column,
+	// the reduction across processes is in flight until the future is resolved with get()
 	
 	typedef std::decay_t<Ring> _Ring_;
 	
@@ -154,11 +178,22 @@ signum_of_largest_element_in_column(el_dist_matrix<Ring, Columnwise, Rowwise, Wr
 	auto coeff_sz = (*size)(coeff);
 	auto coeff_n = (*n)(coeff_sz);
 	
-	// find largest element in each local column
-	std::vector<mpi::pair<_Ring_,int>> abs_maxima_and_signs(
+	// find largest element in each local column, the row index breaks ties like MATLAB's max() does
+	// buffer and plan of the reduction are kept for the next pca() of data with the same number of columns, e.g. the
+	// next batch of a stream, hence the future has to be resolved before this function is called again on this thread
+	static thread_local mpi::allreduce_buffer<column_maximum<_Ring_>> reduction;
+	column_maximum<_Ring_> * maxima = reduction.bind(
 		boost::numeric_cast<std::size_t>(coeff_n),
-		{
+		mpi::datatype(hana::type_c<column_maximum<_Ring_>>),
+		mpi::op(hana::type_c<column_maximum<_Ring_>>, arg_max{}),
+		MPI_COMM_WORLD
+	);
+	std::fill_n(
+		maxima,
+		coeff_n,
+		column_maximum<_Ring_>{
 			std::numeric_limits<_Ring_>::lowest() /* largest element per column */,
+			std::numeric_limits<long long>::max() /* row of largest element in a column */,
 			(*signum)(std::numeric_limits<_Ring_>::lowest()) /* sigmum of largest element in a column */
 		}
 	);
@@ -169,47 +204,61 @@ signum_of_largest_element_in_column(el_dist_matrix<Ring, Columnwise, Rowwise, Wr
 	
 	EL_PARALLEL_FOR
 	for(El::Int j = 0; j < coeff_lcl.Width(); ++j) {
+		if constexpr (simd::has_kernels_v<_Ring_>) {
+			// each global column is stored in at most one local column, so its first largest element is the result
+			std::size_t const coeff_lcl_m = boost::numeric_cast<std::size_t>(coeff_lcl.Height());
+			std::size_t const i = simd::index_of_abs_max(coeff_lcl_buf + j*coeff_lcl_ldim, coeff_lcl_m);
+			if (i < coeff_lcl_m) {
+				_Ring_ const value = coeff_lcl_buf[i+j*coeff_lcl_ldim];
+				BOOST_ASSERT(coeff.data().GlobalCol(j) < coeff_n);
+				column_maximum<_Ring_> & abs_max = maxima[coeff.data().GlobalCol(j)];
+				abs_max.value = (*absolute)(value);
+				abs_max.index = coeff.data().GlobalRow(boost::numeric_cast<El::Int>(i));
+				abs_max.sign = (*signum)(value);
+			}
+			continue;
+		}
+		
 		EL_SIMD
 		for(El::Int i = 0; i < coeff_lcl.Height(); ++i) {
 			std::size_t coeff_lcl_offset = i+j*coeff_lcl_ldim;
 			BOOST_ASSERT(coeff_lcl_offset < coeff_lcl.Width() * coeff_lcl.Height());
 			_Ring_ abs_max_maybe = (*absolute)(coeff_lcl_buf[coeff_lcl_offset]);
-			mpi::pair<_Ring_,int> & abs_max_now = abs_maxima_and_signs.at(coeff.data().GlobalCol(j));
+			BOOST_ASSERT(coeff.data().GlobalCol(j) < coeff_n);
+			column_maximum<_Ring_> & abs_max_now = maxima[coeff.data().GlobalCol(j)];
 			
-			if ( (*less)( abs_max_now.first, abs_max_maybe) ) {
-				abs_max_now.first = abs_max_maybe;
-				abs_max_now.second = (*signum)(coeff_lcl_buf[coeff_lcl_offset]);
+			if ( (*less)( abs_max_now.value, abs_max_maybe) ) {
+				abs_max_now.value = abs_max_maybe;
+				abs_max_now.index = coeff.data().GlobalRow(i);
+				abs_max_now.sign = (*signum)(coeff_lcl_buf[coeff_lcl_offset]);
 			}
 		}
 	}
 	
 	// find largest element in each global column
-	mpi::allreduce(
-		MPI_IN_PLACE,
-		abs_maxima_and_signs.data(),
-		abs_maxima_and_signs.size(),
-		mpi::datatype(hana::type_c<mpi::pair<_Ring_,int>>),
-		MPI_MAXLOC,
-		MPI_COMM_WORLD
-	);
-	
-	// store signs in el_dist_row_vector
-	el_dist_row_vector<_Ring_, El::STAR, El::STAR, El::ELEMENT> colsign{coeff.data().Grid(), coeff_n};
-	
-	El::Matrix<_Ring_> & colsign_lcl = colsign.data().Matrix();
-	El::Int colsign_lcl_ldim = colsign_lcl.LDim();
-	auto colsign_lcl_buf = colsign_lcl.Buffer();
-	
-	EL_SIMD
-	for(El::Int j = 0; j < colsign_lcl.Width(); ++j) {
-		std::size_t colsign_lcl_offset = j*colsign_lcl_ldim;
-		BOOST_ASSERT(colsign_lcl_offset < colsign_lcl.Width() * colsign_lcl.Height());
-		
-		mpi::pair<_Ring_,int> & abs_maximum_and_sign = abs_maxima_and_signs.at(colsign.data().GlobalCol(j));
-		colsign_lcl_buf[colsign_lcl_offset] = abs_maximum_and_sign.second;
-	}
-	
-	return colsign;
+	El::Grid const& grid = coeff.data().Grid();
+	typedef el_dist_row_vector<_Ring_, El::STAR, El::STAR, El::ELEMENT> colsign_t;
+	return mpi::future<colsign_t>{
+		reduction.plan().start(),
+		[&grid, coeff_n, maxima]() {
+			// store signs in el_dist_row_vector
+			colsign_t colsign{grid, coeff_n};
+			
+			El::Matrix<_Ring_> & colsign_lcl = colsign.data().Matrix();
+			El::Int colsign_lcl_ldim = colsign_lcl.LDim();
+			auto colsign_lcl_buf = colsign_lcl.Buffer();
+			
+			EL_SIMD
+			for(El::Int j = 0; j < colsign_lcl.Width(); ++j) {
+				std::size_t colsign_lcl_offset = j*colsign_lcl_ldim;
+				BOOST_ASSERT(colsign_lcl_offset < colsign_lcl.Width() * colsign_lcl.Height());
+				
+				colsign_lcl_buf[colsign_lcl_offset] = maxima[colsign.data().GlobalCol(j)].sign;
+			}
+			
+			return colsign;
+		}
+	};
 }
 
 //TODO: Replace this helper function with generic code
@@ -296,6 +345,44 @@ make_matrix_like(
 	return el_dist_matrix<_Ring_, Columnwise, Rowwise, Wrapping>{a.data().Grid(), HBRS_MPL_FWD(sz).m(), HBRS_MPL_FWD(sz).n()};
 }
 
+/* Sets each row of a to the 1 x n row vector mu, e.g. to initialize a matrix with the mean */
+template<typename Ring>
+static void
+fill_rows(El::Matrix<Ring> & a, El::Matrix<Ring> const& mu) {
+	BOOST_ASSERT(mu.Height() == 1 && mu.Width() == a.Width());
+	El::Int const a_m = a.Height();
+	El::Int const a_ldim = a.LDim();
+	Ring * a_buf = a.Buffer();
+	
+	EL_PARALLEL_FOR
+	for(El::Int j = 0; j < a.Width(); ++j) {
+		std::fill_n(a_buf + j*a_ldim, a_m, mu.Get(0, j));
+	}
+}
+
+/* mu is replicated, i.e. each process holds all n entries */
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static void
+fill_rows(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> & a, El::Matrix<Ring> const& mu) {
+	BOOST_ASSERT(mu.Height() == 1 && mu.Width() == a.Width());
+	El::Matrix<Ring> & a_lcl = a.Matrix();
+	El::Int const a_lcl_m = a_lcl.Height();
+	El::Int const a_lcl_ldim = a_lcl.LDim();
+	Ring * a_lcl_buf = a_lcl.Buffer();
+	
+	EL_PARALLEL_FOR
+	for(El::Int j = 0; j < a_lcl.Width(); ++j) {
+		std::fill_n(a_lcl_buf + j*a_lcl_ldim, a_lcl_m, mu.Get(0, a.GlobalCol(j)));
+	}
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static void
+fill_rows(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> & a, El::AbstractDistMatrix<Ring> const& mu) {
+	shared_matrix<Ring> mu_rep{mu};
+	fill_rows(a, mu_rep.data());
+}
+
 //TODO: Move code to dedicated global function
 struct square_t {
 	template<typename Ring>
@@ -346,19 +433,20 @@ replace_if(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> & a, Predicate pr
 
 //TODO: Turn this code into a dedicated, generic pca() implementation
 /* C++ code is equivalent to MATLAB code in file src/hbrs/mpl/detail/matlab_cxn/impl/pca_level2.m */
+/* Passing a as an rvalue allows pca() to center, normalize and decompose its storage in-place instead of copying it. */
 template <typename Matrix, typename Control>
 static auto
 pca(
-	Matrix const& a,
+	Matrix && a,
 	Control const& ctrl
 ) {
+	typedef std::decay_t<Matrix> _Matrix_;
 	HBRS_MPL_LOG_TRIVIAL(debug) << "pca:elemental:begin";
 	HBRS_MPL_LOG_TRIVIAL(trace) << "A:" << loggable{a};
 	
 	//TODO: Handle complex values
 	using namespace hana::literals;
-	BOOST_ASSERT(any_of(a, is_nan) == false);
-	BOOST_ASSERT(any_of(a, is_inf) == false);
+	validate_finite(validation_level::input, a);
 	
 	auto const a_sz = (*size)(a);
 	auto const a_m = (*m)(a_sz);
@@ -378,7 +466,7 @@ pca(
 	 * replace all inf's in vw with 1's and thus "skipping" normalization.
 	 */
 	replace_if(vw.data(), is_inf, 1);
-	BOOST_ASSERT(any_of(vw, is_inf) == false);
+	validate_finite(validation_level::all, vw);
 	//MATLAB>> if Normalize
 	//MATLAB>>     vVariableWeights = 1./var(x,0);
 	//MATLAB>>     % code equals:
@@ -400,8 +488,9 @@ pca(
 	
 	HBRS_MPL_LOG_TRIVIAL(debug) << "pca:elemental:center";
 	//TODO: Is centering really necessary or is the first principal component equivalent to mean?
-	auto cntr = ctrl.center() ? (*minus)(a, (*expand)(mu, a_sz)) : a;
-	BOOST_ASSERT(any_of(cntr, is_nan) == false);
+	auto cntr = ctrl.center() ? (*minus)(HBRS_MPL_FWD(a), (*expand)(mu, a_sz)) : _Matrix_(HBRS_MPL_FWD(a));
+	// a might have been moved from, do not access it below
+	validate_finite(validation_level::all, cntr);
 	//MATLAB>> if Center
 	//MATLAB>>     x = bsxfun(@minus,x,mu);
 	//MATLAB>> end
@@ -411,13 +500,13 @@ pca(
 	auto sqrt = [](auto x) { return power(x, 1./2.); };
 	auto phi_sqrt = transform(vw, sqrt);
 	auto && stdz = ctrl.normalize() ? (*times)(std::move(cntr), expand(phi_sqrt, a_sz)) : std::move(cntr);
-	BOOST_ASSERT(any_of(stdz, is_nan) == false);
+	validate_finite(validation_level::all, stdz);
 	//MATLAB>> PhiSqrt = sqrt(vVariableWeights);
 	//MATLAB>> if Normalize
 	//MATLAB>>     x = bsxfun(@times, x, PhiSqrt);
 	//MATLAB>> end
 	
-	auto usv = (*svd)(stdz, ctrl.economy() ? decompose_mode::economy : decompose_mode::zero);
+	auto usv = (*svd)(std::move(stdz), ctrl.economy() ? decompose_mode::economy : decompose_mode::zero);
 	auto && U = (*at)(usv, svd_u{});
 	//TODO: Make this work for Ring is El::Complex<...>
 	auto && S = (*at)(usv, svd_s{});
@@ -438,6 +527,26 @@ pca(
 	//MATLAB>>     coeff = bsxfun(@times, coeff, 1./PhiSqrt');
 	//MATLAB>> end
 	
+	if (DOF < a_n && ctrl.economy()) {
+		// When 'economy' value is true, nothing corresponding to zero eigenvalues should be returned.
+		
+		// TODO: more generic code is e.g.: coeff[make_range(range::begin,range::end)][make_range(DOF+1_c,range::end)] = [];
+		coeff = (*select)(
+			std::move(coeff),
+			std::make_pair(El::ALL, El::IR(0, DOF))
+		);
+		BOOST_ASSERT((*equal)(size(coeff), make_matrix_size(a_n, DOF)));
+	}
+	//MATLAB>> if DOF < n && Economy
+	//MATLAB>> 	coeff(:, DOF+1:end) = [];
+	//MATLAB>> end
+	
+	HBRS_MPL_LOG_TRIVIAL(debug) << "pca:elemental:sign";
+	// Enforce a sign convention on the coefficients -- the largest element in
+	// each column will have a positive sign. coeff is final at this point, so
+	// the reduction of the signs overlaps with the computation of score and latent.
+	auto colsign_future = start_signum_of_largest_element_in_column(coeff);
+	
 	auto Sd = (*diag)(S);
 	auto score = (*multiply)(std::move(U),std::move(S));
 	//MATLAB>> S = diag(S);
@@ -452,13 +561,6 @@ pca(
 		if (ctrl.economy()) {
 			// When 'economy' value is true, nothing corresponding to zero eigenvalues should be returned.
 			
-			// TODO: more generic code is e.g.: coeff[make_range(range::begin,range::end)][make_range(DOF+1_c,range::end)] = [];
-			coeff = (*select)(
-				std::move(coeff),
-				std::make_pair(El::ALL, El::IR(0, DOF))
-			);
-			BOOST_ASSERT((*equal)(size(coeff), make_matrix_size(a_n, DOF)));
-			
 			// TODO: more generic code is e.g.: score[make_range(range::begin,range::end)][make_range(DOF+1_c,range::end)] = [];
 			score = (*select)(
 				std::move(score),
@@ -477,14 +579,14 @@ pca(
 			// columns of U corresponding to components of (DOF+1):p.
 			
 			// TODO: more generic code is e.g.: score[make_range(range::begin,range::end)][make_range(DOF+1_c,a_n)] = 0;
-			auto score_ = make_matrix_like(a, a_sz);
+			auto score_ = make_matrix_like(score, a_sz);
 			auto score_view = score_.data()(El::ALL, El::IR(0,DOF));
 			El::Copy(score.data()(El::ALL, El::IR(0,DOF)), score_view);
 			score = std::move(score_);
 			BOOST_ASSERT((*equal)(size(score), a_sz));
 			
 			// TODO: more generic code is e.g.: latent[make_range(DOF+1_c,a_n)][1_c] = 0;
-			auto latent_ = make_column_vector_like(a, a_n);
+			auto latent_ = make_column_vector_like(score, a_n);
 			auto latent_view = latent_.data()(El::IR(0,DOF), 0);
 			El::Copy(latent.data()(El::IR(0,DOF), 0), latent_view);
 			latent = std::move(latent_);
@@ -495,7 +597,6 @@ pca(
 	//MATLAB>> 	if Economy
 	//MATLAB>> 		% When 'Economy' value is true, nothing corresponding to zero
 	//MATLAB>> 		% eigenvalues should be returned.
-	//MATLAB>> 		coeff(:, DOF+1:end) = [];
 	//MATLAB>> 		score(:, DOF+1:end)= [];
 	//MATLAB>> 		latent(DOF+1:end, :)= [];
 	//MATLAB>> 	else
@@ -507,10 +608,7 @@ pca(
 	//MATLAB>> 	end
 	//MATLAB>> end
 	
-	HBRS_MPL_LOG_TRIVIAL(debug) << "pca:elemental:sign";
-	// Enforce a sign convention on the coefficients -- the largest element in
-	// each column will have a positive sign.
-	auto colsign = signum_of_largest_element_in_column(coeff);
+	auto colsign = colsign_future.get();
 	HBRS_MPL_LOG_TRIVIAL(debug) << "pca:elemental:sign:change";
 	auto coeff_sgn = (*times)(std::move(coeff), expand(colsign, size(coeff)));
 	auto score_sgn = (*times)(std::move(score), expand(colsign, size(score)));
@@ -525,7 +623,7 @@ pca(
 	HBRS_MPL_LOG_TRIVIAL(trace) << "mu:" << loggable{mu};
 	HBRS_MPL_LOG_TRIVIAL(debug) << "pca:elemental:end";
 	
-	return make_pca_result(coeff_sgn, score_sgn, latent, mu);
+	return make_pca_result(std::move(coeff_sgn), std::move(score_sgn), std::move(latent), std::move(mu));
 }
 
 /* namespace pca_impl_el */ }
@@ -548,6 +646,24 @@ pca_impl_el_matrix::operator()(
 	return pca_impl_el::pca(a, ctrl);
 }
 
+template <
+	typename Ring,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+pca_impl_el_matrix::operator()(
+	el_matrix<Ring> && a,
+	pca_control<bool,bool,bool> const& ctrl
+) const {
+	typedef std::decay_t<Ring> _Ring_;
+	static_assert(std::is_same<_Ring_, El::Base<_Ring_>>::value, "because S is returned as El::Base<_Ring_>");
+	return pca_impl_el::pca(std::move(a), ctrl);
+}
+
 template<
 	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
 	typename std::enable_if_t<
@@ -566,6 +682,24 @@ pca_impl_el_dist_matrix::operator()(
 	return pca_impl_el::pca(a, ctrl);
 }
 
+template<
+	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+	typename std::enable_if_t<
+		!std::is_reference_v<Ring> &&
+		!std::is_const_v<Ring> &&
+		std::is_arithmetic_v<Ring>
+	>*
+>
+decltype(auto)
+pca_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+	pca_control<bool,bool,bool> const& ctrl
+) const {
+	typedef std::decay_t<Ring> _Ring_;
+	static_assert(std::is_same<_Ring_, El::Base<_Ring_>>::value, "because S is returned as El::Base<_Ring_>");
+	return pca_impl_el::pca(std::move(a), ctrl);
+}
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
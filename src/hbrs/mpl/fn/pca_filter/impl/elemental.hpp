@@ -33,11 +33,7 @@
 #include <hbrs/mpl/fn/size.hpp>
 #include <hbrs/mpl/fn/m.hpp>
 #include <hbrs/mpl/fn/n.hpp>
-#include <hbrs/mpl/fn/multiply.hpp>
-#include <hbrs/mpl/fn/transpose.hpp>
-#include <hbrs/mpl/fn/plus.hpp>
 #include <hbrs/mpl/fn/equal.hpp>
-#include <hbrs/mpl/fn/expand.hpp>
 
 #include <hbrs/mpl/detail/log.hpp>
 
@@ -82,20 +78,38 @@ pca_filter_impl_el_matrix::operator()(
 	
 	BOOST_ASSERT((*equal)(size(latent), latent_sz));
 	
+	typedef std::decay_t<decltype(score.data().Get(0,0))> _Ring_;
+	
 	// size(keep) <= n(size(score))
-	for (El::Int i = 0; i < (*n)(size(score)); ++i) {
-		if ((i >= keep_sz) || (keep(i) == false)) {
-			auto column = score.data()(El::ALL, i);
-			El::Zero(column);
+	std::vector<El::Int> kept;
+	for (El::Int i = 0; i < std::min<El::Int>(keep_sz, (*n)(size(score))); ++i) {
+		if (keep(i)) {
+			kept.push_back(i);
 		}
 	}
+	El::Int const k = boost::numeric_cast<El::Int>(kept.size());
+	bool const is_prefix = kept.empty() || kept.back() == k-1;
+	
+	/* The filtered data is initialized with the mean (or zeros) and the kept components are added with a single
+	 * rank-k update, i.e. data = mean + score(:,kept) * coeff(:,kept)' which avoids zeroing discarded columns of
+	 * score, an explicit transpose of coeff and a m-by-n multiplication with mostly zero columns.
+	 */
+	auto data = pca_impl_el::make_matrix_like(score, a_sz);
+	if (ctrl.pca_control().center() && !ctrl.keep_centered()) {
+		pca_impl_el::fill_rows(data.data(), mean.data());
+	}
 	
-	auto centered = (*multiply)(score, transpose(coeff));
-	BOOST_ASSERT((*equal)(a_sz, size(centered)));
+	auto reconstruct = [&data](auto const& score_k, auto const& coeff_k) {
+		El::Gemm(El::NORMAL, El::TRANSPOSE, _Ring_(1), score_k, coeff_k, _Ring_(1), data.data());
+	};
 	
-	auto data = ctrl.pca_control().center() && !ctrl.keep_centered()
-		? (*plus)(centered, expand(mean, size(centered)))
-		: std::move(centered);
+	if (k > 0 && is_prefix) {
+		// leading components are used in-place
+		reconstruct(score.data()(El::ALL, El::IR(0, k)), coeff.data()(El::ALL, El::IR(0, k)));
+	} else if (k > 0) {
+		// kept components are gathered into compact m-by-k and n-by-k panels
+		reconstruct(score.data()(El::ALL, kept), coeff.data()(El::ALL, kept));
+	}
 	BOOST_ASSERT((*equal)(size(data), a_sz));
 	
 	HBRS_MPL_LOG_TRIVIAL(trace) << "data:" << loggable{data};
@@ -40,6 +40,7 @@
 #include <hbrs/mpl/dt/pca_filter_control.hpp>
 
 #include <hbrs/mpl/fn/pca_filter.hpp>
+#include <hbrs/mpl/fn/pca.hpp>
 #include <hbrs/mpl/fn/at.hpp>
 #include <hbrs/mpl/fn/plus.hpp>
 #include <hbrs/mpl/fn/multiply.hpp>
@@ -70,6 +71,9 @@
 #include <boost/hana/length.hpp>
 #include <boost/hana/min.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace utf = boost::unit_test;
 namespace tt = boost::test_tools;
 
@@ -299,4 +303,60 @@ BOOST_AUTO_TEST_CASE(pca_filter_comparison,  * utf::tolerance(_TOL)) {
 	});
 }
 
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+BOOST_AUTO_TEST_CASE(pca_filter_masks,  * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	
+	static constexpr auto dataset = make_sm(
+		make_ctsav(detail::mat_o), make_matrix_size(hana::size_c<detail::mat_o_m>, hana::size_c<detail::mat_o_n>), row_major_c
+	);
+	// DOF >= n with and without centering, so filters have min(m,n) entries
+	std::size_t const components = std::min(detail::mat_o_m, detail::mat_o_n);
+	
+	// mixed mask, which gathers non-adjacent components, and partial prefix, which keeps leading components only
+	std::vector<bool> mixed(components, false);
+	std::vector<bool> prefix(components, false);
+	for (std::size_t i = 0; i < components; ++i) {
+		mixed[i] = (i % 3 != 1);
+		prefix[i] = (i < components / 2);
+	}
+	
+	auto check = [&](auto const& a, std::vector<bool> const& filter, bool center, bool keep_centered) {
+		pca_control<bool,bool,bool> const pca_ctrl{true, center, false};
+		auto const rslt = detail::pca_filter_impl_el_matrix{}(
+			a, filter, pca_filter_control<pca_control<bool,bool,bool>, bool>{pca_ctrl, keep_centered});
+		
+		// data = score * coeff' with discarded columns of score set to zero, plus mean if it has not been kept
+		auto const pca_rslt = (*pca)(a, pca_ctrl);
+		auto score = (*at)(pca_rslt, pca_score{});
+		for (std::size_t i = 0; i < filter.size(); ++i) {
+			if (!filter[i]) {
+				auto col = score.data()(El::ALL, El::IR((El::Int)i));
+				El::Zero(col);
+			}
+		}
+		
+		auto const expected = (*multiply)(score, (*transpose)((*at)(pca_rslt, pca_coeff{})));
+		if (center && !keep_centered) {
+			auto const mean_ = (*expand)(mean(columns(a)), size(a));
+			HBRS_MPL_TEST_MMEQ((*plus)(expected, mean_), (*at)(rslt, pca_filter_data{}), false);
+		} else {
+			HBRS_MPL_TEST_MMEQ(expected, (*at)(rslt, pca_filter_data{}), false);
+		}
+	};
+	
+	for (auto const& filter : { mixed, prefix }) {
+		for (bool center : { true, false }) {
+			for (bool keep_centered : { true, false }) {
+				BOOST_TEST_MESSAGE("center=" << center << " keep_centered=" << keep_centered);
+				check(make_el_matrix(dataset), filter, center, keep_centered);
+				check(make_el_dist_matrix(grid, make_el_matrix(dataset)), filter, center, keep_centered);
+			}
+		}
+	}
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,47 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "elemental.hpp"
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+
+#include <utility>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+#define _PCA_RESULT(matrix) std::decay_t<decltype(                                                                     \
+		pca_impl_el_matrix{}(std::declval<matrix const&>(), std::declval<pca_control<bool,bool,bool> const&>())        \
+	)>
+#define _PCA_DIST_RESULT(matrix) std::decay_t<decltype(                                                                \
+		pca_impl_el_dist_matrix{}(std::declval<matrix const&>(), std::declval<pca_control<bool,bool,bool> const&>())   \
+	)>
+#define _PCA_TRANSFORM_CONTROL pca_transform_control<pca_control<bool,bool,bool>, El::Int, El::Int>
+
+template auto pca_transform_impl_el_matrix::operator()(el_matrix<float> const&, _PCA_RESULT(el_matrix<float>) const&, _PCA_TRANSFORM_CONTROL const&) const;
+template auto pca_transform_impl_el_matrix::operator()(el_matrix<double> const&, _PCA_RESULT(el_matrix<double>) const&, _PCA_TRANSFORM_CONTROL const&) const;
+
+template auto pca_transform_impl_el_dist_matrix::operator()(el_dist_matrix<float> const&, _PCA_DIST_RESULT(el_dist_matrix<float>) const&, _PCA_TRANSFORM_CONTROL const&) const;
+template auto pca_transform_impl_el_dist_matrix::operator()(el_dist_matrix<double> const&, _PCA_DIST_RESULT(el_dist_matrix<double>) const&, _PCA_TRANSFORM_CONTROL const&) const;
+
+#undef _PCA_TRANSFORM_CONTROL
+#undef _PCA_DIST_RESULT
+#undef _PCA_RESULT
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
@@ -0,0 +1,256 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_FN_PCA_TRANSFORM_IMPL_ELEMENTAL_HPP
+#define HBRS_MPL_FN_PCA_TRANSFORM_IMPL_ELEMENTAL_HPP
+
+#include "../fwd/elemental.hpp"
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_vector.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_vector.hpp>
+#include <hbrs/mpl/dt/matrix_size.hpp>
+#include <hbrs/mpl/dt/pca_control.hpp>
+#include <hbrs/mpl/dt/pca_result.hpp>
+#include <hbrs/mpl/dt/pca_transform_control.hpp>
+#include <hbrs/mpl/dt/exception.hpp>
+
+#include <hbrs/mpl/fn/pca.hpp>
+#include <hbrs/mpl/fn/at.hpp>
+#include <hbrs/mpl/fn/size.hpp>
+#include <hbrs/mpl/fn/m.hpp>
+#include <hbrs/mpl/fn/n.hpp>
+
+#include <hbrs/mpl/detail/log.hpp>
+#include <hbrs/mpl/detail/tall_skinny.hpp>
+
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <utility>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+namespace detail {
+namespace pca_transform_impl_el {
+
+template<typename Ring>
+static El::Matrix<Ring> const&
+to_local(El::Matrix<Ring> const& a) {
+	return a;
+}
+
+/* Returns a copy of a which holds all entries on each process */
+template<typename Ring>
+static El::Matrix<Ring>
+to_local(El::AbstractDistMatrix<Ring> const& a) {
+	El::DistMatrix<Ring, El::STAR, El::STAR> a_rep{a};
+	return a_rep.LockedMatrix();
+}
+
+/*
+ * Returns n-by-k weights w and a 1-by-k offset c such that the scores of new data x are x*w+c.
+ *
+ * pca() multiplies the centered data with phi_sqrt = sqrt(1./var(x)) before the svd and returns coeff = V./phi_sqrt',
+ * hence score = (x-mu)*V.*phi_sqrt' = (x-mu)*diag(phi)*coeff. var(x) itself is not part of a pca_result, but because of
+ * x-mu = score*coeff' and score'*score = diag(latent)*DOF it follows var(x)_j = sum_l coeff(j,l)^2 * latent(l) if the
+ * data has been centered, i.e. DOF=m-1.
+ */
+template<typename Ring>
+static std::pair<El::Matrix<Ring>, El::Matrix<Ring>>
+projection(
+	El::Matrix<Ring> const& coeff,
+	El::Matrix<Ring> const& latent,
+	El::Matrix<Ring> const& mean,
+	El::Int k,
+	pca_control<bool,bool,bool> const& ctrl
+) {
+	El::Int const n = coeff.Height();
+	
+	El::Matrix<Ring> w;
+	El::Copy(coeff(El::ALL, El::IR(0, k)), w);
+	
+	if (ctrl.normalize()) {
+		if (!ctrl.center()) {
+			BOOST_THROW_EXCEPTION(not_supported_exception{});
+		}
+		
+		El::Int const l_sz = std::min(coeff.Width(), latent.Height());
+		for(El::Int j = 0; j < n; ++j) {
+			Ring var = 0;
+			for(El::Int l = 0; l < l_sz; ++l) {
+				var += coeff.Get(j, l) * coeff.Get(j, l) * latent.Get(l, 0);
+			}
+			
+			// pca() replaces inf's of 1/var(x) with 1's, see there
+			Ring const phi = var == Ring(0) ? Ring(1) : Ring(1)/var;
+			for(El::Int l = 0; l < k; ++l) {
+				w.Set(j, l, phi * w.Get(j, l));
+			}
+		}
+	}
+	
+	El::Matrix<Ring> c;
+	El::Zeros(c, 1, k);
+	if (ctrl.center()) {
+		El::Gemm(El::NORMAL, El::NORMAL, Ring(-1), mean, w, Ring(0), c);
+	}
+	
+	return { std::move(w), std::move(c) };
+}
+
+/* Computes score = a*w+c for at most batch_size rows at once, the offset c is written before the Gemm adds a*w */
+template<typename Ring>
+static void
+project(
+	El::Matrix<Ring> const& a,
+	El::Matrix<Ring> const& w,
+	El::Matrix<Ring> const& c,
+	El::Int batch_size,
+	El::Matrix<Ring> & score
+) {
+	El::Int const a_m = a.Height();
+	for(El::Int i = 0; i < a_m; i += batch_size) {
+		El::Int const i_end = std::min(a_m, i + batch_size);
+		auto a_batch = a(El::IR(i, i_end), El::ALL);
+		auto score_batch = score(El::IR(i, i_end), El::ALL);
+		pca_impl_el::fill_rows(score_batch, c);
+		El::Gemm(El::NORMAL, El::NORMAL, Ring(1), a_batch, w, Ring(1), score_batch);
+	}
+}
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static void
+project(
+	El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+	El::Matrix<Ring> const& w,
+	El::Matrix<Ring> const& c,
+	El::Int batch_size,
+	El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> & score
+) {
+	// w is small (n-by-k) and replicated, hence each process applies it to complete rows of a without communication.
+	// Other distributions than e.g. [VC,STAR] hold partial rows only, so each batch is redistributed to [VC,STAR] and
+	// its scores are redistributed back afterwards.
+	if constexpr (is_row_distributed_v<Columnwise, Rowwise>) {
+		if (score.ColAlign() != a.ColAlign()) {
+			// local rows of a and score have to refer to the same global rows, entries of score are overwritten anyway
+			El::Int const score_n = score.Width();
+			score.Empty();
+			score.AlignWith(a.DistData());
+			score.Resize(a.Height(), score_n);
+		}
+	}
+	
+	El::Int const a_m = a.Height();
+	for(El::Int i = 0; i < a_m; i += batch_size) {
+		El::Int const i_end = std::min(a_m, i + batch_size);
+		auto a_batch = a(El::IR(i, i_end), El::ALL);
+		auto score_batch = score(El::IR(i, i_end), El::ALL);
+		
+		if constexpr (is_row_distributed_v<Columnwise, Rowwise>) {
+			pca_impl_el::fill_rows(score_batch, c);
+			El::Gemm(El::NORMAL, El::NORMAL, Ring(1), a_batch.LockedMatrix(), w, Ring(1), score_batch.Matrix());
+		} else {
+			El::DistMatrix<Ring, El::VC, El::STAR> a_rows{a.Grid()};
+			El::Copy(a_batch, a_rows);
+			
+			El::DistMatrix<Ring, El::VC, El::STAR> score_rows{a.Grid()};
+			score_rows.AlignWith(a_rows.DistData());
+			score_rows.Resize(a_rows.Height(), w.Width());
+			pca_impl_el::fill_rows(score_rows, c);
+			El::Gemm(El::NORMAL, El::NORMAL, Ring(1), a_rows.LockedMatrix(), w, Ring(1), score_rows.Matrix());
+			El::Copy(score_rows, score_batch);
+		}
+	}
+}
+
+template<typename Matrix, typename PCAResult, typename Components, typename BatchSize>
+static auto
+pca_transform(
+	Matrix const& a,
+	PCAResult const& rslt,
+	pca_transform_control<pca_control<bool,bool,bool>, Components, BatchSize> const& ctrl
+) {
+	HBRS_MPL_LOG_TRIVIAL(debug) << "pca_transform:elemental:begin";
+	
+	decltype(auto) coeff  =  (*at)(rslt, pca_coeff{});
+	decltype(auto) latent = (*at)(rslt, pca_latent{});
+	decltype(auto) mean   =   (*at)(rslt, pca_mean{});
+	
+	auto const a_sz = (*size)(a);
+	auto const a_m = (*m)(a_sz);
+	auto const a_n = (*n)(a_sz);
+	if (a_n != (*m)(size(coeff))) {
+		BOOST_THROW_EXCEPTION(incompatible_matrix_exception{} << errinfo_matrix_size{a_sz});
+	}
+	
+	El::Int const k = boost::numeric_cast<El::Int>(ctrl.components());
+	BOOST_ASSERT(k >= 0 && k <= (*n)(size(coeff)));
+	El::Int const batch_size = ctrl.batch_size() > 0 ? boost::numeric_cast<El::Int>(ctrl.batch_size()) : std::max<El::Int>(a_m, 1);
+	
+	decltype(auto) coeff_lcl  = to_local(coeff.data());
+	decltype(auto) latent_lcl = to_local(latent.data());
+	decltype(auto) mean_lcl   = to_local(mean.data());
+	auto wc = projection(coeff_lcl, latent_lcl, mean_lcl, k, ctrl.pca_control());
+	
+	auto score = pca_impl_el::make_matrix_like(a, make_matrix_size(a_m, k));
+	project(a.data(), wc.first, wc.second, batch_size, score.data());
+	
+	HBRS_MPL_LOG_TRIVIAL(trace) << "score:" << loggable{score};
+	HBRS_MPL_LOG_TRIVIAL(debug) << "pca_transform:elemental:end";
+	return score;
+}
+
+/* namespace pca_transform_impl_el */ }
+
+template <
+	typename Ring,
+	typename Coeff, typename Score, typename Latent, typename Mean,
+	typename Components, typename BatchSize
+>
+auto
+pca_transform_impl_el_matrix::operator()(
+	el_matrix<Ring> const& a,
+	pca_result<Coeff, Score, Latent, Mean> const& rslt,
+	pca_transform_control<pca_control<bool,bool,bool>, Components, BatchSize> const& ctrl
+) const {
+	return pca_transform_impl_el::pca_transform(a, rslt, ctrl);
+}
+
+template <
+	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+	typename Coeff, typename Score, typename Latent, typename Mean,
+	typename Components, typename BatchSize
+>
+auto
+pca_transform_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+	pca_result<Coeff, Score, Latent, Mean> const& rslt,
+	pca_transform_control<pca_control<bool,bool,bool>, Components, BatchSize> const& ctrl
+) const {
+	return pca_transform_impl_el::pca_transform(a, rslt, ctrl);
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+#endif // !HBRS_MPL_FN_PCA_TRANSFORM_IMPL_ELEMENTAL_HPP
@@ -0,0 +1,104 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE fn_pca_transform_elemental_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <hbrs/mpl/config.hpp>
+
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+
+#include <hbrs/mpl/detail/test.hpp>
+
+#include <hbrs/mpl/dt/ctsam.hpp>
+#include <hbrs/mpl/dt/storage_order.hpp>
+#include <hbrs/mpl/dt/matrix_size.hpp>
+#include <hbrs/mpl/dt/matrix_index.hpp>
+#include <hbrs/mpl/dt/pca_control.hpp>
+#include <hbrs/mpl/dt/pca_transform_control.hpp>
+
+#include <hbrs/mpl/fn/pca.hpp>
+#include <hbrs/mpl/fn/pca_transform.hpp>
+#include <hbrs/mpl/fn/at.hpp>
+#include <hbrs/mpl/fn/select.hpp>
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include <array>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+#define _TOL 0.000000001
+
+BOOST_AUTO_TEST_SUITE(fn_pca_transform_elemental_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+BOOST_AUTO_TEST_CASE(pca_transform_reproduces_score, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static constexpr auto dataset = make_ctsam(
+		std::array<double, 6*4>{
+			 2.,  1.,  7., -3.,
+			 4., -2.,  1.,  5.,
+			 0.,  3., -1.,  2.,
+			-5.,  6.,  2.,  1.,
+			 3.,  3.,  8., -4.,
+			 1., -7.,  0.,  9.
+		},
+		make_matrix_size(hana::size_c<6>, hana::size_c<4>),
+		row_major_c
+	);
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	auto const a = make_el_matrix(dataset);
+	auto const b = make_el_dist_matrix(grid, a);
+	// rows of [MC,MR] matrices are split across processes, hence batches are redistributed to [VC,STAR] and back
+	el_dist_matrix<double, El::MC, El::MR, El::ELEMENT> const c{b};
+	el_dist_matrix<double, El::VC, El::STAR, El::ELEMENT> const d{b};
+	
+	hana::for_each(hana::make_tuple(false, true), [&](bool normalize) {
+		pca_control<bool,bool,bool> const pca_ctrl{true, true, normalize};
+		
+		auto check = [&](auto const& x) {
+			auto rslt = (*pca)(x, pca_ctrl);
+			auto const& score = (*at)(rslt, pca_score{});
+			
+			// all components, projected in batches of 4 rows
+			auto all = (*pca_transform)(x, rslt, make_pca_transform_control(pca_ctrl, El::Int{4}, El::Int{4}));
+			HBRS_MPL_TEST_MMEQ(all, score, false);
+			
+			// leading two components only, all rows at once
+			auto two = (*pca_transform)(x, rslt, make_pca_transform_control(pca_ctrl, El::Int{2}, El::Int{0}));
+			auto score_two = (*select)(score, std::make_pair(make_matrix_index(0,0), make_matrix_size(6,2)));
+			HBRS_MPL_TEST_MMEQ(two, score_two, false);
+		};
+		
+		check(a);
+		check(b);
+		check(c);
+		check(d);
+	});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,66 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_FN_QR_FWD_HBRS_MPL_HPP
+#define HBRS_MPL_FN_QR_FWD_HBRS_MPL_HPP
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/dt/qr_control/fwd.hpp>
+#include <hbrs/mpl/dt/decompose_mode/fwd.hpp>
+#include <hbrs/mpl/dt/storage_order/fwd.hpp>
+#include <hbrs/mpl/dt/rtsam/fwd.hpp>
+#include <type_traits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+
+struct qr_impl_rtsam {
+	template<
+		typename Ring,
+		storage_order Order,
+		typename std::enable_if_t<
+			std::is_floating_point_v< std::decay_t<Ring> >
+		>* = nullptr
+	>
+	auto
+	operator()(
+		rtsam<Ring,Order> const& a,
+		qr_control<decompose_mode, bool> const& ctrl
+	) const;
+	
+	template<
+		typename Ring,
+		storage_order Order,
+		typename std::enable_if_t<
+			std::is_floating_point_v< std::decay_t<Ring> >
+		>* = nullptr
+	>
+	auto
+	operator()(
+		rtsam<Ring,Order> && a,
+		qr_control<decompose_mode, bool> const& ctrl
+	) const;
+};
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#define HBRS_MPL_FN_QR_IMPLS_HBRS_MPL boost::hana::make_tuple(                                                         \
+		hbrs::mpl::detail::qr_impl_rtsam{}                                                                             \
+	)
+
+#endif // !HBRS_MPL_FN_QR_FWD_HBRS_MPL_HPP
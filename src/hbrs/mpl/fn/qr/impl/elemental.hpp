@@ -0,0 +1,219 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_FN_QR_IMPL_ELEMENTAL_HPP
+#define HBRS_MPL_FN_QR_IMPL_ELEMENTAL_HPP
+
+#include "../fwd/elemental.hpp"
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+#include <hbrs/mpl/dt/el_factorization.hpp>
+#include <hbrs/mpl/dt/qr_control.hpp>
+#include <hbrs/mpl/dt/decompose_mode.hpp>
+#include <hbrs/mpl/dt/qr_result.hpp>
+#include <hbrs/mpl/dt/exception.hpp>
+#include <hbrs/mpl/detail/log.hpp>
+#include <hbrs/mpl/detail/tall_skinny.hpp>
+
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <type_traits>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace hana = boost::hana;
+namespace detail {
+namespace qr_impl_el {
+
+template<typename Ring>
+El::Matrix<Ring>
+make_like(El::Matrix<Ring> const&) { return {}; }
+
+template<typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping>
+make_like(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& a) {
+	return El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping>{a.Grid()};
+}
+
+/*
+ * El::QR() overwrites A with R in its upper trapezoid and with Householder vectors below the diagonal, i.e.
+ * A = H_1*...*H_k*D*R with H_j = I - t_j*v_j*v_j' where v_j has an implicit one on the diagonal and D holds the
+ * signature d. Explicit Q is formed by applying the reflectors to the first columns of the identity, whereas in
+ * implicit-Q mode the reflectors are scaled by sqrt(t_j) and D is folded into the rows of R, see qr_result.
+ */
+template <typename A>
+auto
+qr(A && a, qr_control<decompose_mode, bool> const& ctrl) {
+	HBRS_MPL_LOG_TRIVIAL(debug) << "qr:elemental:begin";
+	
+	typedef std::decay_t<A> _A_;
+	typedef decltype(a.data().Get(0,0)) Ring;
+	typedef std::decay_t<Ring> _Ring_;
+	typedef el_factorization_storage<_A_> storage;
+	
+	if (ctrl.decompose_mode() != decompose_mode::complete && ctrl.decompose_mode() != decompose_mode::economy) {
+		BOOST_THROW_EXCEPTION(not_supported_exception{});
+	}
+	
+	if constexpr (El::IsComplex<_Ring_>::value) {
+		if (ctrl.implicit_q()) {
+			// sqrt(t_j) scaling of reflectors requires real t_j
+			BOOST_THROW_EXCEPTION(not_supported_exception{});
+		}
+	}
+	
+	El::Int const m = a.m();
+	El::Int const n = a.n();
+	El::Int const k = std::min(m, n);
+	bool const complete = ctrl.decompose_mode() == decompose_mode::complete;
+	
+	auto t = storage::make_scalars(a);
+	auto d = storage::make_signature(a);
+	auto f = HBRS_MPL_FWD(a).data();
+	El::QR(f, t, d);
+	
+	auto r = make_like(f);
+	El::Copy(f(El::IR(0, complete ? m : k), El::ALL), r);
+	El::MakeTrapezoidal(El::UPPER, r);
+	
+	if (ctrl.implicit_q()) {
+		auto v = make_like(f);
+		El::Copy(f(El::ALL, El::IR(0, k)), v);
+		El::MakeTrapezoidal(El::LOWER, v, -1);
+		El::FillDiagonal(v, _Ring_(1));
+		
+		El::EntrywiseMap(t, std::function<_Ring_(_Ring_ const&)>{
+			[](_Ring_ const& tau) { return El::Sqrt(tau); }
+		});
+		El::DiagonalScale(El::RIGHT, El::NORMAL, t, v);
+		
+		auto r_k = r(El::IR(0, k), El::ALL);
+		El::DiagonalScale(El::LEFT, El::NORMAL, d, r_k);
+		
+		HBRS_MPL_LOG_TRIVIAL(debug) << "qr:elemental:end";
+		return make_qr_result(
+			hana::make<hana::tag_of_t<_A_>>(std::move(v)),
+			hana::make<hana::tag_of_t<_A_>>(std::move(r))
+		);
+	}
+	
+	auto q = make_like(f);
+	El::Identity(q, m, complete ? m : k);
+	El::qr::ApplyQ(El::LEFT, El::NORMAL, f, t, d, q);
+	
+	HBRS_MPL_LOG_TRIVIAL(debug) << "qr:elemental:end";
+	return make_qr_result(
+		hana::make<hana::tag_of_t<_A_>>(std::move(q)),
+		hana::make<hana::tag_of_t<_A_>>(std::move(r))
+	);
+}
+
+template<typename Target, typename Source>
+Target
+redistribute(Source && src) {
+	if constexpr (std::is_same_v<Target, std::decay_t<Source>>) {
+		return HBRS_MPL_FWD(src);
+	} else {
+		return Target{src};
+	}
+}
+
+/* Economy QR of a tall-skinny matrix A (see is_tsqr_applicable()) with TSQR [1]: Each process factorizes its local
+ * rows of A in [VC,STAR] and the n x n R factors are combined in a reduction tree, so only O(log p) messages of size
+ * n*n are exchanged instead of the collectives for each column which the 2D Householder QR requires. Q and R are
+ * returned in the distribution of A.
+ *
+ * Ref.:
+ * [1] J. Demmel, L. Grigori, M. Hoemmen and J. Langou, "Communication-optimal Parallel and Sequential QR and LU
+ *     Factorizations", SIAM Journal on Scientific Computing, 34(1), 2012.
+ */
+template <typename A>
+auto
+qr_tsqr(A && a) {
+	HBRS_MPL_LOG_TRIVIAL(debug) << "qr:elemental:tsqr";
+	
+	typedef decltype(a.data().Get(0,0)) Ring;
+	typedef std::decay_t<Ring> _Ring_;
+	typedef std::decay_t<decltype(a.data())> _ElDistMatrix_;
+	
+	El::Grid const& grid = a.data().Grid();
+	auto q = to_vc_star(HBRS_MPL_FWD(a).data());
+	El::DistMatrix<_Ring_, El::STAR, El::STAR> r{grid};
+	El::qr::ExplicitTS(q, r);
+	
+	return make_qr_result(
+		make_el_dist_matrix(redistribute<_ElDistMatrix_>(std::move(q))),
+		make_el_dist_matrix(redistribute<_ElDistMatrix_>(std::move(r)))
+	);
+}
+
+template <typename A>
+auto
+qr_dist(A && a, qr_control<decompose_mode, bool> const& ctrl) {
+	if (ctrl.decompose_mode() == decompose_mode::economy && !ctrl.implicit_q() &&
+		is_tsqr_applicable(a.m(), a.n(), a.data().Grid()))
+	{
+		return qr_tsqr(HBRS_MPL_FWD(a));
+	}
+	return qr(HBRS_MPL_FWD(a), ctrl);
+}
+
+/* namespace qr_impl_el */ }
+
+template <typename Ring>
+auto
+qr_impl_el_matrix::operator()(
+	el_matrix<Ring> const& a,
+	qr_control<decompose_mode, bool> const& ctrl
+) const {
+	return qr_impl_el::qr(a, ctrl);
+}
+
+template <typename Ring>
+auto
+qr_impl_el_matrix::operator()(
+	el_matrix<Ring> && a,
+	qr_control<decompose_mode, bool> const& ctrl
+) const {
+	return qr_impl_el::qr(std::move(a), ctrl);
+}
+
+template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+auto
+qr_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+	qr_control<decompose_mode, bool> const& ctrl
+) const {
+	return qr_impl_el::qr_dist(a, ctrl);
+}
+
+template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+auto
+qr_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+	qr_control<decompose_mode, bool> const& ctrl
+) const {
+	return qr_impl_el::qr_dist(std::move(a), ctrl);
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_ENABLE_ELEMENTAL
+#endif // !HBRS_MPL_FN_QR_IMPL_ELEMENTAL_HPP
@@ -0,0 +1,322 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HBRS_MPL_FN_QR_IMPL_HBRS_MPL_HPP
+#define HBRS_MPL_FN_QR_IMPL_HBRS_MPL_HPP
+
+#include "../fwd/hbrs_mpl.hpp"
+
+#include <hbrs/mpl/config.hpp>
+#include <hbrs/mpl/core/preprocessor.hpp>
+#include <hbrs/mpl/dt/qr_control.hpp>
+#include <hbrs/mpl/dt/decompose_mode.hpp>
+#include <hbrs/mpl/dt/qr_result.hpp>
+#include <hbrs/mpl/dt/rtsam.hpp>
+#include <hbrs/mpl/dt/storage_order.hpp>
+#include <hbrs/mpl/dt/exception.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+HBRS_MPL_NAMESPACE_BEGIN
+namespace detail {
+namespace qr_impl_hbrs_mpl {
+
+/* Number of columns which are factorized unblocked before the trailing matrix is updated with a single block
+ * reflector, see Golub and Van Loan, Matrix Computations (4th ed.), chapter 5.2.2.
+ */
+constexpr std::size_t block_size = 32;
+
+/*
+ * Computes the Householder reflector H = I - tau*v*v' with v(0)=1 such that H*x = beta*e_1 (cf. LAPACK's xLARFG).
+ * x[0] is overwritten with beta and x[1..len) with v[1..len). tau is zero if x is already a multiple of e_1.
+ */
+template<typename Ring>
+Ring
+householder(Ring * x, std::size_t len) {
+	Ring sigma{0};
+	for (std::size_t i = 1; i < len; ++i) {
+		sigma += x[i] * x[i];
+	}
+	
+	if (sigma == Ring{0}) {
+		return Ring{0};
+	}
+	
+	Ring const alpha = x[0];
+	Ring const beta = -std::copysign(std::sqrt(alpha * alpha + sigma), alpha);
+	Ring const scale = Ring{1} / (alpha - beta);
+	for (std::size_t i = 1; i < len; ++i) {
+		x[i] *= scale;
+	}
+	x[0] = beta;
+	return (beta - alpha) / beta;
+}
+
+/*
+ * Applies H = I - tau*v*v' from the left to the len-by-ncols matrix C with leading dimension ldc. v(0)=1 is implicit.
+ */
+template<typename Ring>
+void
+apply_householder(Ring const* v, Ring tau, std::size_t len, Ring * c, std::size_t ldc, std::size_t ncols) {
+	if (tau == Ring{0}) {
+		return;
+	}
+	
+	for (std::size_t j = 0; j < ncols; ++j) {
+		Ring * y = c + j * ldc;
+		Ring s = y[0];
+		for (std::size_t i = 1; i < len; ++i) {
+			s += v[i] * y[i];
+		}
+		s *= tau;
+		y[0] -= s;
+		for (std::size_t i = 1; i < len; ++i) {
+			y[i] -= s * v[i];
+		}
+	}
+}
+
+/*
+ * Forms the upper triangular b-by-b factor T of the block reflector H_1*...*H_b = I - V*T*V' (cf. LAPACK's xLARFT)
+ * where the columns of V are stored below the diagonal of the len-by-b panel at v with leading dimension ldv.
+ */
+template<typename Ring>
+void
+block_reflector(Ring const* v, std::size_t ldv, std::size_t len, std::size_t b, Ring const* tau, Ring * t) {
+	std::vector<Ring> z(b);
+	for (std::size_t i = 0; i < b; ++i) {
+		// z = V(:,0:i)' * v_i where v_i starts with an implicit one in row i
+		for (std::size_t l = 0; l < i; ++l) {
+			Ring s = v[i + l * ldv];
+			for (std::size_t r = i + 1; r < len; ++r) {
+				s += v[r + l * ldv] * v[r + i * ldv];
+			}
+			z[l] = s;
+		}
+		
+		// T(0:i,i) = -tau_i * T(0:i,0:i) * z
+		for (std::size_t l = 0; l < i; ++l) {
+			Ring s{0};
+			for (std::size_t p = l; p < i; ++p) {
+				s += t[l + p * b] * z[p];
+			}
+			t[l + i * b] = -tau[i] * s;
+		}
+		t[i + i * b] = tau[i];
+		for (std::size_t l = i + 1; l < b; ++l) {
+			t[l + i * b] = Ring{0};
+		}
+	}
+}
+
+/*
+ * Applies the block reflector I - V*T*V' (Trans == false) or its transpose I - V*T'*V' (Trans == true) from the left
+ * to the len-by-ncols matrix C with leading dimension ldc.
+ */
+template<bool Trans, typename Ring>
+void
+apply_block_reflector(
+	Ring const* v, std::size_t ldv, Ring const* t, std::size_t b, std::size_t len,
+	Ring * c, std::size_t ldc, std::size_t ncols
+) {
+	std::vector<Ring> y(b);
+	for (std::size_t j = 0; j < ncols; ++j) {
+		Ring * cj = c + j * ldc;
+		
+		// y = V' * c_j
+		for (std::size_t l = 0; l < b; ++l) {
+			Ring s = cj[l];
+			for (std::size_t r = l + 1; r < len; ++r) {
+				s += v[r + l * ldv] * cj[r];
+			}
+			y[l] = s;
+		}
+		
+		if constexpr (Trans) {
+			// y = T' * y, T' is lower triangular
+			for (std::size_t l = b; l-- > 0;) {
+				Ring s{0};
+				for (std::size_t p = 0; p <= l; ++p) {
+					s += t[p + l * b] * y[p];
+				}
+				y[l] = s;
+			}
+		} else {
+			// y = T * y, T is upper triangular
+			for (std::size_t l = 0; l < b; ++l) {
+				Ring s{0};
+				for (std::size_t p = l; p < b; ++p) {
+					s += t[l + p * b] * y[p];
+				}
+				y[l] = s;
+			}
+		}
+		
+		// c_j -= V * y
+		for (std::size_t l = 0; l < b; ++l) {
+			cj[l] -= y[l];
+			for (std::size_t r = l + 1; r < len; ++r) {
+				cj[r] -= v[r + l * ldv] * y[l];
+			}
+		}
+	}
+}
+
+template<typename Ring, storage_order Order>
+auto
+to_order(rtsam<Ring, storage_order::column_major> && a) {
+	if constexpr (Order == storage_order::column_major) {
+		return std::move(a);
+	} else {
+		rtsam<Ring, Order> b{a.size().m(), a.size().n()};
+		b = a;
+		return b;
+	}
+}
+
+/*
+ * Blocked Householder QR (cf. LAPACK's xGEQRF) of the m-by-n column-major matrix A: Within each panel of block_size
+ * columns reflectors are computed and applied column by column, and afterwards the trailing matrix is updated at once
+ * with the panel's block reflector I - V*T'*V', which turns most of the work into matrix-matrix operations.
+ */
+template<typename Ring, storage_order Order>
+auto
+qr(rtsam<Ring, storage_order::column_major> a, qr_control<decompose_mode, bool> const& ctrl) {
+	if (ctrl.decompose_mode() != decompose_mode::complete && ctrl.decompose_mode() != decompose_mode::economy) {
+		BOOST_THROW_EXCEPTION(not_supported_exception{});
+	}
+	
+	std::size_t const m = a.size().m();
+	std::size_t const n = a.size().n();
+	std::size_t const k = std::min(m, n);
+	Ring * const w = a.data().data();
+	std::size_t const ldw = m;
+	
+	std::vector<Ring> tau(k);
+	std::vector<Ring> ts(block_size * block_size);
+	
+	for (std::size_t j = 0; j < k; j += block_size) {
+		std::size_t const b = std::min(block_size, k - j);
+		Ring * const panel = w + j + j * ldw;
+		std::size_t const len = m - j;
+		
+		for (std::size_t c = 0; c < b; ++c) {
+			Ring * const x = panel + c + c * ldw;
+			tau[j + c] = householder(x, len - c);
+			apply_householder<Ring>(x, tau[j + c], len - c, x + ldw, ldw, b - c - 1);
+		}
+		
+		if (j + b < n) {
+			block_reflector<Ring>(panel, ldw, len, b, tau.data() + j, ts.data());
+			apply_block_reflector<true, Ring>(
+				panel, ldw, ts.data(), b, len, panel + b * ldw, ldw, n - j - b);
+		}
+	}
+	
+	bool const complete = ctrl.decompose_mode() == decompose_mode::complete;
+	std::size_t const r_m = complete ? m : k;
+	rtsam<Ring, storage_order::column_major> r{r_m, n};
+	for (std::size_t jj = 0; jj < n; ++jj) {
+		for (std::size_t i = 0; i < k && i <= jj; ++i) {
+			r.data()[i + jj * r_m] = w[i + jj * ldw];
+		}
+	}
+	
+	if (ctrl.implicit_q()) {
+		// reflectors are scaled by sqrt(tau) such that H_j = I - v_j*v_j'
+		rtsam<Ring, storage_order::column_major> v{m, k};
+		for (std::size_t jj = 0; jj < k; ++jj) {
+			Ring const s = std::sqrt(tau[jj]);
+			v.data()[jj + jj * m] = s;
+			for (std::size_t i = jj + 1; i < m; ++i) {
+				v.data()[i + jj * m] = s * w[i + jj * ldw];
+			}
+		}
+		return make_qr_result(to_order<Ring, Order>(std::move(v)), to_order<Ring, Order>(std::move(r)));
+	}
+	
+	// Q = H_1*...*H_k * I(:,0:q_n) is accumulated backwards, so each block only touches the trailing rows and columns
+	std::size_t const q_n = complete ? m : k;
+	rtsam<Ring, storage_order::column_major> q{m, q_n};
+	for (std::size_t i = 0; i < q_n; ++i) {
+		q.data()[i + i * m] = Ring{1};
+	}
+	
+	if (k > 0) {
+		for (std::size_t j = ((k - 1) / block_size) * block_size;; j -= block_size) {
+			std::size_t const b = std::min(block_size, k - j);
+			Ring const* const panel = w + j + j * ldw;
+			std::size_t const len = m - j;
+			block_reflector<Ring>(panel, ldw, len, b, tau.data() + j, ts.data());
+			apply_block_reflector<false, Ring>(
+				panel, ldw, ts.data(), b, len, q.data().data() + j + j * m, m, q_n - j);
+			if (j == 0) {
+				break;
+			}
+		}
+	}
+	
+	return make_qr_result(to_order<Ring, Order>(std::move(q)), to_order<Ring, Order>(std::move(r)));
+}
+
+/* namespace qr_impl_hbrs_mpl */ }
+
+template<
+	typename Ring,
+	storage_order Order,
+	typename std::enable_if_t<
+		std::is_floating_point_v< std::decay_t<Ring> >
+	>*
+>
+auto
+qr_impl_rtsam::operator()(
+	rtsam<Ring,Order> const& a,
+	qr_control<decompose_mode, bool> const& ctrl
+) const {
+	if constexpr (Order == storage_order::column_major) {
+		return qr_impl_hbrs_mpl::qr<Ring, Order>(a, ctrl);
+	} else {
+		rtsam<Ring, storage_order::column_major> a_{a.size().m(), a.size().n()};
+		a_ = a;
+		return qr_impl_hbrs_mpl::qr<Ring, Order>(std::move(a_), ctrl);
+	}
+}
+
+template<
+	typename Ring,
+	storage_order Order,
+	typename std::enable_if_t<
+		std::is_floating_point_v< std::decay_t<Ring> >
+	>*
+>
+auto
+qr_impl_rtsam::operator()(
+	rtsam<Ring,Order> && a,
+	qr_control<decompose_mode, bool> const& ctrl
+) const {
+	if constexpr (Order == storage_order::column_major) {
+		return qr_impl_hbrs_mpl::qr<Ring, Order>(std::move(a), ctrl);
+	} else {
+		return (*this)(static_cast<rtsam<Ring,Order> const&>(a), ctrl);
+	}
+}
+
+/* namespace detail */ }
+HBRS_MPL_NAMESPACE_END
+
+#endif // !HBRS_MPL_FN_QR_IMPL_HBRS_MPL_HPP
@@ -0,0 +1,118 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE fn_qr_elemental_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <hbrs/mpl/config.hpp>
+
+#include <hbrs/mpl/dt/el_matrix.hpp>
+#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+
+#include <hbrs/mpl/detail/test.hpp>
+
+#include <hbrs/mpl/dt/decompose_mode.hpp>
+#include <hbrs/mpl/dt/qr_control.hpp>
+#include <hbrs/mpl/dt/qr_result.hpp>
+
+#include <hbrs/mpl/fn/qr.hpp>
+#include <hbrs/mpl/fn/at.hpp>
+#include <hbrs/mpl/fn/multiply.hpp>
+#include <hbrs/mpl/fn/transpose.hpp>
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+#define _TOL 0.000000001
+
+BOOST_AUTO_TEST_SUITE(fn_qr_elemental_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+BOOST_AUTO_TEST_CASE(qr_factorization, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	
+	// square, wide and tall-skinny inputs, the latter take the TSQR path for distributed matrices
+	static constexpr std::array<std::pair<El::Int, El::Int>, 3> sizes = {{ {8, 8}, {4, 9}, {400, 5} }};
+	
+	for (auto [m, n] : sizes) {
+		El::Matrix<double> a_{m, n};
+		for (El::Int j = 0; j < n; ++j) {
+			for (El::Int i = 0; i < m; ++i) {
+				a_.Set(i, j, std::sin(1. + i * n + j) + (i == j ? 2. : 0.));
+			}
+		}
+		
+		auto check = [&](auto const& a, auto const& make_identity) {
+			El::Int const k = std::min(m, n);
+			for (auto mode : { decompose_mode::economy, decompose_mode::complete }) {
+				El::Int const q_n = mode == decompose_mode::complete ? m : k;
+				auto rslt = (*qr)(a, make_qr_control(mode, false));
+				auto const& q = (*at)(rslt, qr_q{});
+				auto const& r = (*at)(rslt, qr_r{});
+				
+				HBRS_MPL_TEST_MMEQ((*multiply)(q, r), a, false);
+				HBRS_MPL_TEST_MMEQ((*multiply)((*transpose)(q), q), make_identity(q_n), false);
+			}
+			
+			// Q formed from the scaled reflectors matches the explicit Q
+			auto expl = (*qr)(a, make_qr_control(decompose_mode::economy, false));
+			auto impl = (*qr)(a, make_qr_control(decompose_mode::economy, true));
+			auto v = (*at)(impl, qr_q{}).data();
+			auto q = make_identity(m).data();
+			for (El::Int l = k; l-- > 0;) {
+				auto v_l = v(El::ALL, El::IR(l, l + 1));
+				auto w = make_identity(1).data();
+				El::Zeros(w, 1, m);
+				El::Gemm(El::TRANSPOSE, El::NORMAL, 1., v_l, q, 0., w);
+				El::Gemm(El::NORMAL, El::NORMAL, -1., v_l, w, 1., q);
+			}
+			HBRS_MPL_TEST_MMEQ(
+				hana::make<hana::tag_of_t<std::decay_t<decltype(a)>>>(decltype(q){q(El::ALL, El::IR(0, k))}),
+				(*at)(expl, qr_q{}),
+				false
+			);
+			HBRS_MPL_TEST_MMEQ((*at)(impl, qr_r{}), (*at)(expl, qr_r{}), false);
+		};
+		
+		check(make_el_matrix(a_), [](El::Int k) {
+			El::Matrix<double> i;
+			El::Identity(i, k, k);
+			return make_el_matrix(std::move(i));
+		});
+		
+		check(make_el_dist_matrix(grid, make_el_matrix(a_)), [](El::Int k) {
+			El::DistMatrix<double> i{grid};
+			El::Identity(i, k, k);
+			return make_el_dist_matrix(std::move(i));
+		});
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
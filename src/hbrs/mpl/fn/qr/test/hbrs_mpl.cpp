@@ -0,0 +1,199 @@
+/* Copyright (c) 2020 Jakob Meng, <jakobmeng@web.de>
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE fn_qr_hbrs_mpl_test
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <hbrs/mpl/config.hpp>
+
+#include <hbrs/mpl/detail/test.hpp>
+
+#include <hbrs/mpl/dt/rtsam.hpp>
+#include <hbrs/mpl/dt/storage_order.hpp>
+#include <hbrs/mpl/dt/matrix_index.hpp>
+#include <hbrs/mpl/dt/matrix_size.hpp>
+#include <hbrs/mpl/dt/decompose_mode.hpp>
+#include <hbrs/mpl/dt/qr_control.hpp>
+#include <hbrs/mpl/dt/qr_result.hpp>
+#include <hbrs/mpl/dt/exception.hpp>
+#include <hbrs/mpl/fn/qr.hpp>
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+namespace utf = boost::unit_test;
+namespace tt = boost::test_tools;
+
+#define _TOL 0.000000001
+
+BOOST_AUTO_TEST_SUITE(fn_qr_hbrs_mpl_test)
+
+using hbrs::mpl::detail::environment_fixture;
+BOOST_TEST_GLOBAL_FIXTURE(environment_fixture);
+
+namespace {
+
+template<hbrs::mpl::storage_order Order>
+hbrs::mpl::rtsam<double, Order>
+make_test_matrix(std::size_t m, std::size_t n) {
+	using namespace hbrs::mpl;
+	rtsam<double, Order> a{m, n};
+	for (std::size_t i = 0; i < m; ++i) {
+		for (std::size_t j = 0; j < n; ++j) {
+			a.at(make_matrix_index(i, j)) = std::sin(1. + i * n + j) + (i == j ? 2. : 0.);
+		}
+	}
+	return a;
+}
+
+template<typename Matrix>
+double
+get(Matrix const& a, std::size_t i, std::size_t j) {
+	return a.at(hbrs::mpl::make_matrix_index(i, j));
+}
+
+/* namespace */ }
+
+BOOST_AUTO_TEST_CASE(qr_factorization, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	// sizes below, at and above the block size of the blocked Householder QR
+	std::array<std::pair<std::size_t, std::size_t>, 6> const sizes = {{
+		{1, 1}, {5, 3}, {3, 5}, {8, 8}, {70, 40}, {40, 70}
+	}};
+	
+	hana::for_each(
+		hana::make_tuple(storage_order_c<storage_order::column_major>, storage_order_c<storage_order::row_major>),
+		[&sizes](auto order) {
+			for (auto [m, n] : sizes) {
+				BOOST_TEST_MESSAGE("m=" << m << ", n=" << n);
+				auto a = make_test_matrix<order()>(m, n);
+				std::size_t const k = std::min(m, n);
+				
+				for (auto mode : { decompose_mode::economy, decompose_mode::complete }) {
+					auto qr_ = qr(a, make_qr_control(mode, false));
+					auto const& q = qr_.q();
+					auto const& r = qr_.r();
+					std::size_t const q_n = mode == decompose_mode::complete ? m : k;
+					
+					BOOST_TEST(q.size().m() == m);
+					BOOST_TEST(q.size().n() == q_n);
+					BOOST_TEST(r.size().m() == q_n);
+					BOOST_TEST(r.size().n() == n);
+					
+					// R is upper trapezoidal
+					for (std::size_t i = 0; i < q_n; ++i) {
+						for (std::size_t j = 0; j < std::min(i, n); ++j) {
+							BOOST_TEST(get(r, i, j) == 0.);
+						}
+					}
+					
+					// Q'*Q = I
+					for (std::size_t i = 0; i < q_n; ++i) {
+						for (std::size_t j = 0; j < q_n; ++j) {
+							double s = 0.;
+							for (std::size_t l = 0; l < m; ++l) {
+								s += get(q, l, i) * get(q, l, j);
+							}
+							BOOST_TEST(s == (i == j ? 1. : 0.));
+						}
+					}
+					
+					// Q*R = A
+					for (std::size_t i = 0; i < m; ++i) {
+						for (std::size_t j = 0; j < n; ++j) {
+							double s = 0.;
+							for (std::size_t l = 0; l < q_n; ++l) {
+								s += get(q, i, l) * get(r, l, j);
+							}
+							BOOST_TEST(s == get(a, i, j));
+						}
+					}
+				}
+			}
+		}
+	);
+}
+
+BOOST_AUTO_TEST_CASE(qr_implicit_q, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static constexpr std::array<std::pair<std::size_t, std::size_t>, 3> sizes = {{
+		{5, 3}, {3, 5}, {70, 40}
+	}};
+	
+	for (auto [m, n] : sizes) {
+		BOOST_TEST_MESSAGE("m=" << m << ", n=" << n);
+		auto a = make_test_matrix<storage_order::row_major>(m, n);
+		std::size_t const k = std::min(m, n);
+		
+		auto explicit_ = qr(a, make_qr_control(decompose_mode::economy, false));
+		auto implicit_ = qr(a, make_qr_control(decompose_mode::economy, true));
+		auto const& v = implicit_.q();
+		
+		BOOST_TEST(v.size().m() == m);
+		BOOST_TEST(v.size().n() == k);
+		
+		for (std::size_t i = 0; i < k; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				BOOST_TEST(get(implicit_.r(), i, j) == get(explicit_.r(), i, j));
+			}
+		}
+		
+		// Q(:,0:k) = H_1*...*H_k * I(:,0:k) with H_j = I - v_j*v_j'
+		rtsam<double, storage_order::column_major> q{m, k};
+		for (std::size_t i = 0; i < k; ++i) {
+			q.at(make_matrix_index(i, i)) = 1.;
+		}
+		
+		for (std::size_t l = k; l-- > 0;) {
+			for (std::size_t i = 0; i < l; ++i) {
+				BOOST_TEST(get(v, i, l) == 0.);
+			}
+			
+			for (std::size_t j = 0; j < k; ++j) {
+				double s = 0.;
+				for (std::size_t i = 0; i < m; ++i) {
+					s += get(v, i, l) * get(q, i, j);
+				}
+				for (std::size_t i = 0; i < m; ++i) {
+					q.at(make_matrix_index(i, j)) -= s * get(v, i, l);
+				}
+			}
+		}
+		
+		for (std::size_t i = 0; i < m; ++i) {
+			for (std::size_t j = 0; j < k; ++j) {
+				BOOST_TEST(get(q, i, j) == get(explicit_.q(), i, j));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(qr_unsupported_mode) {
+	using namespace hbrs::mpl;
+	auto a = make_test_matrix<storage_order::column_major>(4, 3);
+	BOOST_CHECK_THROW(qr(a, make_qr_control(decompose_mode::zero, false)), not_supported_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
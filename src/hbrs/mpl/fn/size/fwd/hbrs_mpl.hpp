@@ -37,6 +37,7 @@
 #include <hbrs/mpl/dt/rtsacv/fwd.hpp>
 #include <hbrs/mpl/dt/rtsarv/fwd.hpp>
 #include <hbrs/mpl/dt/zas/fwd.hpp>
+#include <hbrs/mpl/dt/hankel_matrix/fwd.hpp>
 #include <boost/hana/tuple.hpp>
 
 HBRS_MPL_NAMESPACE_BEGIN
@@ -60,6 +61,7 @@ HBRS_MPL_DEC_FO_TRY_METHOD(size_impl_rtsam,    rtsam_tag,    size)
 HBRS_MPL_DEC_FO_TRY_METHOD(size_impl_rtsacv,   rtsacv_tag,   length)
 HBRS_MPL_DEC_FO_TRY_METHOD(size_impl_rtsarv,   rtsarv_tag,   length)
 HBRS_MPL_DEC_FO_TRY_METHOD(size_impl_zas,      zas_tag,      length)
+HBRS_MPL_DEC_FO_TRY_METHOD(size_impl_hankel_matrix, hankel_matrix_tag, size)
 
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
@@ -81,7 +83,8 @@ HBRS_MPL_NAMESPACE_END
 		hbrs::mpl::detail::size_impl_rtsam{},                                                                          \
 		hbrs::mpl::detail::size_impl_rtsacv{},                                                                         \
 		hbrs::mpl::detail::size_impl_rtsarv{},                                                                         \
-		hbrs::mpl::detail::size_impl_zas{}                                                                             \
+		hbrs::mpl::detail::size_impl_zas{},                                                                            \
+		hbrs::mpl::detail::size_impl_hankel_matrix{}                                                                   \
 	)
 
 #endif // !HBRS_MPL_FN_SIZE_FWD_HBRS_MPL_HPP
@@ -38,6 +38,7 @@
 #include <hbrs/mpl/dt/rtsacv.hpp>
 #include <hbrs/mpl/dt/rtsarv.hpp>
 #include <hbrs/mpl/dt/zas.hpp>
+#include <hbrs/mpl/dt/hankel_matrix.hpp>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace detail {
@@ -59,6 +60,7 @@ HBRS_MPL_DEF_FO_TRY_METHOD(size_impl_rtsam,    rtsam_tag,    size)
 HBRS_MPL_DEF_FO_TRY_METHOD(size_impl_rtsacv,   rtsacv_tag,   length)
 HBRS_MPL_DEF_FO_TRY_METHOD(size_impl_rtsarv,   rtsarv_tag,   length)
 HBRS_MPL_DEF_FO_TRY_METHOD(size_impl_zas,      zas_tag,      length)
+HBRS_MPL_DEF_FO_TRY_METHOD(size_impl_hankel_matrix, hankel_matrix_tag, size)
 
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
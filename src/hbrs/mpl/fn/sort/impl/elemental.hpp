@@ -30,6 +30,11 @@
 #include <hbrs/mpl/dt/eig_result.hpp>
 
 #include <hbrs/mpl/detail/sort_eig_result.hpp>
+#include <hbrs/mpl/detail/shared_matrix.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
@@ -67,22 +72,45 @@ sort_impl_el_eig_result::operator()(eig_result<Vector,Matrix> const& r, Predicat
 	
 	//TODO: Implement distributed sort algorithm!
 	
-	//NOTE: A [STAR,STAR] distribution might be very memory-intensive!
+	// inputs are replicated once per node, each process fills only its own entries of the sorted eigenvectors
+	shared_matrix<_RingV_> eigenvalues{r.eigenvalues().data()};
+	shared_matrix<_RingM_> eigenvectors{r.eigenvectors().data()};
+	El::Matrix<_RingV_> const& w = eigenvalues.data();
+	El::Matrix<_RingM_> const& v = eigenvectors.data();
 	
-	El::DistMatrix<_RingV_, El::STAR, El::STAR> eigenvalues = { r.eigenvalues().data() };
-	El::DistMatrix<_RingM_, El::STAR, El::STAR> eigenvectors = { r.eigenvectors().data() };
+	BOOST_ASSERT(w.Height() == v.Width());
 	
-	auto sorted = sort_eig_result(
-		make_eig_result(
-			make_el_column_vector(std::move(eigenvalues).Matrix()),
-			make_el_matrix(std::move(eigenvectors).Matrix())
-		),
-		HBRS_MPL_FWD(p)
+	std::vector<El::Int> idx(w.Height());
+	std::iota(idx.begin(), idx.end(), 0);
+	std::sort(
+		idx.begin(),
+		idx.end(),
+		[&](El::Int i1, El::Int i2) {
+			return p(w.Get(i1, 0), w.Get(i2, 0));
+		}
 	);
 	
+	El::Matrix<_RingV_> sorted_w{w.Height(), 1};
+	for(El::Int j = 0; j < w.Height(); ++j) {
+		sorted_w.Set(j, 0, w.Get(idx[j], 0));
+	}
+	
+	// same distribution as the unsorted eigenvectors
+	std::decay_t<decltype(r.eigenvectors().data())> sorted_v{r.eigenvectors().data().Grid()};
+	sorted_v.AlignWith(r.eigenvectors().data());
+	sorted_v.Resize(v.Height(), v.Width());
+	
+	El::Matrix<_RingM_> & sorted_v_lcl = sorted_v.Matrix();
+	for(El::Int j = 0; j < sorted_v_lcl.Width(); ++j) {
+		_RingM_ const* col = v.LockedBuffer(0, idx[sorted_v.GlobalCol(j)]);
+		for(El::Int i = 0; i < sorted_v_lcl.Height(); ++i) {
+			sorted_v_lcl.Set(i, j, col[sorted_v.GlobalRow(i)]);
+		}
+	}
+	
 	return make_eig_result(
-		make_el_dist_column_vector(r.eigenvalues().data().Grid(), std::move(sorted.eigenvalues())),
-		make_el_dist_matrix(r.eigenvectors().data().Grid(), std::move(sorted.eigenvectors()))
+		make_el_dist_column_vector(r.eigenvalues().data().Grid(), make_el_column_vector(std::move(sorted_w))),
+		make_el_dist_matrix(std::move(sorted_v))
 	);
 }
 
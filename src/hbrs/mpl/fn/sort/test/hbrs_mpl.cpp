@@ -67,6 +67,8 @@
 #include <boost/hana/remove_at.hpp>
 
 #include <array>
+#include <initializer_list>
+#include <type_traits>
 
 namespace utf = boost::unit_test;
 namespace tt = boost::test_tools;
@@ -289,4 +291,57 @@ BOOST_AUTO_TEST_CASE(sort_eig_result) {
 	
 }
 
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+BOOST_AUTO_TEST_CASE(sort_eig_result_distributed) {
+	using namespace hbrs::mpl;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	
+	auto const eigval_us = make_el_dist_column_vector(
+		grid, make_el_column_vector(std::initializer_list<double>{ 4, 1, 3, 2 }));
+	auto const eigvec_us = make_el_dist_matrix(
+		grid,
+		make_el_matrix(
+			std::initializer_list<double>{
+				1,   2,  3,  4,
+				5,   6,  7,  8,
+				9,  10, 11, 12,
+				13, 14, 15, 16
+			},
+			make_matrix_size(4,4),
+			row_major_c
+		)
+	);
+	
+	auto const eigval_so = make_el_column_vector(std::initializer_list<double>{ 1, 2, 3, 4 });
+	auto const eigvec_so = make_el_matrix(
+		std::initializer_list<double>{
+			2,   4,  3,  1,
+			6,   8,  7,  5,
+			10, 12, 11,  9,
+			14, 16, 15, 13
+		},
+		make_matrix_size(4,4),
+		row_major_c
+	);
+	
+	auto const check = [&](auto const& eigvec) {
+		typedef std::decay_t<decltype(eigvec)> Matrix;
+		
+		auto const sorted = (*sort)(make_eig_result(eigval_us, eigvec), less);
+		auto const& sorted_eigvec = (*at)(sorted, eig_eigenvectors{});
+		
+		// sorted eigenvectors keep the distribution of the unsorted ones
+		static_assert(std::is_same_v<std::decay_t<decltype(sorted_eigvec)>, Matrix>);
+		
+		HBRS_MPL_TEST_VVEQ(eigval_so, (*at)(sorted, eig_eigenvalues{}), false);
+		HBRS_MPL_TEST_MMEQ(eigvec_so, sorted_eigvec, false);
+	};
+	
+	check(el_dist_matrix<double, El::MC, El::MR, El::ELEMENT>{eigvec_us});
+	check(el_dist_matrix<double, El::VC, El::STAR, El::ELEMENT>{eigvec_us});
+	check(el_dist_matrix<double, El::STAR, El::VR, El::ELEMENT>{eigvec_us});
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -32,6 +32,16 @@ template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t,
 template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<double>>> &&) const;
 template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<El::Complex<double>>>> &&) const;
 
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<float, El::VC, El::STAR>>> const&) const;
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<El::Complex<float>, El::VC, El::STAR>>> const&) const;
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<double, El::VC, El::STAR>>> const&) const;
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<El::Complex<double>, El::VC, El::STAR>>> const&) const;
+
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<float, El::VC, El::STAR>>> &&) const;
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<El::Complex<float>, El::VC, El::STAR>>> &&) const;
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<double, El::VC, El::STAR>>> &&) const;
+template auto sum_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<El::Complex<double>, El::VC, El::STAR>>> &&) const;
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
@@ -35,6 +35,7 @@
 #include <hbrs/mpl/fn/n.hpp>
 #include <hbrs/mpl/fn/at.hpp>
 #include <hbrs/mpl/fn/columns.hpp>
+#include <hbrs/mpl/detail/tall_skinny.hpp>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
@@ -106,18 +107,9 @@ sum_impl_smrs_el_matrix::operator()(smrs<Matrix> const& a) const {
 
 template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
 static auto
-sum_impl_el_dist_matrix_columns_impl(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& from) {
+sum_impl_el_dist_matrix_columns_gemv(El::DistMatrix<Ring, Columnwise, Rowwise, Wrapping> const& in_dmat) {
 	typedef std::decay_t<Ring> _Ring_;
 	
-	auto const& in_dmat = from.data();
-	auto in_dmat_sz = (*size)(from);
-	auto in_dmat_m = (*m)(in_dmat_sz);
-	auto in_dmat_n = (*n)(in_dmat_sz);
-	
-	if ((in_dmat_m == 0) || (in_dmat_n == 0)) {
-		BOOST_THROW_EXCEPTION(incompatible_matrix_exception{} << errinfo_el_matrix_size{in_dmat_sz});
-	}
-	
 	El::DistMatrix<_Ring_> ones_dmat{in_dmat.Grid()};
 	El::Ones(ones_dmat, in_dmat.Height(), 1);
 	
@@ -136,6 +128,26 @@ sum_impl_el_dist_matrix_columns_impl(el_dist_matrix<Ring, Columnwise, Rowwise, W
 	return make_el_dist_row_vector(sums_dmat);
 }
 
+template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+static auto
+sum_impl_el_dist_matrix_columns_impl(el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& from) {
+	auto const& in_dmat = from.data();
+	auto in_dmat_sz = (*size)(from);
+	auto in_dmat_m = (*m)(in_dmat_sz);
+	auto in_dmat_n = (*n)(in_dmat_sz);
+	
+	if ((in_dmat_m == 0) || (in_dmat_n == 0)) {
+		BOOST_THROW_EXCEPTION(incompatible_matrix_exception{} << errinfo_el_matrix_size{in_dmat_sz});
+	}
+	
+	if constexpr (is_row_distributed_v<Columnwise, Rowwise>) {
+		// each process owns complete rows, so local column sums are reduced once over the column communicator
+		return make_el_dist_row_vector(column_sums(in_dmat));
+	} else {
+		return sum_impl_el_dist_matrix_columns_gemv(in_dmat);
+	}
+}
+
 template <
 	typename DistMatrix,
 	typename std::enable_if_t<
@@ -43,6 +43,13 @@ struct svd_impl_el_matrix {
 		el_matrix<Ring> const& a,
 		svd_control<decompose_mode> const& ctrl
 	) const;
+	
+	template <typename Ring>
+	auto
+	operator()(
+		el_matrix<Ring> && a,
+		svd_control<decompose_mode> const& ctrl
+	) const;
 };
 
 struct svd_impl_el_dist_matrix {
@@ -52,6 +59,13 @@ struct svd_impl_el_dist_matrix {
 		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
 		svd_control<decompose_mode> const& ctrl
 	) const;
+	
+	template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+	auto
+	operator()(
+		el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+		svd_control<decompose_mode> const& ctrl
+	) const;
 };
 
 #else
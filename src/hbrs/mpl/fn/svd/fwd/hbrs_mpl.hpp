@@ -41,6 +41,20 @@ struct svd_impl_rtsam {
 		rtsam<Ring,Order> const& a,
 		svd_control<decompose_mode> const& ctrl
 	) const;
+	
+	template<
+		typename Ring,
+		storage_order Order,
+		typename std::enable_if_t<
+			// TODO: Drop this restriction to double once almost_equal has been implemented for other arithmetic types
+			std::is_same_v< std::decay_t<Ring>, double >
+		>* = nullptr
+	>
+	auto
+	operator()(
+		rtsam<Ring,Order> && a,
+		svd_control<decompose_mode> const& ctrl
+	) const;
 };
 
 /* namespace detail */ }
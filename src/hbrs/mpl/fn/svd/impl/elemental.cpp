@@ -25,11 +25,31 @@ template auto svd_impl_el_matrix::operator()(el_matrix<El::Complex<float>>  cons
 template auto svd_impl_el_matrix::operator()(el_matrix<double>              const&, svd_control<decompose_mode> const&) const;
 template auto svd_impl_el_matrix::operator()(el_matrix<El::Complex<double>> const&, svd_control<decompose_mode> const&) const;
 
+template auto svd_impl_el_matrix::operator()(el_matrix<float>               &&,      svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_matrix::operator()(el_matrix<El::Complex<float>>  &&,      svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_matrix::operator()(el_matrix<double>              &&,      svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_matrix::operator()(el_matrix<El::Complex<double>> &&,      svd_control<decompose_mode> const&) const;
+
 template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<float>               const&, svd_control<decompose_mode> const&) const;
 template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>>  const&, svd_control<decompose_mode> const&) const;
 template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<double>              const&, svd_control<decompose_mode> const&) const;
 template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>> const&, svd_control<decompose_mode> const&) const;
 
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<float>               &&,      svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>>  &&,      svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<double>              &&,      svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>> &&,      svd_control<decompose_mode> const&) const;
+
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<float, El::VC, El::STAR> const&, svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>, El::VC, El::STAR> const&, svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<double, El::VC, El::STAR> const&, svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>, El::VC, El::STAR> const&, svd_control<decompose_mode> const&) const;
+
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<float, El::VC, El::STAR> &&, svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<float>, El::VC, El::STAR> &&, svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<double, El::VC, El::STAR> &&, svd_control<decompose_mode> const&) const;
+template auto svd_impl_el_dist_matrix::operator()(el_dist_matrix<El::Complex<double>, El::VC, El::STAR> &&, svd_control<decompose_mode> const&) const;
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
@@ -27,6 +27,7 @@
 #include <hbrs/mpl/dt/decompose_mode.hpp>
 #include <hbrs/mpl/dt/svd_result.hpp>
 #include <hbrs/mpl/detail/log.hpp>
+#include <hbrs/mpl/detail/tall_skinny.hpp>
 
 #include <boost/assert.hpp>
 #include <cmath>
@@ -35,10 +36,14 @@ HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
 namespace detail {
 
-/* Example: https://github.com/elemental/Elemental/blob/master/tests/lapack_like/SVD.cpp */
+/* Example: https://github.com/elemental/Elemental/blob/master/tests/lapack_like/SVD.cpp
+ * 
+ * A is forwarded to El::SVD() as-is: a const lvalue makes Elemental work on its own copy, whereas a non-const matrix
+ * (handed over by the rvalue overloads below) allows Elemental's overwriting variants to reuse its storage.
+ */
 template <typename A, typename U, typename S, typename V>
 auto
-svd_impl_el(A const& a, svd_control<decompose_mode> const& ctrl, U u, S s, S s_, V v) {
+svd_impl_el(A && a, svd_control<decompose_mode> const& ctrl, U u, S s, S s_, V v) {
 	HBRS_MPL_LOG_TRIVIAL(debug) << "svd:elemental:begin";
 	HBRS_MPL_LOG_TRIVIAL(trace) << "A:" << loggable{a};
 	
@@ -141,13 +146,12 @@ svd_impl_el(A const& a, svd_control<decompose_mode> const& ctrl, U u, S s, S s_,
 	HBRS_MPL_LOG_TRIVIAL(debug) << "svd:elemental:end";
 	
 	return make_svd_result(
-		hana::make<hana::tag_of_t<A>>(std::move(u)),
-		hana::make<hana::tag_of_t<A>>(std::move(s_)),
-		hana::make<hana::tag_of_t<A>>(std::move(v))
+		hana::make<hana::tag_of_t<std::decay_t<A>>>(std::move(u)),
+		hana::make<hana::tag_of_t<std::decay_t<A>>>(std::move(s_)),
+		hana::make<hana::tag_of_t<std::decay_t<A>>>(std::move(v))
 	);
 }
 
-
 template <typename Ring>
 auto
 svd_impl_el_matrix::operator()(
@@ -164,12 +168,26 @@ svd_impl_el_matrix::operator()(
 	);
 }
 
-template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+template <typename Ring>
 auto
-svd_impl_el_dist_matrix::operator()(
-	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+svd_impl_el_matrix::operator()(
+	el_matrix<Ring> && a,
 	svd_control<decompose_mode> const& ctrl
 ) const {
+	typedef std::decay_t<Ring> _Ring_;
+	return svd_impl_el(
+		std::move(a), ctrl,
+		El::Matrix<_Ring_>{} /*u*/,
+		El::Matrix<El::Base<_Ring_>>{} /*s*/,
+		El::Matrix<El::Base<_Ring_>>{} /*s_*/,
+		El::Matrix<_Ring_>{} /*v*/
+	);
+}
+
+template <typename A>
+static auto
+svd_impl_el_dist_2d(A && a, svd_control<decompose_mode> const& ctrl) {
+	typedef decltype(a.data().Get(0,0)) Ring;
 	typedef std::decay_t<Ring> _Ring_;
 	/* Elemental uses Read-/Write-Proxies to map input matrix distributions (defined by user) to matrix distribution
 		* types that are suitable for SVD. Elemental uses these distributions:
@@ -182,13 +200,122 @@ svd_impl_el_dist_matrix::operator()(
 		* To prevent unnecessary conversations or redistributions we just use those SVD distributions directly.
 		* TODO: Do proxies cause redistributions or performance penalties?
 		*/
+	El::Grid const& grid = a.data().Grid();
 	return svd_impl_el(
-		a, ctrl,
-		El::DistMatrix<_Ring_>{a.data().Grid()} /*u*/,
-		El::DistMatrix<El::Base<_Ring_>>{a.data().Grid()} /*s*/,
-		El::DistMatrix<El::Base<_Ring_>>{a.data().Grid()} /*s_*/,
-		El::DistMatrix<_Ring_>{a.data().Grid()} /*v*/
+		HBRS_MPL_FWD(a), ctrl,
+		El::DistMatrix<_Ring_>{grid} /*u*/,
+		El::DistMatrix<El::Base<_Ring_>>{grid} /*s*/,
+		El::DistMatrix<El::Base<_Ring_>>{grid} /*s_*/,
+		El::DistMatrix<_Ring_>{grid} /*v*/
+	);
+}
+
+/* Thin SVD of a tall-skinny matrix A with TSQR [1]: A = Q*R where Q overwrites A in [VC,STAR] and R is replicated on
+ * all processes, R = U_r*S*V' is decomposed redundantly on each process and U = Q*U_r is computed from local rows of
+ * Q without communication. Only the reduction of the n x n R factors requires communication, whereas the 2D path
+ * bidiagonalizes A with collectives for each column.
+ *
+ * Ref.:
+ * [1] J. Demmel, L. Grigori, M. Hoemmen and J. Langou, "Communication-optimal Parallel and Sequential QR and LU
+ *     Factorizations", SIAM Journal on Scientific Computing, 34(1), 2012.
+ */
+template <typename Ring>
+static auto
+svd_impl_el_tsqr(El::DistMatrix<Ring, El::VC, El::STAR> q, svd_control<decompose_mode> const& ctrl) {
+	BOOST_ASSERT(ctrl.decompose_mode() != decompose_mode::complete);
+	BOOST_ASSERT(q.Height() >= q.Width());
+	HBRS_MPL_LOG_TRIVIAL(debug) << "svd:elemental:tsqr";
+	
+	El::Grid const& grid = q.Grid();
+	
+	El::DistMatrix<Ring, El::STAR, El::STAR> r{grid};
+	El::qr::ExplicitTS(q, r);
+	
+	auto usv_r = svd_impl_el(
+		make_el_matrix(r.Matrix()), svd_control<decompose_mode>{decompose_mode::economy},
+		El::Matrix<Ring>{} /*u*/,
+		El::Matrix<El::Base<Ring>>{} /*s*/,
+		El::Matrix<El::Base<Ring>>{} /*s_*/,
+		El::Matrix<Ring>{} /*v*/
+	);
+	
+	El::DistMatrix<Ring, El::VC, El::STAR> u{grid};
+	u.AlignWith(q.DistData());
+	u.Resize(q.Height(), q.Width());
+	
+	El::Gemm(
+		El::Orientation::NORMAL,
+		El::Orientation::NORMAL,
+		Ring(1),
+		q.LockedMatrix(),
+		usv_r.u().data(),
+		Ring(0),
+		u.Matrix()
 	);
+	
+	return make_svd_result(
+		make_el_dist_matrix(std::move(u)),
+		make_el_dist_matrix(grid, std::move(usv_r).s()),
+		make_el_dist_matrix(grid, std::move(usv_r).v())
+	);
+}
+
+/* Tall-skinny matrices (see is_tsqr_applicable()) which are not decomposed completely take the TSQR path. Matrices in
+ * [VC,STAR] keep their 1D distribution, i.e. U is returned as [VC,STAR] and S and V as [STAR,STAR], whereas other
+ * distributions are redistributed to [VC,STAR] and back, which costs less than the 2D path for tall-skinny matrices.
+ */
+template <typename A>
+static auto
+svd_impl_el_dist(A && a, svd_control<decompose_mode> const& ctrl) {
+	typedef decltype(a.data().Get(0,0)) Ring;
+	typedef std::decay_t<Ring> _Ring_;
+	typedef std::decay_t<decltype(a.data())> _ElDistMatrix_;
+	
+	bool const tsqr =
+		(ctrl.decompose_mode() != decompose_mode::complete) &&
+		is_tsqr_applicable(a.m(), a.n(), a.data().Grid());
+	
+	if constexpr (std::is_same_v<_ElDistMatrix_, El::DistMatrix<_Ring_, El::VC, El::STAR>>) {
+		if (tsqr) {
+			return svd_impl_el_tsqr(HBRS_MPL_FWD(a).data(), ctrl);
+		}
+		
+		auto usv = svd_impl_el_dist_2d(HBRS_MPL_FWD(a), ctrl);
+		return make_svd_result(
+			make_el_dist_matrix(El::DistMatrix<_Ring_, El::VC, El::STAR>{usv.u().data()}),
+			make_el_dist_matrix(El::DistMatrix<El::Base<_Ring_>, El::STAR, El::STAR>{usv.s().data()}),
+			make_el_dist_matrix(El::DistMatrix<_Ring_, El::STAR, El::STAR>{usv.v().data()})
+		);
+	} else {
+		if (tsqr) {
+			auto usv = svd_impl_el_tsqr(to_vc_star(a.data()), ctrl);
+			return make_svd_result(
+				make_el_dist_matrix(El::DistMatrix<_Ring_>{usv.u().data()}),
+				make_el_dist_matrix(El::DistMatrix<El::Base<_Ring_>>{usv.s().data()}),
+				make_el_dist_matrix(El::DistMatrix<_Ring_>{usv.v().data()})
+			);
+		}
+		
+		return svd_impl_el_dist_2d(HBRS_MPL_FWD(a), ctrl);
+	}
+}
+
+template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+auto
+svd_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& a,
+	svd_control<decompose_mode> const& ctrl
+) const {
+	return svd_impl_el_dist(a, ctrl);
+}
+
+template <typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping>
+auto
+svd_impl_el_dist_matrix::operator()(
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> && a,
+	svd_control<decompose_mode> const& ctrl
+) const {
+	return svd_impl_el_dist(std::move(a), ctrl);
 }
 
 /* namespace detail */ }
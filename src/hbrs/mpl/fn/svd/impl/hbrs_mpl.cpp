@@ -33,5 +33,19 @@ svd_impl_rtsam::operator()(
 	svd_control<decompose_mode> const&
 ) const;
 
+template
+auto
+svd_impl_rtsam::operator()(
+	rtsam<double,storage_order::column_major> &&,
+	svd_control<decompose_mode> const&
+) const;
+
+template
+auto
+svd_impl_rtsam::operator()(
+	rtsam<double,storage_order::row_major> &&,
+	svd_control<decompose_mode> const&
+) const;
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
@@ -23,6 +23,7 @@
 #include <hbrs/mpl/config.hpp>
 #include <hbrs/mpl/core/preprocessor.hpp>
 #include <hbrs/mpl/dt/svd_control.hpp>
+#include <hbrs/mpl/dt/svd_algorithm.hpp>
 #include <hbrs/mpl/dt/decompose_mode.hpp>
 #include <hbrs/mpl/dt/svd_result.hpp>
 #include <hbrs/mpl/dt/rtsam.hpp>
@@ -30,8 +31,12 @@
 #include <hbrs/mpl/dt/rtsacv.hpp>
 #include <hbrs/mpl/dt/rtsarv.hpp>
 #include <hbrs/mpl/dt/range.hpp>
+#include <hbrs/mpl/dt/givens_rotation.hpp>
+#include <hbrs/mpl/dt/givens_result.hpp>
+#include <hbrs/mpl/dt/qr_control.hpp>
 #include <hbrs/mpl/fn/bidiag.hpp>
 #include <hbrs/mpl/fn/givens.hpp>
+#include <hbrs/mpl/fn/qr.hpp>
 #include <hbrs/mpl/fn/almost_equal.hpp>
 #include <hbrs/mpl/dt/almost_equal_control.hpp>
 #include <hbrs/mpl/fn/select.hpp>
@@ -43,7 +48,16 @@
 #include <hbrs/mpl/fn/greater_equal.hpp>
 #include <hbrs/mpl/fn/less.hpp>
 #include <hbrs/mpl/dt/exception.hpp>
+#include <hbrs/mpl/detail/workspace.hpp>
+#include <hbrs/mpl/detail/bidiagonal_svd.hpp>
+#include <hbrs/mpl/detail/thread_pool.hpp>
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace detail {
@@ -147,6 +161,231 @@ svd_step_rtsam(B_& B, std::size_t p, std::size_t q, U_& U, V_& V) {
 	}
 }
 
+/*
+ * Overwrites the leading k columns of X with X(:,0:k-1)*Y where Y is a k-by-k matrix stored column by column.
+ */
+template<typename Matrix, typename Ring>
+static void
+multiply_leading_columns_rtsam(Matrix & x, std::vector<Ring> const& y, std::size_t k) {
+	std::size_t const rows = (*m)(size(x));
+	std::vector<Ring> row(k);
+	for (std::size_t i = 0; i < rows; ++i) {
+		for (std::size_t l = 0; l < k; ++l) {
+			row[l] = x.at(make_matrix_index(i, l));
+		}
+		for (std::size_t j = 0; j < k; ++j) {
+			Ring s{0};
+			for (std::size_t l = 0; l < k; ++l) {
+				s += row[l] * y[l + j * k];
+			}
+			x.at(make_matrix_index(i, j)) = s;
+		}
+	}
+}
+
+/*
+ * Computes the SVD B(0:n-1,0:n-1) = U_b*S*V_b' of the upper bidiagonal part of B with the divide-and-conquer or dqds
+ * solvers from detail/bidiagonal_svd.hpp instead of Algorithm 8.6.2, so that A = U*diag(U_b,I)*S*(V*V_b)'.
+ * Singular values are sorted in descending order. dqds computes singular values only, hence U and V are left empty.
+ */
+template<typename U_, typename B_, typename V_>
+static auto
+svd_bidiagonal_rtsam(U_ U, B_ B, V_ V, svd_algorithm alg) {
+	typedef std::decay_t<decltype(B.at(make_matrix_index(0, 0)))> _Ring_;
+	std::size_t const n_ = (*n)(size(B));
+	
+	std::vector<_Ring_> d(n_), e(n_ > 0 ? n_ - 1 : 0);
+	for (std::size_t i = 0; i < n_; ++i) {
+		d[i] = B.at(make_matrix_index(i, i));
+		if (i + 1 < n_) {
+			e[i] = B.at(make_matrix_index(i, i + 1));
+		}
+	}
+	std::fill(B.data().begin(), B.data().end(), _Ring_{0});
+	
+	if (alg == svd_algorithm::dqds) {
+		auto const s = bidiagonal_svd_dqds(d, e);
+		for (std::size_t i = 0; i < n_; ++i) {
+			B.at(make_matrix_index(i, i)) = s[i];
+		}
+		return make_svd_result(U_{std::size_t{0}, std::size_t{0}}, std::move(B), V_{std::size_t{0}, std::size_t{0}});
+	}
+	
+	if (alg != svd_algorithm::divide_and_conquer) {
+		BOOST_THROW_EXCEPTION(not_supported_exception{} << errinfo_svd_algorithm{alg});
+	}
+	
+	auto const usv = bidiagonal_svd_dc(std::move(d), std::move(e));
+	for (std::size_t i = 0; i < n_; ++i) {
+		B.at(make_matrix_index(i, i)) = usv.s[i];
+	}
+	multiply_leading_columns_rtsam(U, usv.u, n_);
+	multiply_leading_columns_rtsam(V, usv.v, n_);
+	return make_svd_result(std::move(U), std::move(B), std::move(V));
+}
+
+/*
+ * One-sided Jacobi SVD (Demmel and Veselic, 1992) of the m-by-n matrix W (m>=n) which is stored column by column.
+ * Each sweep orthogonalizes all column pairs of W by applying Givens rotations from the right to W and V, i.e. on
+ * return W = A*V has mutually orthogonal columns and V is orthogonal. The pairs of each sweep are visited in
+ * round-robin order, hence each of the n-1 rounds consists of n/2 disjoint pairs which are rotated in parallel.
+ */
+template<typename Ring>
+static void
+jacobi_rtsam(rtsam<Ring, storage_order::column_major> & W, rtsam<Ring, storage_order::column_major> & V) {
+	static constexpr std::size_t max_sweeps = 60;
+	
+	std::size_t const m_ = W.size().m();
+	std::size_t const n_ = W.size().n();
+	/* odd n is padded with a column which pairs with nothing */
+	std::size_t const players = n_ + (n_ % 2);
+	Ring const tol = std::numeric_limits<Ring>::epsilon() * m_;
+	
+	/* orthogonalizes columns p and q of W and returns whether they have been rotated */
+	auto rotate = [&W, &V, m_, tol](std::size_t p, std::size_t q) -> std::size_t {
+		Ring const * wp = W.data().data() + p * m_;
+		Ring const * wq = W.data().data() + q * m_;
+		Ring alpha{0}, beta{0}, gamma{0};
+		for (std::size_t i = 0; i < m_; ++i) {
+			alpha += wp[i] * wp[i];
+			beta  += wq[i] * wq[i];
+			gamma += wp[i] * wq[i];
+		}
+		
+		if (gamma == 0 || std::abs(gamma) <= tol * std::sqrt(alpha * beta)) {
+			return 0;
+		}
+		
+		Ring const zeta = (beta - alpha) / (2 * gamma);
+		Ring const t = std::copysign(Ring{1}, zeta) / (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+		Ring const c = 1 / std::sqrt(1 + t * t);
+		givens_result<Ring, Ring> const theta{c, c * t};
+		
+		W = (*multiply)(W, G(p, q, theta));
+		V = (*multiply)(V, G(p, q, theta));
+		return 1;
+	};
+	
+	for (std::size_t sweep = 0; sweep < max_sweeps && players > 1; ++sweep) {
+		std::size_t rotations = 0;
+		
+		for (std::size_t round = 0; round < players - 1; ++round) {
+			rotations += parallel_reduce(
+				0, players / 2, grain_size(players / 2, 6 * m_ + 4 * n_), std::size_t{0},
+				[&rotate, round, players, n_](std::size_t first, std::size_t last, std::size_t count) {
+					for (std::size_t k = first; k < last; ++k) {
+						std::size_t p = k == 0 ? players - 1 : (round + k) % (players - 1);
+						std::size_t q = (round + players - 1 - k) % (players - 1);
+						if (p > q) {
+							std::swap(p, q);
+						}
+						if (q < n_) {
+							count += rotate(p, q);
+						}
+					}
+					return count;
+				},
+				std::plus<>{}
+			);
+		}
+		
+		if (rotations == 0) {
+			break;
+		}
+	}
+}
+
+/*
+ * Computes the SVD of A (m>=n) with jacobi_rtsam() instead of Algorithm 8.6.2. The singular values are the column
+ * norms of W = A*V and the leading columns of U are the normalized columns of W. Columns which belong to zero singular
+ * values as well as the trailing m-n columns of U are completed to an orthonormal basis with a QR decomposition.
+ *
+ * For svd_algorithm::preconditioned_jacobi A = Q*R is decomposed first and the Jacobi sweeps operate on the n-by-n
+ * matrix R(0:n-1,:) only, which is cheaper for tall matrices and speeds up convergence, then U = Q*diag(U_r,I).
+ */
+template<typename U_, typename S_, typename V_, typename Ring, storage_order Order>
+static auto
+svd_jacobi_rtsam(rtsam<Ring, Order> const& a, svd_algorithm alg) {
+	typedef rtsam<Ring, storage_order::column_major> cm_matrix;
+	std::size_t const m_ = a.size().m();
+	std::size_t const n_ = a.size().n();
+	
+	cm_matrix W{m_, n_};
+	W = a;
+	
+	cm_matrix Q{std::size_t{0}, std::size_t{0}};
+	if (alg == svd_algorithm::preconditioned_jacobi) {
+		auto QR = (*qr)(std::move(W), make_qr_control(decompose_mode::complete, false));
+		Q = std::move(QR.q());
+		W = cm_matrix{n_, n_};
+		for (std::size_t j = 0; j < n_; ++j) {
+			for (std::size_t i = 0; i <= j; ++i) {
+				W.at(make_matrix_index(i, j)) = QR.r().at(make_matrix_index(i, j));
+			}
+		}
+	}
+	
+	std::size_t const rows = W.size().m();
+	cm_matrix Vj{n_, n_};
+	for (std::size_t i = 0; i < n_; ++i) {
+		Vj.at(make_matrix_index(i, i)) = Ring{1};
+	}
+	
+	jacobi_rtsam(W, Vj);
+	
+	std::vector<Ring> norms(n_);
+	for (std::size_t j = 0; j < n_; ++j) {
+		Ring const * w = W.data().data() + j * rows;
+		norms[j] = std::sqrt(std::inner_product(w, w + rows, w, Ring{0}));
+	}
+	std::vector<std::size_t> perm(n_);
+	std::iota(perm.begin(), perm.end(), std::size_t{0});
+	std::stable_sort(perm.begin(), perm.end(), [&norms](std::size_t i, std::size_t j) { return norms[i] > norms[j]; });
+	
+	/* columns of W whose norm is at roundoff level carry no reliable direction and are completed below */
+	Ring const s_max = n_ > 0 ? norms[perm[0]] : Ring{0};
+	Ring const cutoff = s_max * std::numeric_limits<Ring>::epsilon() * rows;
+	std::size_t r = 0;
+	while (r < n_ && norms[perm[r]] > cutoff) {
+		++r;
+	}
+	
+	cm_matrix Uw{rows, rows};
+	for (std::size_t j = 0; j < r; ++j) {
+		for (std::size_t i = 0; i < rows; ++i) {
+			Uw.at(make_matrix_index(i, j)) = W.at(make_matrix_index(i, perm[j])) / norms[perm[j]];
+		}
+	}
+	if (r == 0) {
+		for (std::size_t i = 0; i < rows; ++i) {
+			Uw.at(make_matrix_index(i, i)) = Ring{1};
+		}
+	} else if (r < rows) {
+		cm_matrix Ur{rows, r};
+		std::copy(Uw.data().begin(), Uw.data().begin() + rows * r, Ur.data().begin());
+		auto const Qc = (*qr)(std::move(Ur), make_qr_control(decompose_mode::complete, false)).q();
+		std::copy(Qc.data().begin() + rows * r, Qc.data().end(), Uw.data().begin() + rows * r);
+	}
+	
+	U_ U{m_, m_};
+	S_ S{m_, n_};
+	V_ V{n_, n_};
+	for (std::size_t j = 0; j < n_; ++j) {
+		S.at(make_matrix_index(j, j)) = norms[perm[j]];
+		for (std::size_t i = 0; i < n_; ++i) {
+			V.at(make_matrix_index(i, j)) = Vj.at(make_matrix_index(i, perm[j]));
+		}
+	}
+	
+	if (alg == svd_algorithm::preconditioned_jacobi) {
+		multiply_leading_columns_rtsam(Q, Uw.data(), n_);
+		U = Q;
+	} else {
+		U = Uw;
+	}
+	return make_svd_result(std::move(U), std::move(S), std::move(V));
+}
+
 /*
  * Algorithm 8.6.2 (The SVD Algorithm) on page 492
  * Given matrix A (which is real and m-by-n) (m>=n) the following
@@ -159,22 +398,20 @@ svd_step_rtsam(B_& B, std::size_t p, std::size_t q, U_& U, V_& V) {
  * them.
  *
  * Instead of overwriting A this algorithm stores A, U' and V and
- * returns them in the Struct SVDResult.
+ * returns them in the Struct SVDResult. If A is passed as an rvalue,
+ * then it is handed over to the bidiagonalization which overwrites it.
+ *
+ * The QR iteration is only used for svd_algorithm::qr_iteration, the
+ * Jacobi algorithms are handed over to svd_jacobi_rtsam() and the other
+ * algorithms to svd_bidiagonal_rtsam().
  */
 
-template<
-	typename Ring,
-	storage_order Order,
-	typename std::enable_if_t<
-		// TODO: Drop this restriction to double once almost_equal has been implemented for other arithmetic types
-		std::is_same_v< std::decay_t<Ring>, double >
-	>*
->
+template<typename Matrix>
 auto
-svd_impl_rtsam::operator()(
-	rtsam<Ring,Order> const& a,
+svd_rtsam(
+	Matrix && a,
 	svd_control<decompose_mode> const& ctrl
-) const {
+) {
 	if (ctrl.decompose_mode() != decompose_mode::complete) {
 		BOOST_THROW_EXCEPTION(not_supported_exception{} << errinfo_decompose_mode{ctrl.decompose_mode()});
 	}
@@ -195,11 +432,29 @@ svd_impl_rtsam::operator()(
 	//TODO: Make almost_equal_control customizable
 	almost_equal_control<int,int> aeq_ctrl{147,2};
 	
+	if (ctrl.algorithm() == svd_algorithm::jacobi || ctrl.algorithm() == svd_algorithm::preconditioned_jacobi) {
+		// return the same matrix types as the bidiagonalization based algorithms below
+		typedef decltype((*bidiag)(HBRS_MPL_FWD(a), make_bidiag_control(ctrl.decompose_mode()))) UBV_;
+		return svd_jacobi_rtsam<
+			std::decay_t<decltype(std::declval<UBV_&>().u())>,
+			std::decay_t<decltype(std::declval<UBV_&>().b())>,
+			std::decay_t<decltype(std::declval<UBV_&>().v())>
+		>(static_cast<std::decay_t<Matrix> const&>(a), ctrl.algorithm());
+	}
+	
+	// bidiag() and the Givens sweeps below draw their temporaries from this workspace
+	typedef typename std::decay_t<decltype(a.data())>::value_type _Ring_;
+	scoped_workspace<_Ring_> workspace;
+	
 	//Use Algorithm 5.4.2 to compute the bidiagonalization.
-	auto UBV = (*bidiag)(a, make_bidiag_control(ctrl.decompose_mode()));
+	auto UBV = (*bidiag)(HBRS_MPL_FWD(a), make_bidiag_control(ctrl.decompose_mode()));
 	auto U = std::move(UBV.u());
 	auto B = std::move(UBV.b());
 	auto V = std::move(UBV.v());
+	
+	if (ctrl.algorithm() != svd_algorithm::qr_iteration) {
+		return svd_bidiagonal_rtsam(std::move(U), std::move(B), std::move(V), ctrl.algorithm());
+	}
 
 	auto n_ = a_n;
 
@@ -289,7 +544,39 @@ svd_impl_rtsam::operator()(
 		}
 	}
 	
-	return make_svd_result(U, B, V);
+	return make_svd_result(std::move(U), std::move(B), std::move(V));
+}
+
+template<
+	typename Ring,
+	storage_order Order,
+	typename std::enable_if_t<
+		// TODO: Drop this restriction to double once almost_equal has been implemented for other arithmetic types
+		std::is_same_v< std::decay_t<Ring>, double >
+	>*
+>
+auto
+svd_impl_rtsam::operator()(
+	rtsam<Ring,Order> const& a,
+	svd_control<decompose_mode> const& ctrl
+) const {
+	return svd_rtsam(a, ctrl);
+}
+
+template<
+	typename Ring,
+	storage_order Order,
+	typename std::enable_if_t<
+		// TODO: Drop this restriction to double once almost_equal has been implemented for other arithmetic types
+		std::is_same_v< std::decay_t<Ring>, double >
+	>*
+>
+auto
+svd_impl_rtsam::operator()(
+	rtsam<Ring,Order> && a,
+	svd_control<decompose_mode> const& ctrl
+) const {
+	return svd_rtsam(std::move(a), ctrl);
 }
 
 /* namespace detail */ }
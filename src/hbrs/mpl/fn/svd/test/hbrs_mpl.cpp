@@ -24,6 +24,7 @@
 #ifdef HBRS_MPL_ENABLE_ELEMENTAL
 	#include <hbrs/mpl/dt/el_matrix.hpp>
 	#include <hbrs/mpl/dt/el_dist_matrix.hpp>
+	#include <hbrs/mpl/detail/tall_skinny.hpp>
 #endif
 #ifdef HBRS_MPL_ENABLE_MATLAB
 	#include <hbrs/mpl/dt/ml_matrix.hpp>
@@ -39,6 +40,8 @@
 #include <hbrs/mpl/dt/matrix_index.hpp>
 #include <hbrs/mpl/dt/matrix_size.hpp>
 #include <hbrs/mpl/dt/decompose_mode.hpp>
+#include <hbrs/mpl/dt/svd_algorithm.hpp>
+#include <hbrs/mpl/dt/rtsam.hpp>
 #include <hbrs/mpl/fn/m.hpp>
 #include <hbrs/mpl/fn/n.hpp>
 #include <hbrs/mpl/fn/size.hpp>
@@ -67,6 +70,8 @@
 #include <boost/hana/range.hpp>
 #include <boost/hana/length.hpp>
 
+#include <cmath>
+
 namespace utf = boost::unit_test;
 namespace tt = boost::test_tools;
 
@@ -197,6 +202,34 @@ BOOST_AUTO_TEST_CASE(svd_comparison, * utf::tolerance(_TOL)) {
 				);
 			}
 		},
+		[](auto && a, auto mode) {
+			// matrix has [VC,STAR] distribution
+			typedef decltype(a.at(matrix_index<std::size_t, std::size_t>{0u,0u})) Ring;
+			typedef std::decay_t<Ring> _Ring_;
+			
+			auto sz_ = (*size)(a);
+			auto m_ = (*m)(sz_);
+			auto n_ = (*n)(sz_);
+			
+			if constexpr(
+				(mode == decompose_mode::complete) ||
+				(mode == decompose_mode::zero && hana::value(m_) <= hana::value(n_))
+			) {
+				return detail::not_supported{};
+			} else {
+				static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+				return hana::make_tuple(
+					detail::svd_impl_el_dist_matrix{},
+					el_dist_matrix<_Ring_, El::VC, El::STAR>{
+						make_el_dist_matrix(
+							grid,
+							make_el_matrix(HBRS_MPL_FWD(a))
+						).data()
+					},
+					svd_control<decompose_mode>{mode}
+				);
+			}
+		},
 		#endif
 		[](auto && a, auto mode) {
 			auto sz_ = (*size)(a);
@@ -577,5 +610,129 @@ reasons for test failures:
  */
 }
 
+BOOST_AUTO_TEST_CASE(svd_algorithms, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static constexpr auto datasets = hana::make_tuple(
+		make_sm(
+			make_ctsav(detail::mat_a), make_matrix_size(hana::size_c<detail::mat_a_m>, hana::size_c<detail::mat_a_n>), row_major_c
+		),
+		make_sm(
+			make_ctsav(detail::mat_g), make_matrix_size(hana::size_c<detail::mat_g_m>, hana::size_c<detail::mat_g_n>), row_major_c
+		),
+		make_sm(
+			make_ctsav(detail::mat_k), make_matrix_size(hana::size_c<detail::mat_k_m>, hana::size_c<detail::mat_k_n>), row_major_c
+		),
+		make_sm(
+			make_ctsav(detail::mat_o), make_matrix_size(hana::size_c<detail::mat_o_m>, hana::size_c<detail::mat_o_n>), row_major_c
+		)
+	);
+	
+	hana::for_each(datasets, [](auto const& dataset) {
+		auto const a = make_rtsam(dataset);
+		std::size_t const m_ = (*m)((*size)(a));
+		std::size_t const n_ = (*n)((*size)(a));
+		if (m_ < n_) {
+			return;
+		}
+		
+		auto const dc = (*svd)(a, make_svd_control(decompose_mode::complete, svd_algorithm::divide_and_conquer));
+		auto const& s = (*at)(dc, svd_s{});
+		
+		for (auto alg : { svd_algorithm::divide_and_conquer, svd_algorithm::jacobi, svd_algorithm::preconditioned_jacobi }) {
+			BOOST_TEST_MESSAGE("Testing algorithm " << static_cast<int>(alg) << " on " << m_ << "x" << n_ << " matrix");
+			auto const usv = (*svd)(a, make_svd_control(decompose_mode::complete, alg));
+			auto const& u = (*at)(usv, svd_u{});
+			auto const& v = (*at)(usv, svd_v{});
+			
+			HBRS_MPL_TEST_MMEQ((*multiply)((*multiply)(u, (*at)(usv, svd_s{})), transpose(v)), a, false);
+			HBRS_MPL_TEST_IS_IDENTITY((*multiply)(u, transpose(u)));
+			HBRS_MPL_TEST_IS_IDENTITY((*multiply)(v, transpose(v)));
+			HBRS_MPL_TEST_MMEQ((*at)(usv, svd_s{}), s, false);
+		}
+		for (std::size_t i = 0; i + 1 < n_; ++i) {
+			BOOST_TEST(s.at(make_matrix_index(i, i)) >= s.at(make_matrix_index(i+1, i+1)));
+		}
+		
+		BOOST_TEST_MESSAGE("Testing dqds on " << m_ << "x" << n_ << " matrix");
+		auto const dqds = (*svd)(a, make_svd_control(decompose_mode::complete, svd_algorithm::dqds));
+		HBRS_MPL_TEST_MMEQ((*at)(dqds, svd_s{}), s, false);
+		BOOST_TEST((*size)((*at)(dqds, svd_u{})) == make_matrix_size(0u, 0u));
+	});
+}
+
+BOOST_AUTO_TEST_CASE(svd_single_column, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	for (std::size_t m_ : { 1u, 3u }) {
+		rtsam<double, storage_order::row_major> a{m_, 1u};
+		double norm = 0.;
+		for (std::size_t i = 0; i < m_; ++i) {
+			a.at(make_matrix_index(i, 0u)) = 1. + 2. * i;
+			norm += (1. + 2. * i) * (1. + 2. * i);
+		}
+		
+		for (auto alg : { svd_algorithm::divide_and_conquer, svd_algorithm::jacobi, svd_algorithm::preconditioned_jacobi }) {
+			BOOST_TEST_MESSAGE("Testing algorithm " << static_cast<int>(alg) << " on " << m_ << "x1 matrix");
+			auto const usv = (*svd)(a, make_svd_control(decompose_mode::complete, alg));
+			auto const& u = (*at)(usv, svd_u{});
+			auto const& s = (*at)(usv, svd_s{});
+			auto const& v = (*at)(usv, svd_v{});
+			
+			HBRS_MPL_TEST_MMEQ((*multiply)((*multiply)(u, s), transpose(v)), a, false);
+			HBRS_MPL_TEST_IS_IDENTITY((*multiply)(u, transpose(u)));
+			HBRS_MPL_TEST_IS_IDENTITY((*multiply)(v, transpose(v)));
+			BOOST_TEST(s.at(make_matrix_index(0u, 0u)) == std::sqrt(norm));
+		}
+	}
+}
+
+#ifdef HBRS_MPL_ENABLE_ELEMENTAL
+BOOST_AUTO_TEST_CASE(svd_tall_skinny, * utf::tolerance(_TOL)) {
+	using namespace hbrs::mpl;
+	
+	static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+	
+	// m >= tall_skinny_min_aspect_ratio * n and m >= n * p for up to 64 processes, so svd takes the TSQR path
+	std::size_t const m_ = 256u;
+	std::size_t const n_ = 4u;
+	rtsam<double, storage_order::row_major> a{m_, n_};
+	for (std::size_t i = 0; i < m_; ++i) {
+		for (std::size_t j = 0; j < n_; ++j) {
+			a.at(make_matrix_index(i, j)) = std::sin(1. + i * n_ + j) + (i % n_ == j ? 1. : 0.);
+		}
+	}
+	if (!detail::is_tsqr_applicable((El::Int)m_, (El::Int)n_, grid)) {
+		// TSQR requires a power-of-two number of processes
+		BOOST_TEST_MESSAGE("Grid of size " << grid.Size() << " takes the 2D path instead of TSQR");
+	}
+	
+	auto const a_star_star = make_el_dist_matrix(grid, make_el_matrix(a));
+	
+	auto check = [&](auto const& a_dist) {
+		for (auto mode : { decompose_mode::economy, decompose_mode::zero }) {
+			auto const usv = (*svd)(a_dist, make_svd_control(mode));
+			auto const& u = (*at)(usv, svd_u{});
+			auto const& s = (*at)(usv, svd_s{});
+			auto const& v = (*at)(usv, svd_v{});
+			
+			BOOST_TEST((*size)(u) == make_matrix_size(m_, n_));
+			BOOST_TEST((*size)(s) == make_matrix_size(n_, n_));
+			BOOST_TEST((*size)(v) == make_matrix_size(n_, n_));
+			
+			HBRS_MPL_TEST_MMEQ(a, (*multiply)((*multiply)(u, s), (*transpose)(v)), false);
+			HBRS_MPL_TEST_IS_IDENTITY((*multiply)((*transpose)(u), u));
+			HBRS_MPL_TEST_IS_IDENTITY((*multiply)(v, (*transpose)(v)));
+		}
+	};
+	
+	BOOST_TEST_MESSAGE("Testing TSQR on [VC,STAR] matrix");
+	check(el_dist_matrix<double, El::VC, El::STAR, El::ELEMENT>{a_star_star});
+	
+	BOOST_TEST_MESSAGE("Testing TSQR on [MC,MR] matrix");
+	check(el_dist_matrix<double, El::MC, El::MR, El::ELEMENT>{a_star_star});
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
 
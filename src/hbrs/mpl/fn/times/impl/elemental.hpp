@@ -37,6 +37,12 @@
 #include <hbrs/mpl/fn/n.hpp>
 #include <hbrs/mpl/fn/times.hpp>
 
+#include <hbrs/mpl/detail/shared_matrix.hpp>
+#include <hbrs/mpl/detail/simd.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <type_traits>
+#include <vector>
+
 HBRS_MPL_NAMESPACE_BEGIN
 namespace detail {
 
@@ -125,8 +131,8 @@ times_impl_el_dist_matrix_expand_expr_el_dist_matrix::operator()(
 	
 	BOOST_ASSERT(from.length() == lhs.n());
 	
-	El::DistMatrix<RingR, El::STAR, El::STAR, WrappingR> rhs_ = { from.data() }; // fetch complete vector to local process
-	El::Matrix<RingR> & rhs_lcl = rhs_.Matrix();
+	shared_matrix<RingR> rhs_{from.data()}; // fetch complete vector, once per node if it is large
+	El::Matrix<RingR> const& rhs_lcl = rhs_.data();
 	
 	/* Code inspired by Elemental/include/El/blas_like/level1/Hadamard.hpp */
 	
@@ -137,12 +143,25 @@ times_impl_el_dist_matrix_expand_expr_el_dist_matrix::operator()(
 	auto lhs_lcl_buf = lhs_lcl.Buffer();
 	auto rhs_lcl_buf = rhs_lcl.LockedBuffer();
 	
+	if constexpr (std::is_same_v<RingL, RingR> && simd::has_kernels_v<RingL>) {
+		// scale each local column with the kernel for the cpu's instruction set
+		EL_PARALLEL_FOR
+		for(El::Int j = 0; j < lhs_lcl.Width(); ++j) {
+			simd::scale(
+				lhs_lcl_buf + j*lhs_ldim,
+				boost::numeric_cast<std::size_t>(lhs_lcl.Height()),
+				rhs_lcl_buf[lhs.data().GlobalCol(j)*rhs_ldim]
+			);
+		}
+		return lhs;
+	}
+	
 	EL_PARALLEL_FOR
 	for(El::Int j = 0; j < lhs_lcl.Width(); ++j) {
 		EL_SIMD
 		for(El::Int i = 0; i < lhs_lcl.Height(); ++i) {
 			std::size_t lhs_lcl_offset = i+j*lhs_ldim;
-			std::size_t rhs_lcl_offset = rhs_.LocalRow(0) + rhs_.LocalCol(lhs.data().GlobalCol(j))*rhs_ldim;
+			std::size_t rhs_lcl_offset = lhs.data().GlobalCol(j)*rhs_ldim;
 			BOOST_ASSERT(lhs_lcl_offset < lhs_lcl.Width() * lhs_lcl.Height());
 			BOOST_ASSERT(rhs_lcl_offset < rhs_lcl.Width() * rhs_lcl.Height());
 			lhs_lcl_buf[lhs_lcl_offset] *= rhs_lcl_buf[rhs_lcl_offset];
@@ -189,8 +208,8 @@ times_impl_el_dist_matrix_expand_expr_el_dist_matrix::operator()(
 	
 	BOOST_ASSERT(from.length() == lhs.m());
 	
-	El::DistMatrix<RingR, El::STAR, El::STAR, WrappingR> rhs_ = { from.data() }; // fetch complete vector to local process
-	El::Matrix<RingR> & rhs_lcl = rhs_.Matrix();
+	shared_matrix<RingR> rhs_{from.data()}; // fetch complete vector, once per node if it is large
+	El::Matrix<RingR> const& rhs_lcl = rhs_.data();
 	
 	/* Code inspired by Elemental/include/El/blas_like/level1/Hadamard.hpp */
 	
@@ -201,12 +220,28 @@ times_impl_el_dist_matrix_expand_expr_el_dist_matrix::operator()(
 	auto lhs_lcl_buf = lhs_lcl.Buffer();
 	auto rhs_lcl_buf = rhs_lcl.LockedBuffer();
 	
+	if constexpr (std::is_same_v<RingL, RingR> && simd::has_kernels_v<RingL>) {
+		// gather the entries for the local rows once, then multiply contiguous columns with the cpu's kernel
+		std::size_t const lhs_lcl_m = boost::numeric_cast<std::size_t>(lhs_lcl.Height());
+		std::vector<RingL> rhs_rows(lhs_lcl_m);
+		for(std::size_t i = 0; i < lhs_lcl_m; ++i) {
+			rhs_rows[i] = rhs_lcl_buf[lhs.data().GlobalRow(i)];
+		}
+		
+		EL_PARALLEL_FOR
+		for(El::Int j = 0; j < lhs_lcl.Width(); ++j) {
+			RingL * col = lhs_lcl_buf + j*lhs_ldim;
+			simd::multiply(col, rhs_rows.data(), col, lhs_lcl_m);
+		}
+		return lhs;
+	}
+	
 	EL_PARALLEL_FOR
 	for(El::Int j = 0; j < lhs_lcl.Width(); ++j) {
 		EL_SIMD
 		for(El::Int i = 0; i < lhs_lcl.Height(); ++i) {
 			std::size_t lhs_lcl_offset = i+j*lhs_ldim;
-			std::size_t rhs_lcl_offset = rhs_.LocalRow(lhs.data().GlobalRow(i)) + rhs_.LocalCol(0)*rhs_ldim;
+			std::size_t rhs_lcl_offset = lhs.data().GlobalRow(i);
 			BOOST_ASSERT(lhs_lcl_offset < lhs_lcl.Width() * lhs_lcl.Height());
 			BOOST_ASSERT(rhs_lcl_offset < rhs_lcl.Width() * rhs_lcl.Height());
 			lhs_lcl_buf[lhs_lcl_offset] *= rhs_lcl_buf[rhs_lcl_offset];
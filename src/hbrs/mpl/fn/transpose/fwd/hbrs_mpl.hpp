@@ -24,6 +24,7 @@
 #include <hbrs/mpl/dt/submatrix/fwd.hpp>
 #include <hbrs/mpl/dt/rtsacv/fwd.hpp>
 #include <hbrs/mpl/dt/rtsarv/fwd.hpp>
+#include <hbrs/mpl/dt/hankel_matrix/fwd.hpp>
 
 #include <boost/hana/tuple.hpp>
 
@@ -61,6 +62,13 @@ struct transpose_impl_rtsam {
     decltype(auto)
     operator()(rtsam<Ring,Order> const& m_) const;
 
+	template<
+		typename Ring,
+		storage_order Order
+	>
+	decltype(auto)
+	operator()(rtsam<Ring,Order> && m_) const;
+
 	template<
 		typename Ring,
 		storage_order Order,
@@ -80,6 +88,15 @@ struct transpose_impl_rtsacv {
 	>
 	rtsarv<Ring>
     operator()(rtsacv<Ring> const& v) const;
+
+	template<
+		typename Ring,
+		typename std::enable_if_t<
+			!std::is_const_v< std::remove_reference_t<Ring> >
+		>* = nullptr
+	>
+	rtsarv<Ring>
+	operator()(rtsacv<Ring> && v) const;
 };
 
 struct transpose_impl_rtsarv {
@@ -91,6 +108,21 @@ struct transpose_impl_rtsarv {
 	>
 	rtsacv<Ring>
     operator()(rtsarv<Ring> const& v) const;
+
+	template<
+		typename Ring,
+		typename std::enable_if_t<
+			!std::is_const_v< std::remove_reference_t<Ring> >
+		>* = nullptr
+	>
+	rtsacv<Ring>
+	operator()(rtsarv<Ring> && v) const;
+};
+
+struct transpose_impl_hankel_matrix {
+	template<typename Matrix, typename Delays>
+	constexpr auto
+	operator()(hankel_matrix<Matrix, Delays> const& a) const;
 };
 
 /* namespace detail */ }
@@ -101,7 +133,8 @@ HBRS_MPL_NAMESPACE_END
 		hbrs::mpl::detail::transpose_impl_scv{},                                                                       \
 		hbrs::mpl::detail::transpose_impl_rtsam{},                                                                     \
 		hbrs::mpl::detail::transpose_impl_rtsacv{},                                                                    \
-		hbrs::mpl::detail::transpose_impl_rtsarv{}                                                                     \
+		hbrs::mpl::detail::transpose_impl_rtsarv{},                                                                    \
+		hbrs::mpl::detail::transpose_impl_hankel_matrix{}                                                              \
 	)
 
 #endif // !HBRS_MPL_FN_TRANSPOSE_FWD_HBRS_MPL_HPP
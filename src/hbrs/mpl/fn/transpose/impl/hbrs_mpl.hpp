@@ -26,6 +26,8 @@
 #include <hbrs/mpl/dt/submatrix.hpp>
 #include <hbrs/mpl/dt/rtsacv.hpp>
 #include <hbrs/mpl/dt/rtsarv.hpp>
+#include <hbrs/mpl/dt/hankel_matrix.hpp>
+#include <hbrs/mpl/dt/expression.hpp>
 
 HBRS_MPL_NAMESPACE_BEGIN
 namespace hana = boost::hana;
@@ -70,13 +72,32 @@ transpose_rtsam_impl(Matrix const& m_, hana::basic_type<Ring>, storage_order_<Or
 	return transposed;
 }
 
+/* A row-major m-by-n matrix has exactly the same memory layout as a column-major n-by-m matrix, hence transposing a
+ * rtsam does not move any elements but only reinterprets its buffer with the opposite storage order.
+ */
 template<
 	typename Ring,
 	storage_order Order
 >
 decltype(auto)
 transpose_impl_rtsam::operator()(rtsam<Ring,Order> const& m_) const {
-	return transpose_rtsam_impl(m_, hana::type_c<Ring>, storage_order_c<Order>);
+	return rtsam<
+		Ring,
+		Order == storage_order::row_major ? storage_order::column_major : storage_order::row_major
+	> { m_.data(), { (*n)(size(m_)), (*m)(size(m_)) } };
+}
+
+template<
+	typename Ring,
+	storage_order Order
+>
+decltype(auto)
+transpose_impl_rtsam::operator()(rtsam<Ring,Order> && m_) const {
+	auto sz = (*size)(m_);
+	return rtsam<
+		Ring,
+		Order == storage_order::row_major ? storage_order::column_major : storage_order::row_major
+	> { std::move(m_).data(), { (*n)(sz), (*m)(sz) } };
 }
 
 template<
@@ -101,6 +122,17 @@ transpose_impl_rtsacv::operator()(rtsacv<Ring> const& v) const {
 	return {v.data()};
 }
 
+template<
+	typename Ring,
+	typename std::enable_if_t<
+		!std::is_const_v< std::remove_reference_t<Ring> >
+	>*
+>
+rtsarv<Ring>
+transpose_impl_rtsacv::operator()(rtsacv<Ring> && v) const {
+	return {std::move(v).data()};
+}
+
 template<
 	typename Ring,
 	typename std::enable_if_t<
@@ -112,6 +144,24 @@ transpose_impl_rtsarv::operator()(rtsarv<Ring> const& v) const {
 	return {v.data()};
 }
 
+template<
+	typename Ring,
+	typename std::enable_if_t<
+		!std::is_const_v< std::remove_reference_t<Ring> >
+	>*
+>
+rtsacv<Ring>
+transpose_impl_rtsarv::operator()(rtsarv<Ring> && v) const {
+	return {std::move(v).data()};
+}
+
+/* Transposed block-Hankel matrices are not materialised, instead operations like multiply() work on the expression */
+template<typename Matrix, typename Delays>
+constexpr auto
+transpose_impl_hankel_matrix::operator()(hankel_matrix<Matrix, Delays> const& a) const {
+	return make_expression(transpose, hana::tuple<decltype(a)>{a});
+}
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
@@ -30,6 +30,9 @@ template auto variance_impl_el_dist_matrix_columns::operator()(expression<column
 template auto variance_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<double>>> const&, double) const;
 template auto variance_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<El::Complex<double>>>> const&, double) const;
 
+template auto variance_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<float, El::VC, El::STAR>>> const&, float) const;
+template auto variance_impl_el_dist_matrix_columns::operator()(expression<columns_t, hana::tuple<el_dist_matrix<double, El::VC, El::STAR>>> const&, double) const;
+
 /* namespace detail */ }
 HBRS_MPL_NAMESPACE_END
 
@@ -40,6 +40,7 @@
 #include <hbrs/mpl/fn/power.hpp>
 #include <hbrs/mpl/fn/divide.hpp>
 #include <hbrs/mpl/fn/columns.hpp>
+#include <hbrs/mpl/detail/tall_skinny.hpp>
 
 #include <hbrs/mpl/dt/smcs.hpp>
 #include <hbrs/mpl/dt/smrs.hpp>
@@ -67,6 +68,31 @@ variance_impl_el(Sequence const& seq, Matrix const& mat, Weight w) {
 	return (*transform)(summed, [&biased_m](auto x) { return (*divide)(x, biased_m); });
 }
 
+template <
+	typename Sequence,
+	typename Ring, El::Dist Columnwise, El::Dist Rowwise, El::DistWrap Wrapping,
+	typename Weight
+>
+auto
+variance_impl_el_dist(
+	Sequence const& seq,
+	el_dist_matrix<Ring, Columnwise, Rowwise, Wrapping> const& mat,
+	Weight w
+) {
+	typedef std::decay_t<Ring> _Ring_;
+	
+	if constexpr (is_row_distributed_v<Columnwise, Rowwise> && !El::IsComplex<_Ring_>::value) {
+		BOOST_ASSERT((w == 1) || (w == 0));
+		// a single reduction of sums and squared deviations replaces the reductions in mean(), minus() and sum()
+		auto moments = column_moments(mat.data());
+		auto & m2s = moments.second;
+		El::Scale(_Ring_(1) / _Ring_(mat.m()-1+w), m2s);
+		return make_el_dist_row_vector(std::move(m2s));
+	} else {
+		return variance_impl_el(seq, mat, w);
+	}
+}
+
 template <
 	typename Matrix,
 	typename Weight,
@@ -97,7 +123,7 @@ variance_impl_el_dist_matrix_columns::operator()(
 	Weight w
 ) const {
 	auto const& mat = hana::at_c<0>(expr.operands());
-	return variance_impl_el(expr, mat, w);
+	return variance_impl_el_dist(expr, mat, w);
 }
 
 /* namespace detail */ }
@@ -35,6 +35,7 @@
 
 
 #include <hbrs/mpl/dt/srv.hpp>
+#include <hbrs/mpl/dt/matrix_index.hpp>
 #include <hbrs/mpl/fn/variance.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/transform.hpp>
@@ -120,6 +121,17 @@ BOOST_AUTO_TEST_CASE(columns_variances, * utf::tolerance(_TOL)) {
 				auto matrix = make_el_dist_matrix(grid, make_el_matrix(HBRS_MPL_FWD(dataset)));
 				return (*hbrs::mpl::variance)(columns(matrix), HBRS_MPL_FWD(weight));
 			},
+			[](auto && dataset, auto && weight) {
+				// matrix has [VC,STAR] distribution
+				typedef decltype(dataset.at(matrix_index<std::size_t, std::size_t>{0u,0u})) Ring;
+				typedef std::decay_t<Ring> _Ring_;
+				
+				static El::Grid grid{}; // grid is static because reference to grid is required by El::DistMatrix<...>
+				el_dist_matrix<_Ring_, El::VC, El::STAR> matrix{
+					make_el_dist_matrix(grid, make_el_matrix(HBRS_MPL_FWD(dataset))).data()
+				};
+				return (*hbrs::mpl::variance)(columns(matrix), HBRS_MPL_FWD(weight));
+			},
 			#endif
 			"SEQUENCE_TERMINATOR___REMOVED_BY_DROP_BACK"
 		));